@@ -2,7 +2,12 @@
 
 #include <stdint.h>
 
+#include <stddef.h>
+
+// Default block size. Stores can use larger blocks, any power of two up to BLOCK_MAX_LENGTH,
+// block_t then only describes their header and the first BLOCK_LENGTH bytes.
 #define BLOCK_LENGTH 16384
+#define BLOCK_MAX_LENGTH (1 << 20)
 #define BLOCK_HEADER_LENGTH 128
 
 #define SAMPLE_DATA_PER_BLOCK (BLOCK_LENGTH - BLOCK_HEADER_LENGTH)
@@ -21,6 +26,10 @@
 #define BLOCK_TYPE_F32_SAMPLES 4
 #define BLOCK_TYPE_F64_SAMPLES 5
 
+// Payload codecs of blocks in compressed stores
+#define BLOCK_CODEC_NONE  0
+#define BLOCK_CODEC_DELTA 1
+
 // struct.pack("<I", 0x51657945) => b'EyeQ'
 #define BLOCK_MAGIC 0x51657945
 
@@ -79,6 +88,17 @@ typedef struct block_s {
                     float center_frequency;
                 } sample_block_header;
             };
+
+            // Set while the block is compressed inside a store (any of the BLOCK_CODEC_x
+            // defines), together with the block length before compression. Blocks read
+            // from a store are always decompressed.
+            uint8_t codec;
+            uint16_t raw_length;
+
+            // High 16 bits of block_length and raw_length, for blocks over 64 KiB. Use
+            // block_get_length and friends rather than the fields themselves.
+            uint16_t block_length_high;
+            uint16_t raw_length_high;
         } hdr;
     };
     union {
@@ -107,3 +127,31 @@ typedef struct block_s {
         struct cu64_sample cu64_samples[BLOCK_F64_SAMPLES];
     } data;
 } __attribute__((packed)) block_t;
+
+static inline uint32_t block_get_length(const block_t *block) {
+    return block->hdr.block_length | (uint32_t)block->hdr.block_length_high << 16;
+}
+
+static inline void block_set_length(block_t *block, uint32_t length) {
+    block->hdr.block_length = length & 0xffff;
+    block->hdr.block_length_high = length >> 16;
+}
+
+static inline uint32_t block_get_raw_length(const block_t *block) {
+    return block->hdr.raw_length | (uint32_t)block->hdr.raw_length_high << 16;
+}
+
+static inline void block_set_raw_length(block_t *block, uint32_t length) {
+    block->hdr.raw_length = length & 0xffff;
+    block->hdr.raw_length_high = length >> 16;
+}
+
+// Payload of a block of any size, which may run past the end of block_t
+static inline void* block_payload(const block_t *block) {
+    return (uint8_t *)block + BLOCK_HEADER_LENGTH;
+}
+
+// Number of payload bytes in blocks of block_size bytes
+static inline size_t block_payload_size(uint32_t block_size) {
+    return block_size - BLOCK_HEADER_LENGTH;
+}
@@ -16,6 +16,9 @@
 #define EYEQ_ERROR 6
 #define EYEQ_NOT_FOUND 7
 
+// Maximum number of blocks in one eyeq_write_blocks call
+#define EYEQ_WRITE_BLOCKS_MAX pb_arraysize(eyeq_WriteBlock, blocks)
+
 typedef struct {
     // ZMQ socket
     void *context;
@@ -37,7 +40,13 @@ void eyeq_close(eyeq_client_t *client);
 int eyeq_create_store(eyeq_client_t *client, eyeq_Store *store);
 int eyeq_list_stores(eyeq_client_t *client, const char *path, bool (*list_stores_callback)(eyeq_Store *store), void *context);
 int eyeq_delete_store(eyeq_client_t *client, const char *name, const char *path);
+// Freezes blocks [start_block, start_block + block_count) of a store as a new read-only
+// store. file_path is where file and mmap stores are cloned to. snapshot may be NULL.
+int eyeq_snapshot_store(eyeq_client_t *client, const char *name, const char *path, const char *snapshot_name,
+                        const char *snapshot_path, const char *file_path, uint32_t start_block, uint32_t block_count,
+                        eyeq_Store *snapshot);
 int eyeq_write_block(eyeq_client_t *client, const char *name, const char *path, eyeq_Block *block, int32_t offset, uint32_t *written_offset);
+int eyeq_write_blocks(eyeq_client_t *client, const char *name, const char *path, eyeq_Block *blocks, uint32_t count, int32_t offset, uint32_t *written_offset);
 
 int eyeq_read_blocks(
     eyeq_client_t *client,
@@ -49,12 +58,40 @@ int eyeq_read_blocks(
     long timeout_ms,
     void *context);
 
+// Like eyeq_read_blocks, starting at the block covering the given Unix time
+int eyeq_read_blocks_at_time(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    uint64_t sec,
+    uint32_t nsec,
+    uint32_t count,
+    bool (*read_block_callback)(eyeq_Block *block, void *context),
+    long timeout_ms,
+    void *context);
+
+// Calls query_blocks_callback with each run of blocks whose headers match the conditions
+// set in query, fetching the pages one after the other. name and path of query are ignored.
+int eyeq_query_blocks(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    const eyeq_QueryBlocks *query,
+    bool (*query_blocks_callback)(eyeq_QueryBlocks_Run *run, void *context),
+    void *context);
+
+// Reads the summaries of up to 1024 * stride blocks from start_block on, stride blocks per entry
+int eyeq_block_stats(eyeq_client_t *client, const char *name, const char *path, uint32_t start_block, uint32_t stride,
+                     eyeq_BlockStats_Response *stats);
+
 int eyeq_flush_stores(eyeq_client_t *client);
 int eyeq_find_store(eyeq_client_t *client, const char *name, const char *path, eyeq_Store *response);
 
 int eyeq_close_stream(eyeq_client_t *client, const char *name, const char *path);
 int eyeq_list_streams(eyeq_client_t *client, const char *path, bool (*list_streams_callback)(eyeq_Stream *stream), void *context);
 int eyeq_seek_stream(eyeq_client_t *client, const char *name, const char *path, uint32_t block_id);
+// Seeks to the block covering the given Unix time
+int eyeq_seek_stream_time(eyeq_client_t *client, const char *name, const char *path, uint64_t sec, uint32_t nsec);
 int eyeq_create_frequency_filter_stream(
     eyeq_client_t *client,
     const char *name,
@@ -66,6 +103,21 @@ int eyeq_create_frequency_filter_stream(
     float relative_frequency,
     const float *filter_taps,
     int ntaps);
+// Like eyeq_create_frequency_filter_stream, resampling the filtered stream by interpolation /
+// decimation. The taps are at interpolation times the store sample rate.
+int eyeq_create_resampled_stream(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    const char *store_name,
+    const char *store_path,
+    uint32_t start_block,
+    uint32_t block_count,
+    float relative_frequency,
+    const float *filter_taps,
+    int ntaps,
+    uint32_t interpolation,
+    uint32_t decimation);
 
 int eyeq_read_stream(
     eyeq_client_t *client,
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <sys/queue.h>
+#include <stdint.h>
 
 struct store_s;
 struct stream_base;
@@ -8,27 +8,36 @@ struct stream_base;
 #define STORE_MAX_NAME 31
 #define STORE_MAX_PATH 127
 
-typedef struct store_dir_entry_s {
+typedef struct dir_entry_s {
     char name[STORE_MAX_NAME+1];
     char path[STORE_MAX_PATH+1];
 
-    SLIST_ENTRY(store_dir_entry_s) next;
+    // Next entry in the same hash bucket
+    struct dir_entry_s *hash_next;
+    uint32_t hash;
 
-    struct store_s *store;
-} store_list_entry_t;
+    void *item;
+} dir_entry_t;
 
-typedef SLIST_HEAD(store_list_head_s, store_dir_entry_s) store_list_t;
+// Directory of named stores or streams. Entries are found through a hash of (path, name),
+// and listed in (path, name) order from a sorted array, so a path prefix is one binary
+// search away and a listing can be continued after any entry.
+typedef struct directory_s {
+    dir_entry_t **buckets;
+    uint32_t bucket_count;
 
-typedef struct stream_dir_entry_s {
-    char name[STORE_MAX_NAME+1];
-    char path[STORE_MAX_PATH+1];
-
-    SLIST_ENTRY(stream_dir_entry_s) next;
+    dir_entry_t **sorted;
+    uint32_t count;
+    uint32_t capacity;
+} directory_t;
 
-    struct stream_base *stream;
-} stream_list_entry_t;
+typedef struct store_list_s {
+    directory_t dir;
+} store_list_t;
 
-typedef SLIST_HEAD(stream_list_head_s, stream_dir_entry_s) stream_list_t;
+typedef struct stream_list_s {
+    directory_t dir;
+} stream_list_t;
 
 int load_store_list_from_file(const char *filepath, store_list_t *list);
 int save_store_list_to_file(const char *filepath, store_list_t *list);
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <pthread.h>
 #include <eyeq/server.h>
 #include <eyeq/block.h>
 
@@ -17,26 +18,251 @@
 #define STORE_FILE_NOT_FOUND 8
 #define STORE_COULD_NOT_WRITE_LIST 9
 #define STORE_STILL_IN_USE 10
+#define STORE_NOT_MAPPED 11
+#define STORE_NOT_SUPPORTED 12
+#define STORE_BAD_CRC 13
+#define STORE_READ_ONLY 14
 
 #define MEMORY_STORE 0
 #define FILE_STORE   1
+#define MMAP_STORE   2
+#define DIRECT_STORE 3
+#define TIERED_STORE 4
+#define STRIPED_STORE 5
+
+// When written blocks are synced to disk
+#define STORE_DURABILITY_NONE     0 // Left to the kernel
+#define STORE_DURABILITY_PERIODIC 1 // Group commit every interval or number of blocks
+#define STORE_DURABILITY_SYNC     2 // Before every write returns
+
+// Maximum number of files of a striped store
+#define STORE_MAX_STRIPES 8
+
+// Alignment of block buffers for O_DIRECT I/O
+#define STORE_BLOCK_ALIGNMENT 4096
+
+// Summary of the samples of a block, computed when it is written. Power and magnitudes are
+// relative to full scale, so 10 * log10(mean_power) is in dBFS.
+typedef struct {
+    float mean_power;
+    float peak_magnitude;
+    float dc_i;
+    float dc_q;
+    uint32_t clip_count;
+} block_stats_t;
 
 typedef struct store_s {
     uint32_t block_count;
+    // Bytes per block, a power of two from BLOCK_LENGTH to BLOCK_MAX_LENGTH
+    uint32_t block_size;
     uint32_t write_offset;
     int store_type;
 
     void *internal;
 
     int ref_count;
+
+    // Blocks are compressed with this BLOCK_CODEC_x codec when written
+    int codec;
+
+    // Block timestamps by ring position, for store_find_time
+    struct time_index_s *time_index;
+
+    // Reads check the block CRCs when set
+    bool verify_crc;
+
+    // Writes return STORE_READ_ONLY, set for snapshots
+    bool read_only;
+
+    // Bitmap of the blocks that failed their CRC check, allocated with the first one
+    uint64_t *bad_blocks;
+    uint32_t bad_block_count;
+
+    // Background scrubber and its rate in blocks per second, 0 when not scrubbing
+    struct store_scrubber_s *scrubber;
+    uint32_t scrub_rate;
+
+    // STORE_DURABILITY_x mode, see store_set_durability
+    int durability;
+    uint32_t sync_interval_ms;
+    uint32_t sync_blocks;
+
+    // Writes out the ingest queue and does periodic syncs, NULL if neither is used
+    struct store_committer_s *committer;
+
+    // Reads share the lock, writes take it exclusively
+    pthread_rwlock_t lock;
 } store_t;
 
+// A memory store of BLOCK_LENGTH blocks
 store_t* new_memory_store(uint32_t number_of_blocks);
-store_t* new_file_store(const char *filepath, uint32_t number_of_blocks, bool initialize);
+
+// Creates a memory store whose pages are only committed when blocks are written. With
+// hugepages it is backed by huge pages, explicit ones if the system reserved enough of
+// them, transparent ones otherwise. If numa_node is not negative, its memory is allocated
+// on that NUMA node.
+store_t* new_memory_store_on_node(uint32_t number_of_blocks, int numa_node, bool hugepages);
+
+// A memory store that store_sync writes to the snapshot file filepath. Unless initialize
+// is set, an existing snapshot is mapped back, its blocks are only read when used.
+store_t* new_snapshot_memory_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size,
+                                   int numa_node, bool hugepages, bool initialize);
+
+// The constructors below take the block size of the store, 0 for BLOCK_LENGTH. When an
+// existing file or direct store is opened, its block size and count come from the file
+// instead.
+store_t* new_file_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize);
+store_t* new_mmap_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize);
+store_t* new_direct_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize);
+
+// Keeps the newest hot_blocks blocks in memory and writes them behind to a file store of
+// number_of_blocks blocks, so recent blocks are read from memory and older ones from disk.
+store_t* new_tiered_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, uint32_t hot_blocks,
+                          bool initialize);
+
+// Spreads consecutive blocks round-robin over the comma separated files in filepaths,
+// so the bandwidth of several disks adds up.
+store_t* new_striped_store(const char *filepaths, uint32_t number_of_blocks, uint32_t block_size, bool initialize);
+
+// Number of I/Os file, direct and striped stores keep in flight for multi-block reads and
+// writes, using io_uring. Runs are split into I/Os of up to 256 KiB. A depth of 0, the
+// default for file and direct stores, uses synchronous pread/pwrite instead.
+// Returns STORE_NOT_SUPPORTED for other store types or if io_uring is not available.
+int store_set_queue_depth(store_t *store, uint32_t queue_depth);
+
+// Freezes blocks [start_block, start_block + block_count) of source as a new read-only
+// store in *snapshot, so they can still be read after source wraps around over them. The
+// blocks keep their ids, the snapshot has a write offset of start_block + block_count.
+// Memory stores are copied on write: the snapshot holds the source in use, and the source
+// copies a block into the snapshot just before overwriting it. File and mmap stores are
+// cloned to filepath, sharing the blocks where the file system supports reflinks.
+// Returns STORE_NOT_FOUND if the blocks are not all in source, and STORE_NOT_SUPPORTED
+// for other store types.
+int store_snapshot(store_t *source, const char *filepath, uint32_t start_block, uint32_t block_count,
+                   store_t **snapshot);
+
+// Compresses blocks written from now on with a BLOCK_CODEC_x codec, blocks that do not
+// compress are stored as they are. Reads always return decompressed blocks. File backed
+// stores give the space saved back to the file system by punching holes in the file.
+// Returns STORE_NOT_SUPPORTED for unknown codecs.
+int store_set_codec(store_t *store, int codec);
+
+// Checks the CRC of every block read from now on. Reads of blocks that do not match
+// return STORE_BAD_CRC and the blocks are recorded as bad blocks.
+void store_set_verify(store_t *store, bool verify);
+
+// Starts a low priority thread that reads the whole store over and over, at most
+// blocks_per_second blocks per second, and records the blocks that fail their CRC check as
+// bad blocks. A rate of 0 stops it. Returns STORE_NOT_SUPPORTED for memory stores.
+int store_set_scrub_rate(store_t *store, uint32_t blocks_per_second);
+
+// True if the block at block_offset failed its CRC check since it was last written
+bool store_is_bad_block(store_t *store, uint32_t block_offset);
+
+// Sets when written blocks reach the disk: STORE_DURABILITY_NONE leaves it to the kernel,
+// STORE_DURABILITY_SYNC syncs before every write returns, and STORE_DURABILITY_PERIODIC
+// syncs every interval_ms milliseconds, or as soon as blocks blocks were written if
+// blocks is not 0. Returns STORE_NOT_SUPPORTED for memory stores.
+int store_set_durability(store_t *store, int durability, uint32_t interval_ms, uint32_t blocks);
+
+// Queues up to blocks appended blocks in memory and writes them to disk with a single write,
+// when the queue is full or at the next commit. 0 writes every append right away.
+// Returns STORE_NOT_SUPPORTED for memory, mmap and tiered stores.
+int store_set_ingest_queue(store_t *store, uint32_t blocks);
+uint32_t store_ingest_queue_blocks(store_t *store);
+
+// Writes out the ingest queue and syncs the store files, whatever the durability mode.
+// Memory stores with a snapshot file write their snapshot.
+int store_sync(store_t *store);
+
+// Memory reserved by a memory or mmap store and how much of it is resident, other stores
+// return STORE_NOT_SUPPORTED.
+int store_memory_usage(store_t *store, uint64_t *reserved, uint64_t *resident);
+
+// True for the block sizes stores support
+bool store_valid_block_size(uint32_t block_size);
+
+// Allocates buffers for count blocks of the store, aligned for direct I/O, release them
+// with free(). All block arrays passed to a store hold blocks of store->block_size bytes,
+// index them with store_block.
+block_t* store_alloc_blocks(store_t *store, uint32_t count);
+
+static inline block_t* store_block(const store_t *store, const block_t *blocks, uint32_t index) {
+    return (block_t *)((uint8_t *)blocks + (size_t)index * store->block_size);
+}
 
 int store_read_block(store_t *store, block_t *output, uint32_t block_offset);
+
+// Reads count consecutive blocks, wrapping around the end of the store, with one read per
+// contiguous run. Blocks that were never written read back as zeros.
+int store_read_blocks(store_t *store, block_t *output, uint32_t block_offset, uint32_t count);
+
+// Zero-copy read: points *output at the block inside the store itself.
+// Only memory and mmap stores can do this, other store types and compressed blocks return
+// STORE_NOT_MAPPED.
+// The block is only valid until it is overwritten or the store is freed, and is not
+// protected by the store lock.
+int store_map_block(store_t *store, const block_t **output, uint32_t block_offset);
 int store_write_block(store_t *store, block_t *input, int32_t block_offset);
 
+// Writes count consecutive blocks, the batched version of store_write_block.
+int store_write_blocks(store_t *store, block_t *input, int32_t block_offset, uint32_t count);
+
+// Moves write_offset forward to the first block after it that has not been written yet,
+// using the block headers. Used after a restart, when the saved write offset may be behind.
+int store_find_head(store_t *store);
+
+// Finds the block covering time_ns (nanoseconds since the Unix epoch): the newest block
+// with a timestamp at or before it, or the oldest block in the store if the time is older
+// than that. Assumes block timestamps do not go backwards as blocks are appended.
+// Returns STORE_NOT_FOUND if nothing has been written yet.
+int store_find_time(store_t *store, uint64_t time_ns, uint32_t *block_offset);
+
+// Conditions on block headers for store_query_blocks, blocks have to match all that are set
+typedef struct {
+    bool match_source_id;
+    uint16_t source_id;
+    bool match_block_type;
+    uint16_t block_type;
+
+    // Inclusive ranges of the sample block header fields
+    bool match_frequency;
+    float min_frequency;
+    float max_frequency;
+    bool match_sample_rate;
+    uint32_t min_sample_rate;
+    uint32_t max_sample_rate;
+
+    // Blocks covering [start_time_ns, end_time_ns), 0 leaves that end open
+    uint64_t start_time_ns;
+    uint64_t end_time_ns;
+
+    // Inclusive range of block_stats_t.mean_power
+    bool match_power;
+    float min_power;
+    float max_power;
+} store_query_t;
+
+typedef struct {
+    uint32_t start_block;
+    uint32_t block_count;
+} store_run_t;
+
+// Finds the blocks matching query with the header index, without reading them, as runs of
+// consecutive block ids. Searches from block id from, or the oldest block in the store,
+// up to the write offset. Stops before a run that does not fit in max_runs, *next is then
+// the block id to continue from, otherwise the write offset.
+int store_query_blocks(store_t *store, const store_query_t *query, uint32_t from, store_run_t *runs, uint32_t max_runs,
+                       uint32_t *run_count, uint32_t *next);
+
+// Reads the summaries of up to max_count * stride blocks from block id *from on, or the
+// oldest block in the store, up to the write offset. Each entry summarizes stride blocks:
+// power and DC offset are averaged, peaks are the highest and clips are added up. *from is
+// set to the first block and *count to the number of entries. Returns STORE_NOT_FOUND if
+// there are no blocks from *from on.
+int store_block_stats(store_t *store, uint32_t *from, uint32_t stride, block_stats_t *stats, uint32_t max_count,
+                      uint32_t *count);
+
 void free_store(store_t *store);
 
 typedef bool (*iterate_stores_callback)(void *context, const char *name, const char *path, store_t *store);
@@ -44,7 +270,11 @@ typedef bool (*iterate_stores_callback)(void *context, const char *name, const c
 int add_store(const char *name, const char *path, store_list_t *list, store_t *store);
 int remove_store(const char *name, const char *path, store_list_t *list);
 store_t* find_store(const char *name, const char *path, store_list_t *list);
+// Visits the stores in path and below it (all stores for an empty path) in (path, name) order
 void iterate_store_list(const char *path, store_list_t *list, iterate_stores_callback cb, void *context);
+// Same, but continues a listing after the store (after_path, after_name)
+void iterate_store_list_after(const char *path, const char *after_path, const char *after_name, store_list_t *list,
+                              iterate_stores_callback cb, void *context);
 void free_store_list(store_list_t *list);
 
 void store_use(store_t *store);
@@ -16,8 +16,14 @@
 struct stream_base {
     int (*read)(struct stream_base *stream, float *output, int count);
     void (*seek)(struct stream_base *stream, uint32_t offset);
+
+    // Finds the seek offset of the block covering time_ns, returns false if the stream
+    // has no timestamps.
+    bool (*find_time)(struct stream_base *stream, uint64_t time_ns, uint32_t *offset);
+
     void (*cleanup)(struct stream_base *stream);
 
+    // Samples (floats) read since the start of the stream
     int64_t offset;
 
     // end of stream
@@ -31,7 +37,11 @@ typedef bool (*iterate_streams_callback)(void *context, const char *name, const
 int add_stream(const char *name, const char *path, stream_list_t *list, stream_t *stream);
 int remove_stream(const char *name, const char *path, stream_list_t *list);
 stream_t* find_stream(const char *name, const char *path, stream_list_t *list);
+// Visits the streams in path and below it (all streams for an empty path) in (path, name) order
 void iterate_stream_list(const char *path, stream_list_t *list, iterate_streams_callback cb, void *context);
+// Same, but continues a listing after the stream (after_path, after_name)
+void iterate_stream_list_after(const char *path, const char *after_path, const char *after_name, stream_list_t *list,
+                               iterate_streams_callback cb, void *context);
 void free_stream_list(stream_list_t *list);
 
 void read_samples_from_stream(stream_t *stream, float *output, int count);
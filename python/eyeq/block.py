@@ -3,6 +3,7 @@ import struct
 from collections import namedtuple
 
 BLOCK_LENGTH = 16384
+BLOCK_MAX_LENGTH = 1 << 20
 BLOCK_HEADER_LENGTH = 128
 
 SAMPLE_DATA_PER_BLOCK = BLOCK_LENGTH - BLOCK_HEADER_LENGTH
@@ -24,6 +25,9 @@ class BlockHeader:
     HEADER_PACK_STRING = "<IiHHIIIH"
     HEADER_LENGTH = 4 + 4 + 2 + 2 + 4 + 4 + 4 + 2
 
+    # High 16 bits of block_length, for blocks over 64 KiB
+    LENGTH_HIGH_OFFSET = 42
+
     def __init__(self, block_type, source_id=0):
         self.block_id = -1
         self.block_type = block_type
@@ -39,16 +43,17 @@ class BlockHeader:
 
     def pack(self):
         # CRC is written by backend - should be set to 0 here.
-        hdr = struct.pack(BlockHeader.HEADER_PACK_STRING, BLOCK_MAGIC, self.block_id, self.block_type, self.block_length, self.crc32, self.timestamp_sec, self.timestamp_nsec, self.source_id)
-        hdr += b'\0' * (BLOCK_HEADER_LENGTH - len(hdr))
-        return hdr
+        hdr = bytearray(BLOCK_HEADER_LENGTH)
+        struct.pack_into(BlockHeader.HEADER_PACK_STRING, hdr, 0, BLOCK_MAGIC, self.block_id, self.block_type, self.block_length & 0xffff, self.crc32, self.timestamp_sec, self.timestamp_nsec, self.source_id)
+        struct.pack_into("<H", hdr, BlockHeader.LENGTH_HIGH_OFFSET, self.block_length >> 16)
+        return bytes(hdr)
 
     def parse(data):
-        t = struct.unpack(BlockHeader.HEADER_PACK_STRING, data)
+        t = struct.unpack_from(BlockHeader.HEADER_PACK_STRING, data)
         assert t[0] == BLOCK_MAGIC
         hdr = BlockHeader(t[2])
         hdr.block_id = t[1]
-        hdr.block_length = t[3]
+        hdr.block_length = t[3] | struct.unpack_from("<H", data, BlockHeader.LENGTH_HIGH_OFFSET)[0] << 16
         hdr.crc32 = t[4]
         hdr.timestamp_sec = t[5]
         hdr.timestamp_nsec = t[6]
@@ -60,8 +65,8 @@ class BlockHeader:
 
 def parse_block(data):
     block = Block()
-    block.header = BlockHeader.parse(data[:BlockHeader.HEADER_LENGTH])
-    block.init_block_data(data[BLOCK_HEADER_LENGTH:block.header.block_length])
+    block.header = BlockHeader.parse(data[:BLOCK_HEADER_LENGTH])
+    block.init_block_data(data[BLOCK_HEADER_LENGTH:block.header.block_length], max(len(data), BLOCK_LENGTH))
     return block
 
 class Block:
@@ -70,12 +75,13 @@ class Block:
         self.count = 0
         self.max_count = 0
 
-    def create(block_type, timestamp=None, data=None, source_id=0):
+    def create(block_type, timestamp=None, data=None, source_id=0, block_size=BLOCK_LENGTH):
+        # block_size should be the block size of the store the block is written to
         block = Block()
         block.header = BlockHeader(block_type, source_id)
         if timestamp:
             block.header.set_time(timestamp)
-        block.init_block_data(data)
+        block.init_block_data(data, block_size)
         return block
 
     def append(self, value):
@@ -84,22 +90,18 @@ class Block:
         self.data[self.count] = value
         self.count += 1
 
-    def init_block_data(self, data=None):
+    def init_block_data(self, data=None, block_size=BLOCK_LENGTH):
         if self.header.block_type == BLOCK_TYPE_BYTES:
             self.dtype = np.int8
-            self.max_count = BLOCK_I8_SAMPLES
         elif self.header.block_type == BLOCK_TYPE_I16_SAMPLES:
             self.dtype = np.int16
-            self.max_count = BLOCK_I16_SAMPLES
         elif self.header.block_type == BLOCK_TYPE_I8_SAMPLES:
             self.dtype = np.int8
-            self.max_count = BLOCK_I8_SAMPLES
         elif self.header.block_type == BLOCK_TYPE_F32_SAMPLES:
             self.dtype = np.float32
-            self.max_count = BLOCK_F32_SAMPLES
         elif self.header.block_type == BLOCK_TYPE_F64_SAMPLES:
             self.dtype = np.float64
-            self.max_count = BLOCK_F64_SAMPLES
+        self.max_count = (block_size - BLOCK_HEADER_LENGTH) // np.dtype(self.dtype).itemsize
         self.data = np.zeros(self.max_count, dtype=self.dtype)
         if not data is None:
             if isinstance(data, bytes):
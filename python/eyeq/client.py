@@ -7,6 +7,10 @@ import numpy as np
 class TransactionError(Exception):
     pass
 
+def set_timestamp(ts, timestamp):
+    ts.sec = int(timestamp)
+    ts.nsec = int((timestamp % 1) * 1e9)
+
 class Client:
     ''"Client is a client connection to the eyeq server."""
     
@@ -60,7 +64,7 @@ class Client:
         for response in self.receive_responses(number=expected_responses, timeout=timeout):
             yield response
 
-    def create_store(self, name, block_count, path='', store_type = samples.StoreType.MEMORY_STORE, file_path=''):
+    def create_store(self, name, block_count, path='', store_type = samples.StoreType.MEMORY_STORE, file_path='', codec = samples.StoreCodec.NO_CODEC, hot_block_count=0, verify_crc=False, scrub_rate=0, durability=samples.StoreDurability.DURABILITY_NONE, sync_interval_ms=0, sync_blocks=0, ingest_queue_blocks=0, hugepages=False, numa_node=None, block_size=0):
         request = samples.ServerRequest()
         cs = samples.CreateStore()
         cs.store.name = name
@@ -68,6 +72,19 @@ class Client:
         cs.store.block_count = block_count
         cs.store.store_type = store_type
         cs.store.file_path = file_path
+        cs.store.codec = codec
+        cs.store.hot_block_count = hot_block_count
+        cs.store.verify_crc = verify_crc
+        cs.store.scrub_rate = scrub_rate
+        cs.store.durability = durability
+        cs.store.sync_interval_ms = sync_interval_ms
+        cs.store.sync_blocks = sync_blocks
+        cs.store.ingest_queue_blocks = ingest_queue_blocks
+        cs.store.hugepages = hugepages
+        cs.store.block_size = block_size
+        if numa_node is not None:
+            cs.store.numa_bind = True
+            cs.store.numa_node = numa_node
         request.create_store.CopyFrom(cs)
         self.transaction(request).create_store_response
         return Store(self, name, path)
@@ -78,10 +95,14 @@ class Client:
     def stream(self, name, path):
         return Stream(self, name, path)
 
-    def list_stores(self, path=''):
+    def list_stores(self, path='', after_path='', after_name=''):
+        # Returns one page, pass next_path and next_name of the response as after_path and
+        # after_name to get the next one
         request = samples.ServerRequest()
         ls = samples.ListStores()
         ls.path = path
+        ls.after_path = after_path
+        ls.after_name = after_name
         request.list_stores.CopyFrom(ls)
         return self.transaction(request).list_stores_response
 
@@ -93,6 +114,19 @@ class Client:
         request.delete_store.CopyFrom(ds)
         return self.transaction(request).delete_store_response
 
+    def snapshot_store(self, name, snapshot_name, start_block, block_count, path='', snapshot_path=None, file_path=''):
+        request = samples.ServerRequest()
+        ss = samples.SnapshotStore()
+        ss.name = name
+        ss.path = path
+        ss.snapshot_name = snapshot_name
+        ss.snapshot_path = path if snapshot_path is None else snapshot_path
+        ss.file_path = file_path
+        ss.start_block = start_block
+        ss.block_count = block_count
+        request.snapshot_store.CopyFrom(ss)
+        return self.transaction(request).snapshot_store_response
+
     def flush_stores(self):
         request = samples.ServerRequest()
         fs = samples.FlushStores()
@@ -133,13 +167,74 @@ class Client:
         response = self.transaction(request).read_blocks_response
         return block.parse_block(response.block.data)
 
-    def read_blocks(self, name, offset, path='', count=1, timeout=10000):
+    def query_blocks(self, name, path='', source_id=None, block_type=None, frequency=None, sample_rate=None, start_time=None, end_time=None, power_db=None):
+        """ Returns (start_block, block_count) runs of the blocks whose headers match all given conditions.
+        frequency, sample_rate and power_db (mean power in dBFS) are inclusive (min, max) ranges, times
+        are Unix times in seconds. """
+        request = samples.ServerRequest()
+        qb = samples.QueryBlocks()
+        qb.name = name
+        qb.path = path
+        if source_id is not None:
+            qb.match_source_id = True
+            qb.source_id = source_id
+        if block_type is not None:
+            qb.match_block_type = True
+            qb.block_type = block_type
+        if frequency is not None:
+            qb.match_frequency = True
+            qb.min_frequency, qb.max_frequency = frequency
+        if sample_rate is not None:
+            qb.match_sample_rate = True
+            qb.min_sample_rate, qb.max_sample_rate = sample_rate
+        if power_db is not None:
+            qb.match_power = True
+            qb.min_power_db, qb.max_power_db = power_db
+        if start_time is not None:
+            set_timestamp(qb.start_time, start_time)
+        if end_time is not None:
+            set_timestamp(qb.end_time, end_time)
+
+        runs = []
+        while True:
+            request.query_blocks.CopyFrom(qb)
+            response = self.transaction(request).query_blocks_response
+            runs.extend((run.start_block, run.block_count) for run in response.runs)
+            if not response.more:
+                return runs
+            qb.start_block = response.next_block
+
+    def block_stats(self, name, path='', start_block=0, stride=1):
+        """ Summaries of up to 1024 entries of stride blocks each from start_block on: mean power and
+        peak magnitude relative to full scale (10 * log10(mean_power) is in dBFS), DC offset and clipped samples """
+        request = samples.ServerRequest()
+        bs = samples.BlockStats()
+        bs.name = name
+        bs.path = path
+        bs.start_block = start_block
+        bs.stride = stride
+        request.block_stats.CopyFrom(bs)
+        response = self.transaction(request).block_stats_response
+        return {
+            'start_block': response.start_block,
+            'stride': response.stride,
+            'mean_power': np.array(response.mean_power),
+            'peak_magnitude': np.array(response.peak_magnitude),
+            'dc_i': np.array(response.dc_i),
+            'dc_q': np.array(response.dc_q),
+            'clip_count': np.array(response.clip_count),
+        }
+
+    def read_blocks(self, name, offset, path='', count=1, timeout=10000, timestamp=None):
+        """ Reads count blocks from offset, or from the block covering timestamp (Unix time in seconds) if given """
         request = samples.ServerRequest()
         rb = samples.ReadBlocks()
         rb.name = name
         rb.path = path
         rb.offset = offset
         rb.count = count
+        if timestamp is not None:
+            set_timestamp(rb.time, timestamp)
         request.read_blocks.CopyFrom(rb)
         number_of_blocks = 0
         for response in self.multi_transaction([request], expected_responses=count, timeout=timeout):
@@ -168,12 +263,15 @@ class Client:
         self.transaction(request).create_stream_response
         return Stream(self, name, path)
 
-    def seek_stream(self, name, block_id=0, path=''):
+    def seek_stream(self, name, block_id=0, path='', timestamp=None):
+        """ Seeks to block_id, or to the block covering timestamp (Unix time in seconds) if given """
         request = samples.ServerRequest()
         ss = samples.SeekStream()
         ss.name = name
         ss.path = path
         ss.block_id = block_id
+        if timestamp is not None:
+            set_timestamp(ss.time, timestamp)
         request.seek_stream.CopyFrom(ss)
         response = self.transaction(request).seek_stream_response
         return response
@@ -198,10 +296,14 @@ class Client:
                 break
         return result
 
-    def list_streams(self, path=''):
+    def list_streams(self, path='', after_path='', after_name=''):
+        # Returns one page, pass next_path and next_name of the response as after_path and
+        # after_name to get the next one
         request = samples.ServerRequest()
         ls = samples.ListStreams()
         ls.path = path
+        ls.after_path = after_path
+        ls.after_name = after_name
         request.list_streams.CopyFrom(ls)
         return self.transaction(request).list_streams_response
 
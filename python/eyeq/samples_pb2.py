@@ -2,10 +2,9 @@
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
 # source: samples.proto
 """Generated protocol buffer code."""
-from google.protobuf.internal import enum_type_wrapper
+from google.protobuf.internal import builder as _builder
 from google.protobuf import descriptor as _descriptor
-from google.protobuf import message as _message
-from google.protobuf import reflection as _reflection
+from google.protobuf import descriptor_pool as _descriptor_pool
 from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
@@ -14,2115 +13,105 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor.FileDescriptor(
-  name='samples.proto',
-  package='eyeq',
-  syntax='proto3',
-  serialized_options=None,
-  create_key=_descriptor._internal_create_key,
-  serialized_pb=b'\n\rsamples.proto\x12\x04\x65yeq\"\xa0\x04\n\rServerRequest\x12\x0e\n\x06req_id\x18\x07 \x01(\r\x12)\n\x0c\x63reate_store\x18\x01 \x01(\x0b\x32\x11.eyeq.CreateStoreH\x00\x12\'\n\x0blist_stores\x18\x02 \x01(\x0b\x32\x10.eyeq.ListStoresH\x00\x12)\n\x0c\x64\x65lete_store\x18\x03 \x01(\x0b\x32\x11.eyeq.DeleteStoreH\x00\x12\'\n\x0bwrite_block\x18\x04 \x01(\x0b\x32\x10.eyeq.WriteBlockH\x00\x12\'\n\x0bread_blocks\x18\x05 \x01(\x0b\x32\x10.eyeq.ReadBlocksH\x00\x12)\n\x0c\x66lush_stores\x18\x06 \x01(\x0b\x32\x11.eyeq.FlushStoresH\x00\x12+\n\rcreate_stream\x18\x08 \x01(\x0b\x32\x12.eyeq.CreateStreamH\x00\x12\'\n\x0bread_stream\x18\t \x01(\x0b\x32\x10.eyeq.ReadStreamH\x00\x12\'\n\x0bseek_stream\x18\n \x01(\x0b\x32\x10.eyeq.SeekStreamH\x00\x12)\n\x0c\x63lose_stream\x18\x0b \x01(\x0b\x32\x11.eyeq.CloseStreamH\x00\x12\'\n\x0bstream_info\x18\x0c \x01(\x0b\x32\x10.eyeq.StreamInfoH\x00\x12)\n\x0clist_streams\x18\r \x01(\x0b\x32\x11.eyeq.ListStreamsH\x00\x42\x05\n\x03req\"\x89\x06\n\x0eServerResponse\x12\r\n\x05\x65rror\x18\x01 \x01(\t\x12\x0e\n\x06req_id\x18\x08 \x01(\r\x12;\n\x15\x63reate_store_response\x18\x02 \x01(\x0b\x32\x1a.eyeq.CreateStore.ResponseH\x00\x12\x39\n\x14list_stores_response\x18\x03 \x01(\x0b\x32\x19.eyeq.ListStores.ResponseH\x00\x12;\n\x15\x64\x65lete_store_response\x18\x04 \x01(\x0b\x32\x1a.eyeq.DeleteStore.ResponseH\x00\x12\x39\n\x14write_block_response\x18\x05 \x01(\x0b\x32\x19.eyeq.WriteBlock.ResponseH\x00\x12\x39\n\x14read_blocks_response\x18\x06 \x01(\x0b\x32\x19.eyeq.ReadBlocks.ResponseH\x00\x12;\n\x15\x66lush_stores_response\x18\x07 \x01(\x0b\x32\x1a.eyeq.FlushStores.ResponseH\x00\x12=\n\x16\x63reate_stream_response\x18\t \x01(\x0b\x32\x1b.eyeq.CreateStream.ResponseH\x00\x12\x39\n\x14read_stream_response\x18\n \x01(\x0b\x32\x19.eyeq.ReadStream.ResponseH\x00\x12\x39\n\x14seek_stream_response\x18\x0b \x01(\x0b\x32\x19.eyeq.SeekStream.ResponseH\x00\x12;\n\x15\x63lose_stream_response\x18\x0c \x01(\x0b\x32\x1a.eyeq.CloseStream.ResponseH\x00\x12\x39\n\x14stream_info_response\x18\r \x01(\x0b\x32\x19.eyeq.StreamInfo.ResponseH\x00\x12;\n\x15list_streams_response\x18\x0e \x01(\x0b\x32\x1a.eyeq.ListStreams.ResponseH\x00\x42\x06\n\x04resp\"\x86\x01\n\x05Store\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12#\n\nstore_type\x18\x03 \x01(\x0e\x32\x0f.eyeq.StoreType\x12\x13\n\x0b\x62lock_count\x18\x04 \x01(\r\x12\x14\n\x0c\x62lock_offset\x18\x05 \x01(\r\x12\x11\n\tfile_path\x18\x06 \x01(\t\"Q\n\x0b\x43reateStore\x12\x1a\n\x05store\x18\x01 \x01(\x0b\x32\x0b.eyeq.Store\x1a&\n\x08Response\x12\x1a\n\x05store\x18\x01 \x01(\x0b\x32\x0b.eyeq.Store\"C\n\nListStores\x12\x0c\n\x04path\x18\x01 \x01(\t\x1a\'\n\x08Response\x12\x1b\n\x06stores\x18\x01 \x03(\x0b\x32\x0b.eyeq.Store\"F\n\x0b\x44\x65leteStore\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x1a\x1b\n\x08Response\x12\x0f\n\x07success\x18\x01 \x01(\x08\"*\n\x0b\x46lushStores\x1a\x1b\n\x08Response\x12\x0f\n\x07success\x18\x01 \x01(\x08\"&\n\tTimestamp\x12\x0b\n\x03sec\x18\x01 \x01(\x04\x12\x0c\n\x04nsec\x18\x02 \x01(\x04\"\x15\n\x05\x42lock\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\"p\n\nWriteBlock\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x0e\n\x06offset\x18\x03 \x01(\x05\x12\x1a\n\x05\x62lock\x18\x04 \x01(\x0b\x32\x0b.eyeq.Block\x1a\x1a\n\x08Response\x12\x0e\n\x06offset\x18\x01 \x01(\r\"o\n\nReadBlocks\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x0e\n\x06offset\x18\x03 \x01(\r\x12\r\n\x05\x63ount\x18\x04 \x01(\r\x1a&\n\x08Response\x12\x1a\n\x05\x62lock\x18\x01 \x01(\x0b\x32\x0b.eyeq.Block\"W\n\x11StoreReaderStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x13\n\x0bstart_block\x18\x03 \x01(\r\x12\x11\n\tend_block\x18\x04 \x01(\r\"E\n\x18\x46requencyTranslateStream\x12\x1a\n\x12relative_frequency\x18\x01 \x01(\x02\x12\r\n\x05phase\x18\x02 \x01(\x02\"E\n\x13\x43onstMultiplyStream\x12\x12\n\nis_complex\x18\x01 \x01(\x08\x12\x0c\n\x04real\x18\x02 \x01(\x02\x12\x0c\n\x04imag\x18\x03 \x01(\x02\":\n\x0f\x46irFilterStream\x12\x12\n\nis_complex\x18\x01 \x01(\x08\x12\x13\n\x0b\x66ilter_taps\x18\x02 \x03(\x02\"\x0b\n\tAbsStream\"\x1d\n\tLogStream\x12\x10\n\x08log_base\x18\x01 \x01(\x02\"\xb6\x02\n\x0bStreamLayer\x12/\n\x0cstore_reader\x18\x06 \x01(\x0b\x32\x17.eyeq.StoreReaderStreamH\x00\x12=\n\x13\x66requency_translate\x18\x01 \x01(\x0b\x32\x1e.eyeq.FrequencyTranslateStreamH\x00\x12\x33\n\x0e\x63onst_multiply\x18\x02 \x01(\x0b\x32\x19.eyeq.ConstMultiplyStreamH\x00\x12+\n\nfir_filter\x18\x03 \x01(\x0b\x32\x15.eyeq.FirFilterStreamH\x00\x12%\n\nabs_stream\x18\x04 \x01(\x0b\x32\x0f.eyeq.AbsStreamH\x00\x12%\n\nlog_stream\x18\x05 \x01(\x0b\x32\x0f.eyeq.LogStreamH\x00\x42\x07\n\x05layer\">\n\x06Stream\x12\x0c\n\x04path\x18\x01 \x01(\t\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x18\n\x10lifetime_seconds\x18\x03 \x01(\r\"y\n\x0c\x43reateStream\x12\x1c\n\x06stream\x18\x01 \x01(\x0b\x32\x0c.eyeq.Stream\x12!\n\x06layers\x18\x02 \x03(\x0b\x32\x11.eyeq.StreamLayer\x1a(\n\x08Response\x12\x1c\n\x06stream\x18\x02 \x01(\x0b\x32\x0c.eyeq.Stream\"\x94\x01\n\nReadStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x14\n\x0csample_count\x18\x03 \x01(\r\x1aT\n\x08Response\x12\r\n\x05\x62lock\x18\x01 \x01(\r\x12\x1b\n\x02ts\x18\x02 \x01(\x0b\x32\x0f.eyeq.Timestamp\x12\x0f\n\x07samples\x18\x03 \x03(\x02\x12\x0b\n\x03\x65os\x18\x04 \x01(\x08\"j\n\nSeekStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x10\n\x08\x62lock_id\x18\x03 \x01(\r\x1a.\n\x08Response\x12\x15\n\rsample_offset\x18\x01 \x01(\x04\x12\x0b\n\x03\x65os\x18\x02 \x01(\x08\"5\n\x0b\x43loseStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x1a\n\n\x08Response\"\x88\x01\n\nStreamInfo\x12\x0c\n\x04path\x18\x01 \x01(\t\x12\x0c\n\x04name\x18\x02 \x01(\t\x1a^\n\x08Response\x12\x1c\n\x06stream\x18\x01 \x01(\x0b\x32\x0c.eyeq.Stream\x12\x10\n\x08\x62lock_id\x18\x02 \x01(\r\x12\x15\n\rsample_offset\x18\x03 \x01(\x04\x12\x0b\n\x03\x65os\x18\x04 \x01(\x08\"F\n\x0bListStreams\x12\x0c\n\x04path\x18\x01 \x01(\t\x1a)\n\x08Response\x12\x1d\n\x07streams\x18\x01 \x03(\x0b\x32\x0c.eyeq.Stream*-\n\tStoreType\x12\x10\n\x0cMEMORY_STORE\x10\x00\x12\x0e\n\nFILE_STORE\x10\x01\x62\x06proto3'
-)
-
-_STORETYPE = _descriptor.EnumDescriptor(
-  name='StoreType',
-  full_name='eyeq.StoreType',
-  filename=None,
-  file=DESCRIPTOR,
-  create_key=_descriptor._internal_create_key,
-  values=[
-    _descriptor.EnumValueDescriptor(
-      name='MEMORY_STORE', index=0, number=0,
-      serialized_options=None,
-      type=None,
-      create_key=_descriptor._internal_create_key),
-    _descriptor.EnumValueDescriptor(
-      name='FILE_STORE', index=1, number=1,
-      serialized_options=None,
-      type=None,
-      create_key=_descriptor._internal_create_key),
-  ],
-  containing_type=None,
-  serialized_options=None,
-  serialized_start=3405,
-  serialized_end=3450,
-)
-_sym_db.RegisterEnumDescriptor(_STORETYPE)
-
-StoreType = enum_type_wrapper.EnumTypeWrapper(_STORETYPE)
-MEMORY_STORE = 0
-FILE_STORE = 1
-
-
-
-_SERVERREQUEST = _descriptor.Descriptor(
-  name='ServerRequest',
-  full_name='eyeq.ServerRequest',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='req_id', full_name='eyeq.ServerRequest.req_id', index=0,
-      number=7, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='create_store', full_name='eyeq.ServerRequest.create_store', index=1,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='list_stores', full_name='eyeq.ServerRequest.list_stores', index=2,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='delete_store', full_name='eyeq.ServerRequest.delete_store', index=3,
-      number=3, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='write_block', full_name='eyeq.ServerRequest.write_block', index=4,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='read_blocks', full_name='eyeq.ServerRequest.read_blocks', index=5,
-      number=5, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='flush_stores', full_name='eyeq.ServerRequest.flush_stores', index=6,
-      number=6, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='create_stream', full_name='eyeq.ServerRequest.create_stream', index=7,
-      number=8, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='read_stream', full_name='eyeq.ServerRequest.read_stream', index=8,
-      number=9, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='seek_stream', full_name='eyeq.ServerRequest.seek_stream', index=9,
-      number=10, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='close_stream', full_name='eyeq.ServerRequest.close_stream', index=10,
-      number=11, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='stream_info', full_name='eyeq.ServerRequest.stream_info', index=11,
-      number=12, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='list_streams', full_name='eyeq.ServerRequest.list_streams', index=12,
-      number=13, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-    _descriptor.OneofDescriptor(
-      name='req', full_name='eyeq.ServerRequest.req',
-      index=0, containing_type=None,
-      create_key=_descriptor._internal_create_key,
-    fields=[]),
-  ],
-  serialized_start=24,
-  serialized_end=568,
-)
-
-
-_SERVERRESPONSE = _descriptor.Descriptor(
-  name='ServerResponse',
-  full_name='eyeq.ServerResponse',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='error', full_name='eyeq.ServerResponse.error', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='req_id', full_name='eyeq.ServerResponse.req_id', index=1,
-      number=8, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='create_store_response', full_name='eyeq.ServerResponse.create_store_response', index=2,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='list_stores_response', full_name='eyeq.ServerResponse.list_stores_response', index=3,
-      number=3, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='delete_store_response', full_name='eyeq.ServerResponse.delete_store_response', index=4,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='write_block_response', full_name='eyeq.ServerResponse.write_block_response', index=5,
-      number=5, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='read_blocks_response', full_name='eyeq.ServerResponse.read_blocks_response', index=6,
-      number=6, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='flush_stores_response', full_name='eyeq.ServerResponse.flush_stores_response', index=7,
-      number=7, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='create_stream_response', full_name='eyeq.ServerResponse.create_stream_response', index=8,
-      number=9, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='read_stream_response', full_name='eyeq.ServerResponse.read_stream_response', index=9,
-      number=10, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='seek_stream_response', full_name='eyeq.ServerResponse.seek_stream_response', index=10,
-      number=11, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='close_stream_response', full_name='eyeq.ServerResponse.close_stream_response', index=11,
-      number=12, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='stream_info_response', full_name='eyeq.ServerResponse.stream_info_response', index=12,
-      number=13, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='list_streams_response', full_name='eyeq.ServerResponse.list_streams_response', index=13,
-      number=14, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-    _descriptor.OneofDescriptor(
-      name='resp', full_name='eyeq.ServerResponse.resp',
-      index=0, containing_type=None,
-      create_key=_descriptor._internal_create_key,
-    fields=[]),
-  ],
-  serialized_start=571,
-  serialized_end=1348,
-)
-
-
-_STORE = _descriptor.Descriptor(
-  name='Store',
-  full_name='eyeq.Store',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.Store.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.Store.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='store_type', full_name='eyeq.Store.store_type', index=2,
-      number=3, type=14, cpp_type=8, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='block_count', full_name='eyeq.Store.block_count', index=3,
-      number=4, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='block_offset', full_name='eyeq.Store.block_offset', index=4,
-      number=5, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='file_path', full_name='eyeq.Store.file_path', index=5,
-      number=6, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1351,
-  serialized_end=1485,
-)
-
-
-_CREATESTORE_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.CreateStore.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='store', full_name='eyeq.CreateStore.Response.store', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1530,
-  serialized_end=1568,
-)
-
-_CREATESTORE = _descriptor.Descriptor(
-  name='CreateStore',
-  full_name='eyeq.CreateStore',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='store', full_name='eyeq.CreateStore.store', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_CREATESTORE_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1487,
-  serialized_end=1568,
-)
-
-
-_LISTSTORES_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.ListStores.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='stores', full_name='eyeq.ListStores.Response.stores', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1598,
-  serialized_end=1637,
-)
-
-_LISTSTORES = _descriptor.Descriptor(
-  name='ListStores',
-  full_name='eyeq.ListStores',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.ListStores.path', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_LISTSTORES_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1570,
-  serialized_end=1637,
-)
-
-
-_DELETESTORE_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.DeleteStore.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='success', full_name='eyeq.DeleteStore.Response.success', index=0,
-      number=1, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1682,
-  serialized_end=1709,
-)
-
-_DELETESTORE = _descriptor.Descriptor(
-  name='DeleteStore',
-  full_name='eyeq.DeleteStore',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.DeleteStore.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.DeleteStore.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_DELETESTORE_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1639,
-  serialized_end=1709,
-)
-
-
-_FLUSHSTORES_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.FlushStores.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='success', full_name='eyeq.FlushStores.Response.success', index=0,
-      number=1, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1682,
-  serialized_end=1709,
-)
-
-_FLUSHSTORES = _descriptor.Descriptor(
-  name='FlushStores',
-  full_name='eyeq.FlushStores',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-  ],
-  extensions=[
-  ],
-  nested_types=[_FLUSHSTORES_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1711,
-  serialized_end=1753,
-)
-
-
-_TIMESTAMP = _descriptor.Descriptor(
-  name='Timestamp',
-  full_name='eyeq.Timestamp',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='sec', full_name='eyeq.Timestamp.sec', index=0,
-      number=1, type=4, cpp_type=4, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='nsec', full_name='eyeq.Timestamp.nsec', index=1,
-      number=2, type=4, cpp_type=4, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1755,
-  serialized_end=1793,
-)
-
-
-_BLOCK = _descriptor.Descriptor(
-  name='Block',
-  full_name='eyeq.Block',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='data', full_name='eyeq.Block.data', index=0,
-      number=1, type=12, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"",
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1795,
-  serialized_end=1816,
-)
-
-
-_WRITEBLOCK_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.WriteBlock.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='offset', full_name='eyeq.WriteBlock.Response.offset', index=0,
-      number=1, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1904,
-  serialized_end=1930,
-)
-
-_WRITEBLOCK = _descriptor.Descriptor(
-  name='WriteBlock',
-  full_name='eyeq.WriteBlock',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.WriteBlock.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.WriteBlock.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='offset', full_name='eyeq.WriteBlock.offset', index=2,
-      number=3, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='block', full_name='eyeq.WriteBlock.block', index=3,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_WRITEBLOCK_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1818,
-  serialized_end=1930,
-)
-
-
-_READBLOCKS_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.ReadBlocks.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='block', full_name='eyeq.ReadBlocks.Response.block', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2005,
-  serialized_end=2043,
-)
-
-_READBLOCKS = _descriptor.Descriptor(
-  name='ReadBlocks',
-  full_name='eyeq.ReadBlocks',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.ReadBlocks.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.ReadBlocks.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='offset', full_name='eyeq.ReadBlocks.offset', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='count', full_name='eyeq.ReadBlocks.count', index=3,
-      number=4, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_READBLOCKS_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1932,
-  serialized_end=2043,
-)
-
-
-_STOREREADERSTREAM = _descriptor.Descriptor(
-  name='StoreReaderStream',
-  full_name='eyeq.StoreReaderStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.StoreReaderStream.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.StoreReaderStream.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='start_block', full_name='eyeq.StoreReaderStream.start_block', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='end_block', full_name='eyeq.StoreReaderStream.end_block', index=3,
-      number=4, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2045,
-  serialized_end=2132,
-)
-
-
-_FREQUENCYTRANSLATESTREAM = _descriptor.Descriptor(
-  name='FrequencyTranslateStream',
-  full_name='eyeq.FrequencyTranslateStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='relative_frequency', full_name='eyeq.FrequencyTranslateStream.relative_frequency', index=0,
-      number=1, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='phase', full_name='eyeq.FrequencyTranslateStream.phase', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2134,
-  serialized_end=2203,
-)
-
-
-_CONSTMULTIPLYSTREAM = _descriptor.Descriptor(
-  name='ConstMultiplyStream',
-  full_name='eyeq.ConstMultiplyStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='is_complex', full_name='eyeq.ConstMultiplyStream.is_complex', index=0,
-      number=1, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='real', full_name='eyeq.ConstMultiplyStream.real', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='imag', full_name='eyeq.ConstMultiplyStream.imag', index=2,
-      number=3, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2205,
-  serialized_end=2274,
-)
-
-
-_FIRFILTERSTREAM = _descriptor.Descriptor(
-  name='FirFilterStream',
-  full_name='eyeq.FirFilterStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='is_complex', full_name='eyeq.FirFilterStream.is_complex', index=0,
-      number=1, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='filter_taps', full_name='eyeq.FirFilterStream.filter_taps', index=1,
-      number=2, type=2, cpp_type=6, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2276,
-  serialized_end=2334,
-)
-
-
-_ABSSTREAM = _descriptor.Descriptor(
-  name='AbsStream',
-  full_name='eyeq.AbsStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2336,
-  serialized_end=2347,
-)
-
-
-_LOGSTREAM = _descriptor.Descriptor(
-  name='LogStream',
-  full_name='eyeq.LogStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='log_base', full_name='eyeq.LogStream.log_base', index=0,
-      number=1, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2349,
-  serialized_end=2378,
-)
-
-
-_STREAMLAYER = _descriptor.Descriptor(
-  name='StreamLayer',
-  full_name='eyeq.StreamLayer',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='store_reader', full_name='eyeq.StreamLayer.store_reader', index=0,
-      number=6, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='frequency_translate', full_name='eyeq.StreamLayer.frequency_translate', index=1,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='const_multiply', full_name='eyeq.StreamLayer.const_multiply', index=2,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='fir_filter', full_name='eyeq.StreamLayer.fir_filter', index=3,
-      number=3, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='abs_stream', full_name='eyeq.StreamLayer.abs_stream', index=4,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='log_stream', full_name='eyeq.StreamLayer.log_stream', index=5,
-      number=5, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-    _descriptor.OneofDescriptor(
-      name='layer', full_name='eyeq.StreamLayer.layer',
-      index=0, containing_type=None,
-      create_key=_descriptor._internal_create_key,
-    fields=[]),
-  ],
-  serialized_start=2381,
-  serialized_end=2691,
-)
-
-
-_STREAM = _descriptor.Descriptor(
-  name='Stream',
-  full_name='eyeq.Stream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.Stream.path', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.Stream.name', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='lifetime_seconds', full_name='eyeq.Stream.lifetime_seconds', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2693,
-  serialized_end=2755,
-)
-
-
-_CREATESTREAM_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.CreateStream.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='stream', full_name='eyeq.CreateStream.Response.stream', index=0,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2838,
-  serialized_end=2878,
-)
-
-_CREATESTREAM = _descriptor.Descriptor(
-  name='CreateStream',
-  full_name='eyeq.CreateStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='stream', full_name='eyeq.CreateStream.stream', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='layers', full_name='eyeq.CreateStream.layers', index=1,
-      number=2, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_CREATESTREAM_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2757,
-  serialized_end=2878,
-)
-
-
-_READSTREAM_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.ReadStream.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='block', full_name='eyeq.ReadStream.Response.block', index=0,
-      number=1, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='ts', full_name='eyeq.ReadStream.Response.ts', index=1,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='samples', full_name='eyeq.ReadStream.Response.samples', index=2,
-      number=3, type=2, cpp_type=6, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='eos', full_name='eyeq.ReadStream.Response.eos', index=3,
-      number=4, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2945,
-  serialized_end=3029,
-)
-
-_READSTREAM = _descriptor.Descriptor(
-  name='ReadStream',
-  full_name='eyeq.ReadStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.ReadStream.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.ReadStream.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='sample_count', full_name='eyeq.ReadStream.sample_count', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_READSTREAM_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=2881,
-  serialized_end=3029,
-)
-
-
-_SEEKSTREAM_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.SeekStream.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='sample_offset', full_name='eyeq.SeekStream.Response.sample_offset', index=0,
-      number=1, type=4, cpp_type=4, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='eos', full_name='eyeq.SeekStream.Response.eos', index=1,
-      number=2, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3091,
-  serialized_end=3137,
-)
-
-_SEEKSTREAM = _descriptor.Descriptor(
-  name='SeekStream',
-  full_name='eyeq.SeekStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.SeekStream.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.SeekStream.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='block_id', full_name='eyeq.SeekStream.block_id', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_SEEKSTREAM_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3031,
-  serialized_end=3137,
-)
-
-
-_CLOSESTREAM_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.CloseStream.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1530,
-  serialized_end=1540,
-)
-
-_CLOSESTREAM = _descriptor.Descriptor(
-  name='CloseStream',
-  full_name='eyeq.CloseStream',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.CloseStream.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.CloseStream.path', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_CLOSESTREAM_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3139,
-  serialized_end=3192,
-)
-
-
-_STREAMINFO_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.StreamInfo.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='stream', full_name='eyeq.StreamInfo.Response.stream', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='block_id', full_name='eyeq.StreamInfo.Response.block_id', index=1,
-      number=2, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='sample_offset', full_name='eyeq.StreamInfo.Response.sample_offset', index=2,
-      number=3, type=4, cpp_type=4, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='eos', full_name='eyeq.StreamInfo.Response.eos', index=3,
-      number=4, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3237,
-  serialized_end=3331,
-)
-
-_STREAMINFO = _descriptor.Descriptor(
-  name='StreamInfo',
-  full_name='eyeq.StreamInfo',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.StreamInfo.path', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-    _descriptor.FieldDescriptor(
-      name='name', full_name='eyeq.StreamInfo.name', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_STREAMINFO_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3195,
-  serialized_end=3331,
-)
-
-
-_LISTSTREAMS_RESPONSE = _descriptor.Descriptor(
-  name='Response',
-  full_name='eyeq.ListStreams.Response',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='streams', full_name='eyeq.ListStreams.Response.streams', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3362,
-  serialized_end=3403,
-)
-
-_LISTSTREAMS = _descriptor.Descriptor(
-  name='ListStreams',
-  full_name='eyeq.ListStreams',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  create_key=_descriptor._internal_create_key,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='path', full_name='eyeq.ListStreams.path', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=b"".decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR,  create_key=_descriptor._internal_create_key),
-  ],
-  extensions=[
-  ],
-  nested_types=[_LISTSTREAMS_RESPONSE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=3333,
-  serialized_end=3403,
-)
-
-_SERVERREQUEST.fields_by_name['create_store'].message_type = _CREATESTORE
-_SERVERREQUEST.fields_by_name['list_stores'].message_type = _LISTSTORES
-_SERVERREQUEST.fields_by_name['delete_store'].message_type = _DELETESTORE
-_SERVERREQUEST.fields_by_name['write_block'].message_type = _WRITEBLOCK
-_SERVERREQUEST.fields_by_name['read_blocks'].message_type = _READBLOCKS
-_SERVERREQUEST.fields_by_name['flush_stores'].message_type = _FLUSHSTORES
-_SERVERREQUEST.fields_by_name['create_stream'].message_type = _CREATESTREAM
-_SERVERREQUEST.fields_by_name['read_stream'].message_type = _READSTREAM
-_SERVERREQUEST.fields_by_name['seek_stream'].message_type = _SEEKSTREAM
-_SERVERREQUEST.fields_by_name['close_stream'].message_type = _CLOSESTREAM
-_SERVERREQUEST.fields_by_name['stream_info'].message_type = _STREAMINFO
-_SERVERREQUEST.fields_by_name['list_streams'].message_type = _LISTSTREAMS
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['create_store'])
-_SERVERREQUEST.fields_by_name['create_store'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['list_stores'])
-_SERVERREQUEST.fields_by_name['list_stores'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['delete_store'])
-_SERVERREQUEST.fields_by_name['delete_store'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['write_block'])
-_SERVERREQUEST.fields_by_name['write_block'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['read_blocks'])
-_SERVERREQUEST.fields_by_name['read_blocks'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['flush_stores'])
-_SERVERREQUEST.fields_by_name['flush_stores'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['create_stream'])
-_SERVERREQUEST.fields_by_name['create_stream'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['read_stream'])
-_SERVERREQUEST.fields_by_name['read_stream'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['seek_stream'])
-_SERVERREQUEST.fields_by_name['seek_stream'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['close_stream'])
-_SERVERREQUEST.fields_by_name['close_stream'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['stream_info'])
-_SERVERREQUEST.fields_by_name['stream_info'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERREQUEST.oneofs_by_name['req'].fields.append(
-  _SERVERREQUEST.fields_by_name['list_streams'])
-_SERVERREQUEST.fields_by_name['list_streams'].containing_oneof = _SERVERREQUEST.oneofs_by_name['req']
-_SERVERRESPONSE.fields_by_name['create_store_response'].message_type = _CREATESTORE_RESPONSE
-_SERVERRESPONSE.fields_by_name['list_stores_response'].message_type = _LISTSTORES_RESPONSE
-_SERVERRESPONSE.fields_by_name['delete_store_response'].message_type = _DELETESTORE_RESPONSE
-_SERVERRESPONSE.fields_by_name['write_block_response'].message_type = _WRITEBLOCK_RESPONSE
-_SERVERRESPONSE.fields_by_name['read_blocks_response'].message_type = _READBLOCKS_RESPONSE
-_SERVERRESPONSE.fields_by_name['flush_stores_response'].message_type = _FLUSHSTORES_RESPONSE
-_SERVERRESPONSE.fields_by_name['create_stream_response'].message_type = _CREATESTREAM_RESPONSE
-_SERVERRESPONSE.fields_by_name['read_stream_response'].message_type = _READSTREAM_RESPONSE
-_SERVERRESPONSE.fields_by_name['seek_stream_response'].message_type = _SEEKSTREAM_RESPONSE
-_SERVERRESPONSE.fields_by_name['close_stream_response'].message_type = _CLOSESTREAM_RESPONSE
-_SERVERRESPONSE.fields_by_name['stream_info_response'].message_type = _STREAMINFO_RESPONSE
-_SERVERRESPONSE.fields_by_name['list_streams_response'].message_type = _LISTSTREAMS_RESPONSE
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['create_store_response'])
-_SERVERRESPONSE.fields_by_name['create_store_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['list_stores_response'])
-_SERVERRESPONSE.fields_by_name['list_stores_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['delete_store_response'])
-_SERVERRESPONSE.fields_by_name['delete_store_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['write_block_response'])
-_SERVERRESPONSE.fields_by_name['write_block_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['read_blocks_response'])
-_SERVERRESPONSE.fields_by_name['read_blocks_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['flush_stores_response'])
-_SERVERRESPONSE.fields_by_name['flush_stores_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['create_stream_response'])
-_SERVERRESPONSE.fields_by_name['create_stream_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['read_stream_response'])
-_SERVERRESPONSE.fields_by_name['read_stream_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['seek_stream_response'])
-_SERVERRESPONSE.fields_by_name['seek_stream_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['close_stream_response'])
-_SERVERRESPONSE.fields_by_name['close_stream_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['stream_info_response'])
-_SERVERRESPONSE.fields_by_name['stream_info_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_SERVERRESPONSE.oneofs_by_name['resp'].fields.append(
-  _SERVERRESPONSE.fields_by_name['list_streams_response'])
-_SERVERRESPONSE.fields_by_name['list_streams_response'].containing_oneof = _SERVERRESPONSE.oneofs_by_name['resp']
-_STORE.fields_by_name['store_type'].enum_type = _STORETYPE
-_CREATESTORE_RESPONSE.fields_by_name['store'].message_type = _STORE
-_CREATESTORE_RESPONSE.containing_type = _CREATESTORE
-_CREATESTORE.fields_by_name['store'].message_type = _STORE
-_LISTSTORES_RESPONSE.fields_by_name['stores'].message_type = _STORE
-_LISTSTORES_RESPONSE.containing_type = _LISTSTORES
-_DELETESTORE_RESPONSE.containing_type = _DELETESTORE
-_FLUSHSTORES_RESPONSE.containing_type = _FLUSHSTORES
-_WRITEBLOCK_RESPONSE.containing_type = _WRITEBLOCK
-_WRITEBLOCK.fields_by_name['block'].message_type = _BLOCK
-_READBLOCKS_RESPONSE.fields_by_name['block'].message_type = _BLOCK
-_READBLOCKS_RESPONSE.containing_type = _READBLOCKS
-_STREAMLAYER.fields_by_name['store_reader'].message_type = _STOREREADERSTREAM
-_STREAMLAYER.fields_by_name['frequency_translate'].message_type = _FREQUENCYTRANSLATESTREAM
-_STREAMLAYER.fields_by_name['const_multiply'].message_type = _CONSTMULTIPLYSTREAM
-_STREAMLAYER.fields_by_name['fir_filter'].message_type = _FIRFILTERSTREAM
-_STREAMLAYER.fields_by_name['abs_stream'].message_type = _ABSSTREAM
-_STREAMLAYER.fields_by_name['log_stream'].message_type = _LOGSTREAM
-_STREAMLAYER.oneofs_by_name['layer'].fields.append(
-  _STREAMLAYER.fields_by_name['store_reader'])
-_STREAMLAYER.fields_by_name['store_reader'].containing_oneof = _STREAMLAYER.oneofs_by_name['layer']
-_STREAMLAYER.oneofs_by_name['layer'].fields.append(
-  _STREAMLAYER.fields_by_name['frequency_translate'])
-_STREAMLAYER.fields_by_name['frequency_translate'].containing_oneof = _STREAMLAYER.oneofs_by_name['layer']
-_STREAMLAYER.oneofs_by_name['layer'].fields.append(
-  _STREAMLAYER.fields_by_name['const_multiply'])
-_STREAMLAYER.fields_by_name['const_multiply'].containing_oneof = _STREAMLAYER.oneofs_by_name['layer']
-_STREAMLAYER.oneofs_by_name['layer'].fields.append(
-  _STREAMLAYER.fields_by_name['fir_filter'])
-_STREAMLAYER.fields_by_name['fir_filter'].containing_oneof = _STREAMLAYER.oneofs_by_name['layer']
-_STREAMLAYER.oneofs_by_name['layer'].fields.append(
-  _STREAMLAYER.fields_by_name['abs_stream'])
-_STREAMLAYER.fields_by_name['abs_stream'].containing_oneof = _STREAMLAYER.oneofs_by_name['layer']
-_STREAMLAYER.oneofs_by_name['layer'].fields.append(
-  _STREAMLAYER.fields_by_name['log_stream'])
-_STREAMLAYER.fields_by_name['log_stream'].containing_oneof = _STREAMLAYER.oneofs_by_name['layer']
-_CREATESTREAM_RESPONSE.fields_by_name['stream'].message_type = _STREAM
-_CREATESTREAM_RESPONSE.containing_type = _CREATESTREAM
-_CREATESTREAM.fields_by_name['stream'].message_type = _STREAM
-_CREATESTREAM.fields_by_name['layers'].message_type = _STREAMLAYER
-_READSTREAM_RESPONSE.fields_by_name['ts'].message_type = _TIMESTAMP
-_READSTREAM_RESPONSE.containing_type = _READSTREAM
-_SEEKSTREAM_RESPONSE.containing_type = _SEEKSTREAM
-_CLOSESTREAM_RESPONSE.containing_type = _CLOSESTREAM
-_STREAMINFO_RESPONSE.fields_by_name['stream'].message_type = _STREAM
-_STREAMINFO_RESPONSE.containing_type = _STREAMINFO
-_LISTSTREAMS_RESPONSE.fields_by_name['streams'].message_type = _STREAM
-_LISTSTREAMS_RESPONSE.containing_type = _LISTSTREAMS
-DESCRIPTOR.message_types_by_name['ServerRequest'] = _SERVERREQUEST
-DESCRIPTOR.message_types_by_name['ServerResponse'] = _SERVERRESPONSE
-DESCRIPTOR.message_types_by_name['Store'] = _STORE
-DESCRIPTOR.message_types_by_name['CreateStore'] = _CREATESTORE
-DESCRIPTOR.message_types_by_name['ListStores'] = _LISTSTORES
-DESCRIPTOR.message_types_by_name['DeleteStore'] = _DELETESTORE
-DESCRIPTOR.message_types_by_name['FlushStores'] = _FLUSHSTORES
-DESCRIPTOR.message_types_by_name['Timestamp'] = _TIMESTAMP
-DESCRIPTOR.message_types_by_name['Block'] = _BLOCK
-DESCRIPTOR.message_types_by_name['WriteBlock'] = _WRITEBLOCK
-DESCRIPTOR.message_types_by_name['ReadBlocks'] = _READBLOCKS
-DESCRIPTOR.message_types_by_name['StoreReaderStream'] = _STOREREADERSTREAM
-DESCRIPTOR.message_types_by_name['FrequencyTranslateStream'] = _FREQUENCYTRANSLATESTREAM
-DESCRIPTOR.message_types_by_name['ConstMultiplyStream'] = _CONSTMULTIPLYSTREAM
-DESCRIPTOR.message_types_by_name['FirFilterStream'] = _FIRFILTERSTREAM
-DESCRIPTOR.message_types_by_name['AbsStream'] = _ABSSTREAM
-DESCRIPTOR.message_types_by_name['LogStream'] = _LOGSTREAM
-DESCRIPTOR.message_types_by_name['StreamLayer'] = _STREAMLAYER
-DESCRIPTOR.message_types_by_name['Stream'] = _STREAM
-DESCRIPTOR.message_types_by_name['CreateStream'] = _CREATESTREAM
-DESCRIPTOR.message_types_by_name['ReadStream'] = _READSTREAM
-DESCRIPTOR.message_types_by_name['SeekStream'] = _SEEKSTREAM
-DESCRIPTOR.message_types_by_name['CloseStream'] = _CLOSESTREAM
-DESCRIPTOR.message_types_by_name['StreamInfo'] = _STREAMINFO
-DESCRIPTOR.message_types_by_name['ListStreams'] = _LISTSTREAMS
-DESCRIPTOR.enum_types_by_name['StoreType'] = _STORETYPE
-_sym_db.RegisterFileDescriptor(DESCRIPTOR)
-
-ServerRequest = _reflection.GeneratedProtocolMessageType('ServerRequest', (_message.Message,), {
-  'DESCRIPTOR' : _SERVERREQUEST,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ServerRequest)
-  })
-_sym_db.RegisterMessage(ServerRequest)
-
-ServerResponse = _reflection.GeneratedProtocolMessageType('ServerResponse', (_message.Message,), {
-  'DESCRIPTOR' : _SERVERRESPONSE,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ServerResponse)
-  })
-_sym_db.RegisterMessage(ServerResponse)
-
-Store = _reflection.GeneratedProtocolMessageType('Store', (_message.Message,), {
-  'DESCRIPTOR' : _STORE,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.Store)
-  })
-_sym_db.RegisterMessage(Store)
-
-CreateStore = _reflection.GeneratedProtocolMessageType('CreateStore', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _CREATESTORE_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.CreateStore.Response)
-    })
-  ,
-  'DESCRIPTOR' : _CREATESTORE,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.CreateStore)
-  })
-_sym_db.RegisterMessage(CreateStore)
-_sym_db.RegisterMessage(CreateStore.Response)
-
-ListStores = _reflection.GeneratedProtocolMessageType('ListStores', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _LISTSTORES_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.ListStores.Response)
-    })
-  ,
-  'DESCRIPTOR' : _LISTSTORES,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ListStores)
-  })
-_sym_db.RegisterMessage(ListStores)
-_sym_db.RegisterMessage(ListStores.Response)
-
-DeleteStore = _reflection.GeneratedProtocolMessageType('DeleteStore', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _DELETESTORE_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.DeleteStore.Response)
-    })
-  ,
-  'DESCRIPTOR' : _DELETESTORE,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.DeleteStore)
-  })
-_sym_db.RegisterMessage(DeleteStore)
-_sym_db.RegisterMessage(DeleteStore.Response)
-
-FlushStores = _reflection.GeneratedProtocolMessageType('FlushStores', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _FLUSHSTORES_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.FlushStores.Response)
-    })
-  ,
-  'DESCRIPTOR' : _FLUSHSTORES,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.FlushStores)
-  })
-_sym_db.RegisterMessage(FlushStores)
-_sym_db.RegisterMessage(FlushStores.Response)
-
-Timestamp = _reflection.GeneratedProtocolMessageType('Timestamp', (_message.Message,), {
-  'DESCRIPTOR' : _TIMESTAMP,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.Timestamp)
-  })
-_sym_db.RegisterMessage(Timestamp)
-
-Block = _reflection.GeneratedProtocolMessageType('Block', (_message.Message,), {
-  'DESCRIPTOR' : _BLOCK,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.Block)
-  })
-_sym_db.RegisterMessage(Block)
-
-WriteBlock = _reflection.GeneratedProtocolMessageType('WriteBlock', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _WRITEBLOCK_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.WriteBlock.Response)
-    })
-  ,
-  'DESCRIPTOR' : _WRITEBLOCK,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.WriteBlock)
-  })
-_sym_db.RegisterMessage(WriteBlock)
-_sym_db.RegisterMessage(WriteBlock.Response)
-
-ReadBlocks = _reflection.GeneratedProtocolMessageType('ReadBlocks', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _READBLOCKS_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.ReadBlocks.Response)
-    })
-  ,
-  'DESCRIPTOR' : _READBLOCKS,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ReadBlocks)
-  })
-_sym_db.RegisterMessage(ReadBlocks)
-_sym_db.RegisterMessage(ReadBlocks.Response)
-
-StoreReaderStream = _reflection.GeneratedProtocolMessageType('StoreReaderStream', (_message.Message,), {
-  'DESCRIPTOR' : _STOREREADERSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.StoreReaderStream)
-  })
-_sym_db.RegisterMessage(StoreReaderStream)
-
-FrequencyTranslateStream = _reflection.GeneratedProtocolMessageType('FrequencyTranslateStream', (_message.Message,), {
-  'DESCRIPTOR' : _FREQUENCYTRANSLATESTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.FrequencyTranslateStream)
-  })
-_sym_db.RegisterMessage(FrequencyTranslateStream)
-
-ConstMultiplyStream = _reflection.GeneratedProtocolMessageType('ConstMultiplyStream', (_message.Message,), {
-  'DESCRIPTOR' : _CONSTMULTIPLYSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ConstMultiplyStream)
-  })
-_sym_db.RegisterMessage(ConstMultiplyStream)
-
-FirFilterStream = _reflection.GeneratedProtocolMessageType('FirFilterStream', (_message.Message,), {
-  'DESCRIPTOR' : _FIRFILTERSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.FirFilterStream)
-  })
-_sym_db.RegisterMessage(FirFilterStream)
-
-AbsStream = _reflection.GeneratedProtocolMessageType('AbsStream', (_message.Message,), {
-  'DESCRIPTOR' : _ABSSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.AbsStream)
-  })
-_sym_db.RegisterMessage(AbsStream)
-
-LogStream = _reflection.GeneratedProtocolMessageType('LogStream', (_message.Message,), {
-  'DESCRIPTOR' : _LOGSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.LogStream)
-  })
-_sym_db.RegisterMessage(LogStream)
-
-StreamLayer = _reflection.GeneratedProtocolMessageType('StreamLayer', (_message.Message,), {
-  'DESCRIPTOR' : _STREAMLAYER,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.StreamLayer)
-  })
-_sym_db.RegisterMessage(StreamLayer)
-
-Stream = _reflection.GeneratedProtocolMessageType('Stream', (_message.Message,), {
-  'DESCRIPTOR' : _STREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.Stream)
-  })
-_sym_db.RegisterMessage(Stream)
-
-CreateStream = _reflection.GeneratedProtocolMessageType('CreateStream', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _CREATESTREAM_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.CreateStream.Response)
-    })
-  ,
-  'DESCRIPTOR' : _CREATESTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.CreateStream)
-  })
-_sym_db.RegisterMessage(CreateStream)
-_sym_db.RegisterMessage(CreateStream.Response)
-
-ReadStream = _reflection.GeneratedProtocolMessageType('ReadStream', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _READSTREAM_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.ReadStream.Response)
-    })
-  ,
-  'DESCRIPTOR' : _READSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ReadStream)
-  })
-_sym_db.RegisterMessage(ReadStream)
-_sym_db.RegisterMessage(ReadStream.Response)
-
-SeekStream = _reflection.GeneratedProtocolMessageType('SeekStream', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _SEEKSTREAM_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.SeekStream.Response)
-    })
-  ,
-  'DESCRIPTOR' : _SEEKSTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.SeekStream)
-  })
-_sym_db.RegisterMessage(SeekStream)
-_sym_db.RegisterMessage(SeekStream.Response)
-
-CloseStream = _reflection.GeneratedProtocolMessageType('CloseStream', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _CLOSESTREAM_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.CloseStream.Response)
-    })
-  ,
-  'DESCRIPTOR' : _CLOSESTREAM,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.CloseStream)
-  })
-_sym_db.RegisterMessage(CloseStream)
-_sym_db.RegisterMessage(CloseStream.Response)
-
-StreamInfo = _reflection.GeneratedProtocolMessageType('StreamInfo', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _STREAMINFO_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.StreamInfo.Response)
-    })
-  ,
-  'DESCRIPTOR' : _STREAMINFO,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.StreamInfo)
-  })
-_sym_db.RegisterMessage(StreamInfo)
-_sym_db.RegisterMessage(StreamInfo.Response)
-
-ListStreams = _reflection.GeneratedProtocolMessageType('ListStreams', (_message.Message,), {
-
-  'Response' : _reflection.GeneratedProtocolMessageType('Response', (_message.Message,), {
-    'DESCRIPTOR' : _LISTSTREAMS_RESPONSE,
-    '__module__' : 'samples_pb2'
-    # @@protoc_insertion_point(class_scope:eyeq.ListStreams.Response)
-    })
-  ,
-  'DESCRIPTOR' : _LISTSTREAMS,
-  '__module__' : 'samples_pb2'
-  # @@protoc_insertion_point(class_scope:eyeq.ListStreams)
-  })
-_sym_db.RegisterMessage(ListStreams)
-_sym_db.RegisterMessage(ListStreams.Response)
-
-
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rsamples.proto\x12\x04\x65yeq\"\xa3\x05\n\rServerRequest\x12\x0e\n\x06req_id\x18\x07 \x01(\r\x12)\n\x0c\x63reate_store\x18\x01 \x01(\x0b\x32\x11.eyeq.CreateStoreH\x00\x12\'\n\x0blist_stores\x18\x02 \x01(\x0b\x32\x10.eyeq.ListStoresH\x00\x12)\n\x0c\x64\x65lete_store\x18\x03 \x01(\x0b\x32\x11.eyeq.DeleteStoreH\x00\x12\'\n\x0bwrite_block\x18\x04 \x01(\x0b\x32\x10.eyeq.WriteBlockH\x00\x12\'\n\x0bread_blocks\x18\x05 \x01(\x0b\x32\x10.eyeq.ReadBlocksH\x00\x12)\n\x0c\x66lush_stores\x18\x06 \x01(\x0b\x32\x11.eyeq.FlushStoresH\x00\x12+\n\rcreate_stream\x18\x08 \x01(\x0b\x32\x12.eyeq.CreateStreamH\x00\x12\'\n\x0bread_stream\x18\t \x01(\x0b\x32\x10.eyeq.ReadStreamH\x00\x12\'\n\x0bseek_stream\x18\n \x01(\x0b\x32\x10.eyeq.SeekStreamH\x00\x12)\n\x0c\x63lose_stream\x18\x0b \x01(\x0b\x32\x11.eyeq.CloseStreamH\x00\x12\'\n\x0bstream_info\x18\x0c \x01(\x0b\x32\x10.eyeq.StreamInfoH\x00\x12)\n\x0clist_streams\x18\r \x01(\x0b\x32\x11.eyeq.ListStreamsH\x00\x12-\n\x0esnapshot_store\x18\x0e \x01(\x0b\x32\x13.eyeq.SnapshotStoreH\x00\x12)\n\x0cquery_blocks\x18\x0f \x01(\x0b\x32\x11.eyeq.QueryBlocksH\x00\x12\'\n\x0b\x62lock_stats\x18\x10 \x01(\x0b\x32\x10.eyeq.BlockStatsH\x00\x42\x05\n\x03req\"\xc2\x07\n\x0eServerResponse\x12\r\n\x05\x65rror\x18\x01 \x01(\t\x12\x0e\n\x06req_id\x18\x08 \x01(\r\x12;\n\x15\x63reate_store_response\x18\x02 \x01(\x0b\x32\x1a.eyeq.CreateStore.ResponseH\x00\x12\x39\n\x14list_stores_response\x18\x03 \x01(\x0b\x32\x19.eyeq.ListStores.ResponseH\x00\x12;\n\x15\x64\x65lete_store_response\x18\x04 \x01(\x0b\x32\x1a.eyeq.DeleteStore.ResponseH\x00\x12\x39\n\x14write_block_response\x18\x05 \x01(\x0b\x32\x19.eyeq.WriteBlock.ResponseH\x00\x12\x39\n\x14read_blocks_response\x18\x06 \x01(\x0b\x32\x19.eyeq.ReadBlocks.ResponseH\x00\x12;\n\x15\x66lush_stores_response\x18\x07 \x01(\x0b\x32\x1a.eyeq.FlushStores.ResponseH\x00\x12=\n\x16\x63reate_stream_response\x18\t \x01(\x0b\x32\x1b.eyeq.CreateStream.ResponseH\x00\x12\x39\n\x14read_stream_response\x18\n \x01(\x0b\x32\x19.eyeq.ReadStream.ResponseH\x00\x12\x39\n\x14seek_stream_response\x18\x0b \x01(\x0b\x32\x19.eyeq.SeekStream.ResponseH\x00\x12;\n\x15\x63lose_stream_response\x18\x0c \x01(\x0b\x32\x1a.eyeq.CloseStream.ResponseH\x00\x12\x39\n\x14stream_info_response\x18\r \x01(\x0b\x32\x19.eyeq.StreamInfo.ResponseH\x00\x12;\n\x15list_streams_response\x18\x0e \x01(\x0b\x32\x1a.eyeq.ListStreams.ResponseH\x00\x12?\n\x17snapshot_store_response\x18\x0f \x01(\x0b\x32\x1c.eyeq.SnapshotStore.ResponseH\x00\x12;\n\x15query_blocks_response\x18\x10 \x01(\x0b\x32\x1a.eyeq.QueryBlocks.ResponseH\x00\x12\x39\n\x14\x62lock_stats_response\x18\x11 \x01(\x0b\x32\x19.eyeq.BlockStats.ResponseH\x00\x42\x06\n\x04resp\"\x9c\x04\n\x05Store\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12#\n\nstore_type\x18\x03 \x01(\x0e\x32\x0f.eyeq.StoreType\x12\x13\n\x0b\x62lock_count\x18\x04 \x01(\r\x12\x14\n\x0c\x62lock_offset\x18\x05 \x01(\r\x12\x11\n\tfile_path\x18\x06 \x01(\t\x12\x1f\n\x05\x63odec\x18\x07 \x01(\x0e\x32\x10.eyeq.StoreCodec\x12\x17\n\x0fhot_block_count\x18\x08 \x01(\r\x12\x12\n\nverify_crc\x18\t \x01(\x08\x12\x12\n\nscrub_rate\x18\n \x01(\r\x12\x17\n\x0f\x62\x61\x64_block_count\x18\x0b \x01(\r\x12\x12\n\nbad_blocks\x18\x0c \x03(\r\x12)\n\ndurability\x18\r \x01(\x0e\x32\x15.eyeq.StoreDurability\x12\x18\n\x10sync_interval_ms\x18\x0e \x01(\r\x12\x13\n\x0bsync_blocks\x18\x0f \x01(\r\x12\x1b\n\x13ingest_queue_blocks\x18\x10 \x01(\r\x12\x11\n\thugepages\x18\x11 \x01(\x08\x12\x11\n\tnuma_bind\x18\x12 \x01(\x08\x12\x11\n\tnuma_node\x18\x13 \x01(\r\x12\x16\n\x0ereserved_bytes\x18\x14 \x01(\x04\x12\x16\n\x0eresident_bytes\x18\x15 \x01(\x04\x12\x12\n\nblock_size\x18\x16 \x01(\r\x12\x11\n\tread_only\x18\x17 \x01(\x08\"Q\n\x0b\x43reateStore\x12\x1a\n\x05store\x18\x01 \x01(\x0b\x32\x0b.eyeq.Store\x1a&\n\x08Response\x12\x1a\n\x05store\x18\x01 \x01(\x0b\x32\x0b.eyeq.Store\"\x91\x01\n\nListStores\x12\x0c\n\x04path\x18\x01 \x01(\t\x12\x12\n\nafter_path\x18\x02 \x01(\t\x12\x12\n\nafter_name\x18\x03 \x01(\t\x1aM\n\x08Response\x12\x1b\n\x06stores\x18\x01 \x03(\x0b\x32\x0b.eyeq.Store\x12\x11\n\tnext_path\x18\x02 \x01(\t\x12\x11\n\tnext_name\x18\x03 \x01(\t\"F\n\x0b\x44\x65leteStore\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x1a\x1b\n\x08Response\x12\x0f\n\x07success\x18\x01 \x01(\x08\"\xbe\x01\n\rSnapshotStore\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x15\n\rsnapshot_name\x18\x03 \x01(\t\x12\x15\n\rsnapshot_path\x18\x04 \x01(\t\x12\x11\n\tfile_path\x18\x05 \x01(\t\x12\x13\n\x0bstart_block\x18\x06 \x01(\r\x12\x13\n\x0b\x62lock_count\x18\x07 \x01(\r\x1a&\n\x08Response\x12\x1a\n\x05store\x18\x01 \x01(\x0b\x32\x0b.eyeq.Store\"*\n\x0b\x46lushStores\x1a\x1b\n\x08Response\x12\x0f\n\x07success\x18\x01 \x01(\x08\"&\n\tTimestamp\x12\x0b\n\x03sec\x18\x01 \x01(\x04\x12\x0c\n\x04nsec\x18\x02 \x01(\x04\"\x15\n\x05\x42lock\x12\x0c\n\x04\x64\x61ta\x18\x01 \x01(\x0c\"\x8d\x01\n\nWriteBlock\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x0e\n\x06offset\x18\x03 \x01(\x05\x12\x1a\n\x05\x62lock\x18\x04 \x01(\x0b\x32\x0b.eyeq.Block\x12\x1b\n\x06\x62locks\x18\x05 \x03(\x0b\x32\x0b.eyeq.Block\x1a\x1a\n\x08Response\x12\x0e\n\x06offset\x18\x01 \x01(\r\"\x8e\x01\n\nReadBlocks\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x0e\n\x06offset\x18\x03 \x01(\r\x12\r\n\x05\x63ount\x18\x04 \x01(\r\x12\x1d\n\x04time\x18\x05 \x01(\x0b\x32\x0f.eyeq.Timestamp\x1a&\n\x08Response\x12\x1a\n\x05\x62lock\x18\x01 \x01(\x0b\x32\x0b.eyeq.Block\"\xb9\x04\n\x0bQueryBlocks\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x17\n\x0fmatch_source_id\x18\x03 \x01(\x08\x12\x11\n\tsource_id\x18\x04 \x01(\r\x12\x18\n\x10match_block_type\x18\x05 \x01(\x08\x12\x12\n\nblock_type\x18\x06 \x01(\r\x12\x17\n\x0fmatch_frequency\x18\x07 \x01(\x08\x12\x15\n\rmin_frequency\x18\x08 \x01(\x02\x12\x15\n\rmax_frequency\x18\t \x01(\x02\x12\x19\n\x11match_sample_rate\x18\n \x01(\x08\x12\x17\n\x0fmin_sample_rate\x18\x0b \x01(\r\x12\x17\n\x0fmax_sample_rate\x18\x0c \x01(\r\x12#\n\nstart_time\x18\r \x01(\x0b\x32\x0f.eyeq.Timestamp\x12!\n\x08\x65nd_time\x18\x0e \x01(\x0b\x32\x0f.eyeq.Timestamp\x12\x13\n\x0bstart_block\x18\x0f \x01(\r\x12\x13\n\x0bmatch_power\x18\x10 \x01(\x08\x12\x14\n\x0cmin_power_db\x18\x11 \x01(\x02\x12\x14\n\x0cmax_power_db\x18\x12 \x01(\x02\x1a/\n\x03Run\x12\x13\n\x0bstart_block\x18\x01 \x01(\r\x12\x13\n\x0b\x62lock_count\x18\x02 \x01(\r\x1aQ\n\x08Response\x12#\n\x04runs\x18\x01 \x03(\x0b\x32\x15.eyeq.QueryBlocks.Run\x12\x0c\n\x04more\x18\x02 \x01(\x08\x12\x12\n\nnext_block\x18\x03 \x01(\r\"\xdb\x01\n\nBlockStats\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x13\n\x0bstart_block\x18\x03 \x01(\r\x12\x0e\n\x06stride\x18\x04 \x01(\r\x1a\x8b\x01\n\x08Response\x12\x13\n\x0bstart_block\x18\x01 \x01(\r\x12\x0e\n\x06stride\x18\x02 \x01(\r\x12\x12\n\nmean_power\x18\x03 \x03(\x02\x12\x16\n\x0epeak_magnitude\x18\x04 \x03(\x02\x12\x0c\n\x04\x64\x63_i\x18\x05 \x03(\x02\x12\x0c\n\x04\x64\x63_q\x18\x06 \x03(\x02\x12\x12\n\nclip_count\x18\x07 \x03(\r\"W\n\x11StoreReaderStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x13\n\x0bstart_block\x18\x03 \x01(\r\x12\x11\n\tend_block\x18\x04 \x01(\r\"E\n\x18\x46requencyTranslateStream\x12\x1a\n\x12relative_frequency\x18\x01 \x01(\x02\x12\r\n\x05phase\x18\x02 \x01(\x02\"E\n\x13\x43onstMultiplyStream\x12\x12\n\nis_complex\x18\x01 \x01(\x08\x12\x0c\n\x04real\x18\x02 \x01(\x02\x12\x0c\n\x04imag\x18\x03 \x01(\x02\"e\n\x0f\x46irFilterStream\x12\x12\n\nis_complex\x18\x01 \x01(\x08\x12\x13\n\x0b\x66ilter_taps\x18\x02 \x03(\x02\x12\x15\n\rinterpolation\x18\x03 \x01(\r\x12\x12\n\ndecimation\x18\x04 \x01(\r\"\x0b\n\tAbsStream\"\x1d\n\tLogStream\x12\x10\n\x08log_base\x18\x01 \x01(\x02\"\xb6\x02\n\x0bStreamLayer\x12/\n\x0cstore_reader\x18\x06 \x01(\x0b\x32\x17.eyeq.StoreReaderStreamH\x00\x12=\n\x13\x66requency_translate\x18\x01 \x01(\x0b\x32\x1e.eyeq.FrequencyTranslateStreamH\x00\x12\x33\n\x0e\x63onst_multiply\x18\x02 \x01(\x0b\x32\x19.eyeq.ConstMultiplyStreamH\x00\x12+\n\nfir_filter\x18\x03 \x01(\x0b\x32\x15.eyeq.FirFilterStreamH\x00\x12%\n\nabs_stream\x18\x04 \x01(\x0b\x32\x0f.eyeq.AbsStreamH\x00\x12%\n\nlog_stream\x18\x05 \x01(\x0b\x32\x0f.eyeq.LogStreamH\x00\x42\x07\n\x05layer\">\n\x06Stream\x12\x0c\n\x04path\x18\x01 \x01(\t\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x18\n\x10lifetime_seconds\x18\x03 \x01(\r\"y\n\x0c\x43reateStream\x12\x1c\n\x06stream\x18\x01 \x01(\x0b\x32\x0c.eyeq.Stream\x12!\n\x06layers\x18\x02 \x03(\x0b\x32\x11.eyeq.StreamLayer\x1a(\n\x08Response\x12\x1c\n\x06stream\x18\x02 \x01(\x0b\x32\x0c.eyeq.Stream\"\x94\x01\n\nReadStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x14\n\x0csample_count\x18\x03 \x01(\r\x1aT\n\x08Response\x12\r\n\x05\x62lock\x18\x01 \x01(\r\x12\x1b\n\x02ts\x18\x02 \x01(\x0b\x32\x0f.eyeq.Timestamp\x12\x0f\n\x07samples\x18\x03 \x03(\x02\x12\x0b\n\x03\x65os\x18\x04 \x01(\x08\"\x89\x01\n\nSeekStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x12\x10\n\x08\x62lock_id\x18\x03 \x01(\r\x12\x1d\n\x04time\x18\x04 \x01(\x0b\x32\x0f.eyeq.Timestamp\x1a.\n\x08Response\x12\x15\n\rsample_offset\x18\x01 \x01(\x04\x12\x0b\n\x03\x65os\x18\x02 \x01(\x08\"5\n\x0b\x43loseStream\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0c\n\x04path\x18\x02 \x01(\t\x1a\n\n\x08Response\"\x88\x01\n\nStreamInfo\x12\x0c\n\x04path\x18\x01 \x01(\t\x12\x0c\n\x04name\x18\x02 \x01(\t\x1a^\n\x08Response\x12\x1c\n\x06stream\x18\x01 \x01(\x0b\x32\x0c.eyeq.Stream\x12\x10\n\x08\x62lock_id\x18\x02 \x01(\r\x12\x15\n\rsample_offset\x18\x03 \x01(\x04\x12\x0b\n\x03\x65os\x18\x04 \x01(\x08\"\x94\x01\n\x0bListStreams\x12\x0c\n\x04path\x18\x01 \x01(\t\x12\x12\n\nafter_path\x18\x02 \x01(\t\x12\x12\n\nafter_name\x18\x03 \x01(\t\x1aO\n\x08Response\x12\x1d\n\x07streams\x18\x01 \x03(\x0b\x32\x0c.eyeq.Stream\x12\x11\n\tnext_path\x18\x02 \x01(\t\x12\x11\n\tnext_name\x18\x03 \x01(\t*t\n\tStoreType\x12\x10\n\x0cMEMORY_STORE\x10\x00\x12\x0e\n\nFILE_STORE\x10\x01\x12\x0e\n\nMMAP_STORE\x10\x02\x12\x10\n\x0c\x44IRECT_STORE\x10\x03\x12\x10\n\x0cTIERED_STORE\x10\x04\x12\x11\n\rSTRIPED_STORE\x10\x05*+\n\nStoreCodec\x12\x0c\n\x08NO_CODEC\x10\x00\x12\x0f\n\x0b\x44\x45LTA_CODEC\x10\x01*T\n\x0fStoreDurability\x12\x13\n\x0f\x44URABILITY_NONE\x10\x00\x12\x17\n\x13\x44URABILITY_PERIODIC\x10\x01\x12\x13\n\x0f\x44URABILITY_SYNC\x10\x02\x62\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'samples_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _STORETYPE._serialized_start=5409
+  _STORETYPE._serialized_end=5525
+  _STORECODEC._serialized_start=5527
+  _STORECODEC._serialized_end=5570
+  _STOREDURABILITY._serialized_start=5572
+  _STOREDURABILITY._serialized_end=5656
+  _SERVERREQUEST._serialized_start=24
+  _SERVERREQUEST._serialized_end=699
+  _SERVERRESPONSE._serialized_start=702
+  _SERVERRESPONSE._serialized_end=1664
+  _STORE._serialized_start=1667
+  _STORE._serialized_end=2207
+  _CREATESTORE._serialized_start=2209
+  _CREATESTORE._serialized_end=2290
+  _CREATESTORE_RESPONSE._serialized_start=2252
+  _CREATESTORE_RESPONSE._serialized_end=2290
+  _LISTSTORES._serialized_start=2293
+  _LISTSTORES._serialized_end=2438
+  _LISTSTORES_RESPONSE._serialized_start=2361
+  _LISTSTORES_RESPONSE._serialized_end=2438
+  _DELETESTORE._serialized_start=2440
+  _DELETESTORE._serialized_end=2510
+  _DELETESTORE_RESPONSE._serialized_start=2483
+  _DELETESTORE_RESPONSE._serialized_end=2510
+  _SNAPSHOTSTORE._serialized_start=2513
+  _SNAPSHOTSTORE._serialized_end=2703
+  _SNAPSHOTSTORE_RESPONSE._serialized_start=2252
+  _SNAPSHOTSTORE_RESPONSE._serialized_end=2290
+  _FLUSHSTORES._serialized_start=2705
+  _FLUSHSTORES._serialized_end=2747
+  _FLUSHSTORES_RESPONSE._serialized_start=2483
+  _FLUSHSTORES_RESPONSE._serialized_end=2510
+  _TIMESTAMP._serialized_start=2749
+  _TIMESTAMP._serialized_end=2787
+  _BLOCK._serialized_start=2789
+  _BLOCK._serialized_end=2810
+  _WRITEBLOCK._serialized_start=2813
+  _WRITEBLOCK._serialized_end=2954
+  _WRITEBLOCK_RESPONSE._serialized_start=2928
+  _WRITEBLOCK_RESPONSE._serialized_end=2954
+  _READBLOCKS._serialized_start=2957
+  _READBLOCKS._serialized_end=3099
+  _READBLOCKS_RESPONSE._serialized_start=3061
+  _READBLOCKS_RESPONSE._serialized_end=3099
+  _QUERYBLOCKS._serialized_start=3102
+  _QUERYBLOCKS._serialized_end=3671
+  _QUERYBLOCKS_RUN._serialized_start=3541
+  _QUERYBLOCKS_RUN._serialized_end=3588
+  _QUERYBLOCKS_RESPONSE._serialized_start=3590
+  _QUERYBLOCKS_RESPONSE._serialized_end=3671
+  _BLOCKSTATS._serialized_start=3674
+  _BLOCKSTATS._serialized_end=3893
+  _BLOCKSTATS_RESPONSE._serialized_start=3754
+  _BLOCKSTATS_RESPONSE._serialized_end=3893
+  _STOREREADERSTREAM._serialized_start=3895
+  _STOREREADERSTREAM._serialized_end=3982
+  _FREQUENCYTRANSLATESTREAM._serialized_start=3984
+  _FREQUENCYTRANSLATESTREAM._serialized_end=4053
+  _CONSTMULTIPLYSTREAM._serialized_start=4055
+  _CONSTMULTIPLYSTREAM._serialized_end=4124
+  _FIRFILTERSTREAM._serialized_start=4126
+  _FIRFILTERSTREAM._serialized_end=4227
+  _ABSSTREAM._serialized_start=4229
+  _ABSSTREAM._serialized_end=4240
+  _LOGSTREAM._serialized_start=4242
+  _LOGSTREAM._serialized_end=4271
+  _STREAMLAYER._serialized_start=4274
+  _STREAMLAYER._serialized_end=4584
+  _STREAM._serialized_start=4586
+  _STREAM._serialized_end=4648
+  _CREATESTREAM._serialized_start=4650
+  _CREATESTREAM._serialized_end=4771
+  _CREATESTREAM_RESPONSE._serialized_start=4731
+  _CREATESTREAM_RESPONSE._serialized_end=4771
+  _READSTREAM._serialized_start=4774
+  _READSTREAM._serialized_end=4922
+  _READSTREAM_RESPONSE._serialized_start=4838
+  _READSTREAM_RESPONSE._serialized_end=4922
+  _SEEKSTREAM._serialized_start=4925
+  _SEEKSTREAM._serialized_end=5062
+  _SEEKSTREAM_RESPONSE._serialized_start=5016
+  _SEEKSTREAM_RESPONSE._serialized_end=5062
+  _CLOSESTREAM._serialized_start=5064
+  _CLOSESTREAM._serialized_end=5117
+  _CLOSESTREAM_RESPONSE._serialized_start=2252
+  _CLOSESTREAM_RESPONSE._serialized_end=2262
+  _STREAMINFO._serialized_start=5120
+  _STREAMINFO._serialized_end=5256
+  _STREAMINFO_RESPONSE._serialized_start=5162
+  _STREAMINFO_RESPONSE._serialized_end=5256
+  _LISTSTREAMS._serialized_start=5259
+  _LISTSTREAMS._serialized_end=5407
+  _LISTSTREAMS_RESPONSE._serialized_start=5328
+  _LISTSTREAMS_RESPONSE._serialized_end=5407
 # @@protoc_insertion_point(module_scope)
@@ -9,5 +9,7 @@ setuptools.setup(
 	author_email='jens@hiber.global',
 	description='Hiber Eyeq Library',
 	url='https://github.com/magnitudespace/eyeq',
-	packages=setuptools.find_packages()
+	packages=setuptools.find_packages(),
+	# samples_pb2.py is generated by protoc 3.21, whose builder API needs protobuf 3.20 or later
+	install_requires=['protobuf>=3.20'],
 )
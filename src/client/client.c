@@ -53,20 +53,27 @@ static int eyeq_transaction(
     int timeout_ms,
     void *context) {
 
-    uint8_t request_buffer[eyeq_ServerRequest_size];
-    uint8_t response_buffer[eyeq_ServerResponse_size];
+    uint8_t empty_frame[1];
 
     request->req_id = client->req_id;
     client->req_id++;
 
-    pb_ostream_t ostream = pb_ostream_from_buffer(request_buffer, eyeq_ServerRequest_size);
+    // Blocks are up to BLOCK_MAX_LENGTH, so messages are sized to what they hold
+    size_t size;
+    zmq_msg_t msg;
+    if (!pb_get_encoded_size(&size, eyeq_ServerRequest_fields, request) || zmq_msg_init_size(&msg, size)) {
+        return EYEQ_ENCODING_ERROR;
+    }
+
+    pb_ostream_t ostream = pb_ostream_from_buffer(zmq_msg_data(&msg), size);
 
     if (!pb_encode(&ostream, eyeq_ServerRequest_fields, request)) {
+        zmq_msg_close(&msg);
         return EYEQ_ENCODING_ERROR;
     }
 
     zmq_send(client->socket, 0, 0, ZMQ_SNDMORE);
-    zmq_send(client->socket, request_buffer, ostream.bytes_written, 0);
+    zmq_msg_send(&msg, client->socket, 0);
 
     // Wait for response
     while (true) {
@@ -83,7 +90,7 @@ static int eyeq_transaction(
         }
 
         // Receive empty frame
-        int nbytes = zmq_recv(client->socket, response_buffer, eyeq_ServerRequest_size, 0);
+        int nbytes = zmq_recv(client->socket, empty_frame, sizeof(empty_frame), 0);
         if (nbytes) {
             continue;
         }
@@ -99,46 +106,45 @@ static int eyeq_transaction(
         }
 
         // Receive contents
-        nbytes = zmq_recv(client->socket, response_buffer, eyeq_ServerResponse_size, 0);
+        zmq_msg_init(&msg);
+        nbytes = zmq_msg_recv(&msg, client->socket, 0);
         if (nbytes == -1) {
+            zmq_msg_close(&msg);
             return EYEQ_NETWORK_ERROR;
         }
 
-        pb_istream_t stream = pb_istream_from_buffer(response_buffer, nbytes);
-        if (pb_decode(&stream, eyeq_ServerResponse_fields, response)) {
-            if (response->req_id != request->req_id) {
-                continue;
-            }
-
-            if (!response->which_resp) {
-                fprintf(stderr, "Error while performing EyeQ request: %s\n", response->error);
-                return EYEQ_ERROR;
-            }
-
-            if (response->which_resp != expected_response_tag) {
-                return EYEQ_INVALID_RESPONSE;
-            }
-
-            // We use the user-supplied callback function if defined.
-            if (!response_callback) {
-                // The result will be contained in the response object.
-                return EYEQ_OK;
-            }
-
-            if (!response_callback(response, context)) {
-                // If response_callback returns false, stop the iteration
-                return EYEQ_REQUEST_ABORTED;
-            } else if (--expected_responses <= 0) {
-                // Return immediately if we don't expect more responses
-                return EYEQ_OK;
-            } else {
-                // Continue to receive the next response
-                continue;
-            }
-        } else {
+        pb_istream_t stream = pb_istream_from_buffer(zmq_msg_data(&msg), nbytes);
+        bool decoded = pb_decode(&stream, eyeq_ServerResponse_fields, response);
+        zmq_msg_close(&msg);
+        if (!decoded) {
             fprintf(stderr, "Could not decode EyeQ packet of length %d", nbytes);
             return EYEQ_INVALID_RESPONSE;
         }
+
+        int res = -1;
+        if (response->req_id != request->req_id) {
+            // Not ours, wait for the next response
+        } else if (!response->which_resp) {
+            fprintf(stderr, "Error while performing EyeQ request: %s\n", response->error);
+            res = EYEQ_ERROR;
+        } else if (response->which_resp != expected_response_tag) {
+            res = EYEQ_INVALID_RESPONSE;
+        } else if (!response_callback) {
+            // The result will be contained in the response object.
+            return EYEQ_OK;
+        } else if (!response_callback(response, context)) {
+            // If response_callback returns false, stop the iteration
+            res = EYEQ_REQUEST_ABORTED;
+        } else if (--expected_responses <= 0) {
+            // Return immediately if we don't expect more responses
+            res = EYEQ_OK;
+        }
+
+        // Blocks are allocated by the decoder and only live until the callback returns
+        pb_release(eyeq_ServerResponse_fields, response);
+        if (res >= 0) {
+            return res;
+        }
     }
 }
 
@@ -157,21 +163,28 @@ int eyeq_list_stores(eyeq_client_t *client, const char *path, bool (*list_stores
     eyeq_ServerResponse response;
 
     eyeq_ServerRequest request;
+    memset(&request.req.list_stores, 0, sizeof(request.req.list_stores));
     request.which_req = eyeq_ServerRequest_list_stores_tag;
     strncpy(request.req.list_stores.path, path, STORE_MAX_PATH);
     request.req.list_stores.path[STORE_MAX_PATH] = '\0';
 
-    int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_list_stores_response_tag, NULL, 1, client->timeout_ms, NULL);
-    if (resp) {
-        return resp;
-    }
+    // Fetch pages until the listing is complete
+    do {
+        int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_list_stores_response_tag, NULL, 1, client->timeout_ms, NULL);
+        if (resp) {
+            return resp;
+        }
 
-    for (int i = 0; i < response.resp.list_stores_response.stores_count; i++) {
-        eyeq_Store *store = &response.resp.list_stores_response.stores[i];
-        if (!list_stores_callback(store)) {
-            break;
+        for (int i = 0; i < response.resp.list_stores_response.stores_count; i++) {
+            eyeq_Store *store = &response.resp.list_stores_response.stores[i];
+            if (!list_stores_callback(store)) {
+                return EYEQ_OK;
+            }
         }
-    }
+
+        strcpy(request.req.list_stores.after_path, response.resp.list_stores_response.next_path);
+        strcpy(request.req.list_stores.after_name, response.resp.list_stores_response.next_name);
+    } while (request.req.list_stores.after_name[0]);
 
     return EYEQ_OK;
 }
@@ -189,6 +202,39 @@ int eyeq_delete_store(eyeq_client_t *client, const char *name, const char *path)
     return eyeq_transaction(client, &request, &response, eyeq_ServerResponse_delete_store_response_tag, NULL, 1, client->timeout_ms, NULL);
 }
 
+int eyeq_snapshot_store(eyeq_client_t *client, const char *name, const char *path, const char *snapshot_name,
+                        const char *snapshot_path, const char *file_path, uint32_t start_block, uint32_t block_count,
+                        eyeq_Store *snapshot) {
+    eyeq_ServerResponse response;
+    eyeq_ServerRequest request;
+
+    request.which_req = eyeq_ServerRequest_snapshot_store_tag;
+    eyeq_SnapshotStore *req = &request.req.snapshot_store;
+    strncpy(req->name, name, STORE_MAX_NAME);
+    req->name[STORE_MAX_NAME] = '\0';
+    strncpy(req->path, path, STORE_MAX_PATH);
+    req->path[STORE_MAX_PATH] = '\0';
+    strncpy(req->snapshot_name, snapshot_name, STORE_MAX_NAME);
+    req->snapshot_name[STORE_MAX_NAME] = '\0';
+    strncpy(req->snapshot_path, snapshot_path, STORE_MAX_PATH);
+    req->snapshot_path[STORE_MAX_PATH] = '\0';
+    strncpy(req->file_path, file_path ? file_path : "", STORE_MAX_PATH);
+    req->file_path[STORE_MAX_PATH] = '\0';
+    req->start_block = start_block;
+    req->block_count = block_count;
+
+    int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_snapshot_store_response_tag, NULL, 1, client->timeout_ms, NULL);
+    if (resp) {
+        return resp;
+    }
+
+    if (snapshot) {
+        memcpy(snapshot, &response.resp.snapshot_store_response.store, sizeof(eyeq_Store));
+    }
+
+    return EYEQ_OK;
+}
+
 int eyeq_write_block(eyeq_client_t *client, const char *name, const char *path, eyeq_Block *block, int32_t offset, uint32_t *written_offset) {
     eyeq_ServerResponse response;
     eyeq_ServerRequest request;
@@ -200,6 +246,37 @@ int eyeq_write_block(eyeq_client_t *client, const char *name, const char *path,
     request.req.write_block.path[STORE_MAX_PATH] = '\0';
     request.req.write_block.offset = offset;
     memcpy(&request.req.write_block.block, block, sizeof(eyeq_Block));
+    request.req.write_block.blocks_count = 0;
+
+    int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_write_block_response_tag, NULL, 1, client->timeout_ms, NULL);
+    if (resp) {
+        return resp;
+    }
+
+    if (written_offset) {
+        *written_offset = response.resp.write_block_response.offset;
+    }
+
+    return EYEQ_OK;
+}
+
+int eyeq_write_blocks(eyeq_client_t *client, const char *name, const char *path, eyeq_Block *blocks, uint32_t count, int32_t offset, uint32_t *written_offset) {
+    eyeq_ServerResponse response;
+    eyeq_ServerRequest request;
+
+    if (count == 0 || count > EYEQ_WRITE_BLOCKS_MAX) {
+        return EYEQ_ERROR;
+    }
+
+    request.which_req = eyeq_ServerRequest_write_block_tag;
+    strncpy(request.req.write_block.name, name, STORE_MAX_NAME);
+    request.req.write_block.name[STORE_MAX_NAME] = '\0';
+    strncpy(request.req.write_block.path, path, STORE_MAX_PATH);
+    request.req.write_block.path[STORE_MAX_PATH] = '\0';
+    request.req.write_block.offset = offset;
+    request.req.write_block.block.data = NULL;
+    memcpy(request.req.write_block.blocks, blocks, count * sizeof(eyeq_Block));
+    request.req.write_block.blocks_count = count;
 
     int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_write_block_response_tag, NULL, 1, client->timeout_ms, NULL);
     if (resp) {
@@ -229,11 +306,12 @@ static bool read_blocks_callback(eyeq_ServerResponse *response, void *context) {
     return false;
 }
 
-int eyeq_read_blocks(
+static int read_blocks(
     eyeq_client_t *client,
     const char *name,
     const char *path,
     uint32_t offset,
+    const eyeq_Timestamp *time,
     uint32_t count,
     bool (*read_block_callback)(eyeq_Block *block, void *context),
     long timeout_ms,
@@ -247,6 +325,7 @@ int eyeq_read_blocks(
         .inner_context = context,
     };
 
+    memset(&request.req.read_blocks, 0, sizeof(request.req.read_blocks));
     request.which_req = eyeq_ServerRequest_read_blocks_tag;
     strncpy(request.req.read_blocks.name, name, STORE_MAX_NAME);
     request.req.read_blocks.name[STORE_MAX_NAME] = '\0';
@@ -254,10 +333,102 @@ int eyeq_read_blocks(
     request.req.read_blocks.path[STORE_MAX_PATH] = '\0';
     request.req.read_blocks.offset = offset;
     request.req.read_blocks.count = count;
+    if (time) {
+        request.req.read_blocks.time = *time;
+    }
 
     return eyeq_transaction(client, &request, &response, eyeq_ServerResponse_read_blocks_response_tag, read_blocks_callback, count, timeout_ms, &read_block_ctx);
 }
 
+int eyeq_read_blocks(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    uint32_t offset,
+    uint32_t count,
+    bool (*read_block_callback)(eyeq_Block *block, void *context),
+    long timeout_ms,
+    void *context) {
+
+    return read_blocks(client, name, path, offset, NULL, count, read_block_callback, timeout_ms, context);
+}
+
+int eyeq_read_blocks_at_time(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    uint64_t sec,
+    uint32_t nsec,
+    uint32_t count,
+    bool (*read_block_callback)(eyeq_Block *block, void *context),
+    long timeout_ms,
+    void *context) {
+
+    eyeq_Timestamp time = { .sec = sec, .nsec = nsec };
+    return read_blocks(client, name, path, 0, &time, count, read_block_callback, timeout_ms, context);
+}
+
+int eyeq_query_blocks(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    const eyeq_QueryBlocks *query,
+    bool (*query_blocks_callback)(eyeq_QueryBlocks_Run *run, void *context),
+    void *context) {
+
+    eyeq_ServerResponse response;
+    eyeq_ServerRequest request;
+
+    request.which_req = eyeq_ServerRequest_query_blocks_tag;
+    memcpy(&request.req.query_blocks, query, sizeof(eyeq_QueryBlocks));
+    strncpy(request.req.query_blocks.name, name, STORE_MAX_NAME);
+    request.req.query_blocks.name[STORE_MAX_NAME] = '\0';
+    strncpy(request.req.query_blocks.path, path, STORE_MAX_PATH);
+    request.req.query_blocks.path[STORE_MAX_PATH] = '\0';
+
+    // Fetch pages until there are no more matches
+    do {
+        int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_query_blocks_response_tag, NULL, 1, client->timeout_ms, NULL);
+        if (resp) {
+            return resp;
+        }
+
+        eyeq_QueryBlocks_Response *result = &response.resp.query_blocks_response;
+        for (pb_size_t i = 0; i < result->runs_count; i++) {
+            if (!query_blocks_callback(&result->runs[i], context)) {
+                return EYEQ_OK;
+            }
+        }
+
+        request.req.query_blocks.start_block = result->next_block;
+    } while (response.resp.query_blocks_response.more);
+
+    return EYEQ_OK;
+}
+
+int eyeq_block_stats(eyeq_client_t *client, const char *name, const char *path, uint32_t start_block, uint32_t stride,
+                     eyeq_BlockStats_Response *stats) {
+    eyeq_ServerResponse response;
+    eyeq_ServerRequest request;
+
+    request.which_req = eyeq_ServerRequest_block_stats_tag;
+    strncpy(request.req.block_stats.name, name, STORE_MAX_NAME);
+    request.req.block_stats.name[STORE_MAX_NAME] = '\0';
+    strncpy(request.req.block_stats.path, path, STORE_MAX_PATH);
+    request.req.block_stats.path[STORE_MAX_PATH] = '\0';
+    request.req.block_stats.start_block = start_block;
+    request.req.block_stats.stride = stride;
+
+    int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_block_stats_response_tag, NULL, 1, client->timeout_ms, NULL);
+    if (resp) {
+        return resp;
+    }
+
+    memcpy(stats, &response.resp.block_stats_response, sizeof(eyeq_BlockStats_Response));
+
+    return EYEQ_OK;
+}
+
 int eyeq_flush_stores(eyeq_client_t *client) {
     eyeq_ServerResponse response;
     eyeq_ServerRequest request;
@@ -271,23 +442,29 @@ int eyeq_find_store(eyeq_client_t *client, const char *name, const char *path, e
     eyeq_ServerResponse response;
 
     eyeq_ServerRequest request;
+    memset(&request.req.list_stores, 0, sizeof(request.req.list_stores));
     request.which_req = eyeq_ServerRequest_list_stores_tag;
     strncpy(request.req.list_stores.path, path, STORE_MAX_PATH);
     request.req.list_stores.path[STORE_MAX_PATH] = '\0';
 
-    int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_list_stores_response_tag, NULL, 1, client->timeout_ms, NULL);
-    if (resp) {
-        return resp;
-    }
+    do {
+        int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_list_stores_response_tag, NULL, 1, client->timeout_ms, NULL);
+        if (resp) {
+            return resp;
+        }
 
-    for (int i = 0; i < response.resp.list_stores_response.stores_count; i++) {
-        eyeq_Store *_store = &response.resp.list_stores_response.stores[i];
-        if (!strncmp(_store->name, name, STORE_MAX_NAME) && 
-            !strncmp(_store->path, path, STORE_MAX_PATH)) {
-            memcpy(store, _store, sizeof(eyeq_Store));
-            return EYEQ_OK;
+        for (int i = 0; i < response.resp.list_stores_response.stores_count; i++) {
+            eyeq_Store *_store = &response.resp.list_stores_response.stores[i];
+            if (!strncmp(_store->name, name, STORE_MAX_NAME) &&
+                !strncmp(_store->path, path, STORE_MAX_PATH)) {
+                memcpy(store, _store, sizeof(eyeq_Store));
+                return EYEQ_OK;
+            }
         }
-    }
+
+        strcpy(request.req.list_stores.after_path, response.resp.list_stores_response.next_path);
+        strcpy(request.req.list_stores.after_name, response.resp.list_stores_response.next_name);
+    } while (request.req.list_stores.after_name[0]);
 
     return EYEQ_NOT_FOUND;
 }
@@ -348,44 +525,69 @@ int eyeq_list_streams(eyeq_client_t *client, const char *path, bool (*list_strea
     eyeq_ServerResponse response;
     eyeq_ServerRequest request;
 
+    memset(&request.req.list_streams, 0, sizeof(request.req.list_streams));
     request.which_req = eyeq_ServerRequest_list_streams_tag;
     strncpy(request.req.list_streams.path, path, STORE_MAX_PATH);
     request.req.list_streams.path[STORE_MAX_PATH] = '\0';
 
-    int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_list_streams_response_tag, NULL, 1, client->timeout_ms, NULL);
-    if (resp) {
-        return resp;
-    }
+    do {
+        int resp = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_list_streams_response_tag, NULL, 1, client->timeout_ms, NULL);
+        if (resp) {
+            return resp;
+        }
 
-    for (int i = 0; i < response.resp.list_streams_response.streams_count; i++) {
-        eyeq_Stream *stream = &response.resp.list_streams_response.streams[i];
-        if (!list_streams_callback(stream)) {
-            break;
+        for (int i = 0; i < response.resp.list_streams_response.streams_count; i++) {
+            eyeq_Stream *stream = &response.resp.list_streams_response.streams[i];
+            if (!list_streams_callback(stream)) {
+                return EYEQ_OK;
+            }
         }
-    }
+
+        strcpy(request.req.list_streams.after_path, response.resp.list_streams_response.next_path);
+        strcpy(request.req.list_streams.after_name, response.resp.list_streams_response.next_name);
+    } while (request.req.list_streams.after_name[0]);
 
     return EYEQ_OK;
 }
 
-int eyeq_seek_stream(
-    eyeq_client_t *client,
-    const char *name,
-    const char *path,
-    uint32_t block_id) {
-
+static int seek_stream(eyeq_client_t *client, const char *name, const char *path, uint32_t block_id, const eyeq_Timestamp *time) {
     eyeq_ServerResponse response;
     eyeq_ServerRequest request;
 
+    memset(&request.req.seek_stream, 0, sizeof(request.req.seek_stream));
     request.which_req = eyeq_ServerRequest_seek_stream_tag;
     strncpy(request.req.seek_stream.name, name, STORE_MAX_NAME);
     strncpy(request.req.seek_stream.path, path, STORE_MAX_PATH);
     request.req.seek_stream.name[STORE_MAX_NAME] = '\0';
     request.req.seek_stream.path[STORE_MAX_PATH] = '\0';
     request.req.seek_stream.block_id = block_id;
+    if (time) {
+        request.req.seek_stream.time = *time;
+    }
 
     return eyeq_transaction(client, &request, &response, eyeq_ServerResponse_seek_stream_response_tag, NULL, 1, client->timeout_ms, NULL);
 }
 
+int eyeq_seek_stream(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    uint32_t block_id) {
+
+    return seek_stream(client, name, path, block_id, NULL);
+}
+
+int eyeq_seek_stream_time(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    uint64_t sec,
+    uint32_t nsec) {
+
+    eyeq_Timestamp time = { .sec = sec, .nsec = nsec };
+    return seek_stream(client, name, path, 0, &time);
+}
+
 int eyeq_create_frequency_filter_stream(
     eyeq_client_t *client,
     const char *name,
@@ -398,6 +600,24 @@ int eyeq_create_frequency_filter_stream(
     const float *filter_taps,
     int ntaps)
 {
+    return eyeq_create_resampled_stream(client, name, path, store_name, store_path, start_block, block_count,
+                                        relative_frequency, filter_taps, ntaps, 1, 1);
+}
+
+int eyeq_create_resampled_stream(
+    eyeq_client_t *client,
+    const char *name,
+    const char *path,
+    const char *store_name,
+    const char *store_path,
+    uint32_t start_block,
+    uint32_t block_count,
+    float relative_frequency,
+    const float *filter_taps,
+    int ntaps,
+    uint32_t interpolation,
+    uint32_t decimation)
+{
 
     eyeq_ServerResponse response;
     eyeq_ServerRequest request = { 0 };
@@ -429,18 +649,30 @@ int eyeq_create_frequency_filter_stream(
         cs->layers_count++;
     }
 
+    // Real taps sent as complex ones, with zero imaginary parts
+    float *taps = NULL;
     if (ntaps > 0) {
+        taps = calloc(ntaps * 2, sizeof(float));
+        if (!taps) {
+            return EYEQ_ENCODING_ERROR;
+        }
+        for (int i = 0; i < ntaps; i++) {
+            taps[i*2] = filter_taps[i];
+        }
+
         eyeq_StreamLayer *ffl = &cs->layers[cs->layers_count];
         ffl->which_layer = eyeq_StreamLayer_fir_filter_tag;
         ffl->layer.fir_filter.is_complex = true;
-        for (int i = 0; i < ntaps; i++) {
-            ffl->layer.fir_filter.filter_taps[i*2] = filter_taps[i];
-        }
+        ffl->layer.fir_filter.filter_taps = taps;
         ffl->layer.fir_filter.filter_taps_count = ntaps * 2;
+        ffl->layer.fir_filter.interpolation = interpolation;
+        ffl->layer.fir_filter.decimation = decimation;
         cs->layers_count++;
     }
 
-    return eyeq_transaction(client, &request, &response, eyeq_ServerResponse_create_stream_response_tag, NULL, 1, client->timeout_ms, NULL);
+    int res = eyeq_transaction(client, &request, &response, eyeq_ServerResponse_create_stream_response_tag, NULL, 1, client->timeout_ms, NULL);
+    free(taps);
+    return res;
 }
 
 int eyeq_close_stream(eyeq_client_t *client, const char *name, const char *path) {
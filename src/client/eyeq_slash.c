@@ -1,12 +1,28 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
+#include <math.h>
 
 #include <slash/slash.h>
 #include <eyeq/client.h>
 
 static eyeq_client_t *client;
 
+// Block size of a store, exported and imported blocks are records of this size
+static int store_block_size(const char *name, const char *path, uint32_t *block_size)
+{
+    eyeq_Store store;
+    int res = eyeq_find_store(client, name, path, &store);
+    if (res) {
+        fprintf(stderr, "Could not find store '%s/%s'\n", path, name);
+        return res;
+    }
+
+    *block_size = store.block_size ? store.block_size : BLOCK_LENGTH;
+    return EYEQ_OK;
+}
+
 static int list_stores(struct slash *slash)
 {
     char *path = "";
@@ -15,7 +31,17 @@ static int list_stores(struct slash *slash)
     }
 
 	bool list_stores_cb(eyeq_Store *store) {
-		printf("* %s/%s (type: %d, offset: %"PRIu32", count: %"PRIu32")\n", store->path, store->name, store->store_type, store->block_offset, store->block_count);
+		printf("* %s/%s (type: %d, offset: %"PRIu32", count: %"PRIu32", block size: %"PRIu32")\n", store->path, store->name, store->store_type, store->block_offset, store->block_count, store->block_size);
+		if (store->reserved_bytes) {
+			printf("  memory: %"PRIu64" of %"PRIu64" MiB resident\n", store->resident_bytes >> 20, store->reserved_bytes >> 20);
+		}
+		if (store->bad_block_count) {
+			printf("  %"PRIu32" bad blocks:", store->bad_block_count);
+			for (pb_size_t i = 0; i < store->bad_blocks_count; i++) {
+				printf(" %"PRIu32, store->bad_blocks[i]);
+			}
+			printf("%s\n", store->bad_blocks_count < store->bad_block_count ? " ..." : "");
+		}
 		return true;
 	}
 
@@ -60,9 +86,29 @@ static int export_blocks(struct slash *slash)
 	    path = slash->argv[5];
     }
 
+    uint32_t block_size;
+    int res = store_block_size(name, path, &block_size);
+    if (res) {
+    	return res;
+    }
+
+    // Blocks are padded to the block size of the store
+    uint8_t *record = calloc(1, block_size);
+    if (!record) {
+    	return SLASH_EINVAL;
+    }
+
     bool read_block_cb(eyeq_Block *block, void *context) {
     	FILE *f = (FILE *)context;
-    	return fwrite(block->data.bytes, BLOCK_LENGTH, 1, f) == 1;
+    	uint32_t size = block->data ? block->data->size : 0;
+    	if (size > block_size) {
+    		size = block_size;
+    	}
+    	if (size) {
+    		memcpy(record, block->data->bytes, size);
+    	}
+    	memset(record + size, 0, block_size - size);
+    	return fwrite(record, block_size, 1, f) == 1;
     }
 
     FILE *f;
@@ -72,6 +118,7 @@ static int export_blocks(struct slash *slash)
     	f = fopen(filename, "wb");
     	if (!f) {
     		fprintf(stderr, "Could not open %s for writing\n", filename);
+    		free(record);
     		return SLASH_EINVAL;
     	}
     }
@@ -80,14 +127,16 @@ static int export_blocks(struct slash *slash)
 
     while (count > 0) {
         int to_transfer = count > 100 ? 100 : count;
-        int res = eyeq_read_blocks(client, name, path, offset, to_transfer, read_block_cb, client->timeout_ms, f);
+        res = eyeq_read_blocks(client, name, path, offset, to_transfer, read_block_cb, client->timeout_ms, f);
         if (res) {
+            free(record);
             return res;
         }
         offset += to_transfer;
         count -= to_transfer;
     }
 	fclose(f);
+	free(record);
 
 	return 0;
 }
@@ -109,6 +158,12 @@ static int import_blocks(struct slash *slash)
 	    path = slash->argv[3];
     }
 
+    uint32_t block_size;
+    int res = store_block_size(name, path, &block_size);
+    if (res) {
+    	return res;
+    }
+
     FILE *f;
     if (!strcmp("-", filename)) {
     	f = stdout;
@@ -120,21 +175,38 @@ static int import_blocks(struct slash *slash)
     	}
     }
 
-    int r = 0;
-    eyeq_Block block;
-	// block_t *bl = (block_t *)block.data.bytes;
-    while ((r = fread(&block.data.bytes, BLOCK_LENGTH, 1, f)) > 0) {
-    	block.data.size = BLOCK_LENGTH;
-		int res = eyeq_write_block(client, name, path, &block, -1, NULL);
+    eyeq_Block blocks[EYEQ_WRITE_BLOCKS_MAX];
+    uint8_t *buffer = malloc(EYEQ_WRITE_BLOCKS_MAX * PB_BYTES_ARRAY_T_ALLOCSIZE(block_size));
+    if (!buffer) {
+    	fclose(f);
+    	return SLASH_EINVAL;
+    }
+    for (uint32_t i = 0; i < EYEQ_WRITE_BLOCKS_MAX; i++) {
+    	blocks[i].data = (pb_bytes_array_t *)(buffer + i * PB_BYTES_ARRAY_T_ALLOCSIZE(block_size));
+    	blocks[i].data->size = block_size;
+    }
+
+    uint32_t count = 0;
+    // Send the blocks in batches, the server writes each batch with a single store write
+    while (fread(blocks[count].data->bytes, block_size, 1, f) > 0) {
+    	if (++count < EYEQ_WRITE_BLOCKS_MAX) {
+    		continue;
+    	}
+		res = eyeq_write_blocks(client, name, path, blocks, count, -1, NULL);
+		count = 0;
 		if (res) {
-			fclose(f);
-			return res;
+			break;
 		}
     }
 
+    if (!res && count > 0) {
+		res = eyeq_write_blocks(client, name, path, blocks, count, -1, NULL);
+    }
+
 	fclose(f);
+	free(buffer);
 
-	return SLASH_SUCCESS;
+	return res ? res : SLASH_SUCCESS;
 }
 slash_command(import_blocks, import_blocks, "<name> <filename> [path]", "Import blocks");
 
@@ -221,12 +293,45 @@ static int seek_stream(struct slash *slash)
 }
 slash_command(seek_stream, seek_stream, "<name> <block_id> [path]", "Seek in stream");
 
+static int seek_stream_time(struct slash *slash)
+{
+    char *path = "";
+    char *name;
+
+    if (slash->argc < 3) {
+    	return SLASH_EUSAGE;
+    }
+
+    name = slash->argv[1];
+    double timestamp = strtod(slash->argv[2], NULL);
+    uint64_t sec = (uint64_t)timestamp;
+    uint32_t nsec = (uint32_t)((timestamp - sec) * 1e9);
+
+    if (slash->argc > 3) {
+	    path = slash->argv[3];
+    }
+
+	return eyeq_seek_stream_time(client, name, path, sec, nsec);
+}
+slash_command(seek_stream_time, seek_stream_time, "<name> <unix_time> [path]", "Seek in stream to a time");
+
 
 static int create_store(struct slash *slash)
 {
     char *path, *name;
     char *filename = "";
     int store_type = 0;
+    int codec = 0;
+    uint32_t hot_count = 0;
+    bool verify_crc = false;
+    uint32_t scrub_rate = 0;
+    int durability = 0;
+    uint32_t sync_interval_ms = 0;
+    uint32_t sync_blocks = 0;
+    uint32_t ingest_queue = 0;
+    bool hugepages = false;
+    int numa_node = -1;
+    uint32_t block_size = 0;
 
     if (slash->argc < 4) {
     	return SLASH_EUSAGE;
@@ -244,10 +349,66 @@ static int create_store(struct slash *slash)
 	    filename = slash->argv[5];
     }
 
+    if (slash->argc > 6) {
+	    codec = strtoul(slash->argv[6], NULL, 10);
+    }
+
+    if (slash->argc > 7) {
+	    hot_count = strtoul(slash->argv[7], NULL, 10);
+    }
+
+    if (slash->argc > 8) {
+	    verify_crc = strtoul(slash->argv[8], NULL, 10);
+    }
+
+    if (slash->argc > 9) {
+	    scrub_rate = strtoul(slash->argv[9], NULL, 10);
+    }
+
+    if (slash->argc > 10) {
+	    durability = strtoul(slash->argv[10], NULL, 10);
+    }
+
+    if (slash->argc > 11) {
+	    sync_interval_ms = strtoul(slash->argv[11], NULL, 10);
+    }
+
+    if (slash->argc > 12) {
+	    sync_blocks = strtoul(slash->argv[12], NULL, 10);
+    }
+
+    if (slash->argc > 13) {
+	    ingest_queue = strtoul(slash->argv[13], NULL, 10);
+    }
+
+    if (slash->argc > 14) {
+	    hugepages = strtoul(slash->argv[14], NULL, 10);
+    }
+
+    if (slash->argc > 15) {
+	    numa_node = strtol(slash->argv[15], NULL, 10);
+    }
+
+    if (slash->argc > 16) {
+	    block_size = strtoul(slash->argv[16], NULL, 10);
+    }
+
     eyeq_Store store = {
 	    .store_type = store_type,
+	    .codec = codec,
+	    .hot_block_count = hot_count,
+	    .verify_crc = verify_crc,
+	    .scrub_rate = scrub_rate,
+	    .durability = durability,
+	    .sync_interval_ms = sync_interval_ms,
+	    .sync_blocks = sync_blocks,
+	    .ingest_queue_blocks = ingest_queue,
+	    .hugepages = hugepages,
+	    .numa_bind = numa_node >= 0,
+	    .numa_node = numa_node >= 0 ? numa_node : 0,
 	    .block_count = count,
 	    .block_offset = 0,
+	    .block_size = block_size,
     };
 
     strncpy(store.name, name, MAX_NAME-1);
@@ -259,7 +420,7 @@ static int create_store(struct slash *slash)
 
 	return eyeq_create_store(client, &store);
 }
-slash_command(create_store, create_store, "<name> <path> <count> [store_type] [filename]", "Create store");
+slash_command(create_store, create_store, "<name> <path> <count> [store_type] [filename] [codec] [hot_count] [verify_crc] [scrub_rate] [durability] [sync_interval_ms] [sync_blocks] [ingest_queue] [hugepages] [numa_node] [block_size]", "Create store");
 
 
 #include "filters.h"
@@ -294,6 +455,12 @@ static int create_stream(struct slash *slash)
 	    filter_type = strtoul(slash->argv[8], NULL, 10);
     }
 
+    // Keep every decimation-th filtered sample
+    uint32_t decimation = 1;
+    if (slash->argc > 9) {
+	    decimation = strtoul(slash->argv[9], NULL, 10);
+    }
+
     const float *filter = NULL;
     int ntaps = 0;
 
@@ -314,9 +481,9 @@ static int create_stream(struct slash *slash)
    		break;
     }
 
-	return eyeq_create_frequency_filter_stream(client, name, path, store_name, store_path, start_block, block_count, relative_freq, filter, ntaps);
+	return eyeq_create_resampled_stream(client, name, path, store_name, store_path, start_block, block_count, relative_freq, filter, ntaps, 1, decimation);
 }
-slash_command(create_stream, create_stream, "<name> <path> <store_name> <store_path> <start_block> <block_count> [relative_freq] [filter_type]", "Create filtered stream");
+slash_command(create_stream, create_stream, "<name> <path> <store_name> <store_path> <start_block> <block_count> [relative_freq] [filter_type] [decimation]", "Create filtered stream");
 
 static int delete_store(struct slash *slash)
 {
@@ -335,6 +502,111 @@ static int delete_store(struct slash *slash)
 }
 slash_command(delete_store, delete_store, "<name> [path]", "Delete store");
 
+static int snapshot_store(struct slash *slash)
+{
+    if (slash->argc < 5) {
+    	return SLASH_EUSAGE;
+    }
+
+    char *name = slash->argv[1];
+    char *snapshot_name = slash->argv[2];
+    uint32_t start_block = strtoul(slash->argv[3], NULL, 10);
+    uint32_t block_count = strtoul(slash->argv[4], NULL, 10);
+    char *file_path = "";
+    char *path = "";
+
+    if (slash->argc > 5) {
+    	file_path = slash->argv[5];
+    }
+    if (slash->argc > 6) {
+    	path = slash->argv[6];
+    }
+
+	return eyeq_snapshot_store(client, name, path, snapshot_name, path, file_path, start_block, block_count, NULL);
+}
+slash_command(snapshot_store, snapshot_store, "<name> <snapshot_name> <start_block> <block_count> [filename] [path]", "Freeze blocks of a store as a read-only store");
+
+static int query_blocks(struct slash *slash)
+{
+    if (slash->argc < 3) {
+    	return SLASH_EUSAGE;
+    }
+
+    char *name = slash->argv[1];
+    char *path = "";
+    eyeq_QueryBlocks query = { 0 };
+
+    // "-" matches any source
+    if (strcmp(slash->argv[2], "-")) {
+    	query.match_source_id = true;
+    	query.source_id = strtoul(slash->argv[2], NULL, 10);
+    }
+    if (slash->argc > 4) {
+    	query.match_frequency = true;
+    	query.min_frequency = strtof(slash->argv[3], NULL);
+    	query.max_frequency = strtof(slash->argv[4], NULL);
+    }
+    if (slash->argc > 5) {
+    	path = slash->argv[5];
+    }
+
+	bool query_blocks_cb(eyeq_QueryBlocks_Run *run, void *context) {
+		printf("* %"PRIu32" - %"PRIu32" (%"PRIu32" blocks)\n", run->start_block, run->start_block + run->block_count - 1, run->block_count);
+		return true;
+	}
+
+	return eyeq_query_blocks(client, name, path, &query, query_blocks_cb, NULL);
+}
+slash_command(query_blocks, query_blocks, "<name> <source_id|-> [min_frequency] [max_frequency] [path]", "Find blocks by source and frequency");
+
+static int block_stats(struct slash *slash)
+{
+    if (slash->argc < 2) {
+    	return SLASH_EUSAGE;
+    }
+
+    char *name = slash->argv[1];
+    uint32_t start_block = 0;
+    uint32_t stride = 1;
+    char *path = "";
+
+    if (slash->argc > 2) {
+    	start_block = strtoul(slash->argv[2], NULL, 10);
+    }
+    if (slash->argc > 3) {
+    	stride = strtoul(slash->argv[3], NULL, 10);
+    }
+    if (slash->argc > 4) {
+    	path = slash->argv[4];
+    }
+
+    eyeq_BlockStats_Response *stats = malloc(sizeof(eyeq_BlockStats_Response));
+    if (!stats) {
+    	return SLASH_EINVAL;
+    }
+
+    int res = eyeq_block_stats(client, name, path, start_block, stride, stats);
+    if (res == EYEQ_OK) {
+    	printf("%10s %10s %10s %10s %10s %8s\n", "block", "power dBFS", "peak dBFS", "dc i", "dc q", "clipped");
+    	for (pb_size_t i = 0; i < stats->mean_power_count; i++) {
+    		printf("%10"PRIu32" %10.1f %10.1f %10.4f %10.4f %8"PRIu32"\n", stats->start_block + i * stats->stride,
+    		       10 * log10f(stats->mean_power[i]), 20 * log10f(stats->peak_magnitude[i]), stats->dc_i[i], stats->dc_q[i],
+    		       stats->clip_count[i]);
+    	}
+    }
+    free(stats);
+
+    return res;
+}
+slash_command(block_stats, block_stats, "<name> [start_block] [stride] [path]", "Show power, peaks, DC offset and clipping of blocks");
+
+
+static int flush_stores(struct slash *slash)
+{
+	return eyeq_flush_stores(client);
+}
+slash_command(flush_stores, flush_stores, "", "Sync stores and save the store list");
+
 
 static int close_stream(struct slash *slash)
 {
@@ -398,15 +670,12 @@ static int import_samples(struct slash *slash)
 
     if (!strcmp("float",  slash->argv[4])) {
         output_type = BLOCK_TYPE_F32_SAMPLES;
-        block_item_count = BLOCK_F32_SAMPLES;
         output_item_size = 4;
     } else if (!strcmp("int16",  slash->argv[4])) {
         output_type = BLOCK_TYPE_I16_SAMPLES;
-        block_item_count = BLOCK_I16_SAMPLES;
         output_item_size = 2;
     } else if (!strcmp("int8",  slash->argv[4])) {
         output_type = BLOCK_TYPE_I8_SAMPLES;
-        block_item_count = BLOCK_I8_SAMPLES;
         output_item_size = 1;
     } else {
         fprintf(stderr, "Unknown output type '%s'\n",  slash->argv[4]);
@@ -421,6 +690,14 @@ static int import_samples(struct slash *slash)
         path = slash->argv[6];
     }
 
+    // Blocks are filled up to the block size of the store
+    uint32_t block_size;
+    int res = store_block_size(name, path, &block_size);
+    if (res) {
+        return res;
+    }
+    block_item_count = block_payload_size(block_size) / output_item_size;
+
     FILE *f;
     if (!strcmp("-", filename)) {
         f = stdout;
@@ -433,11 +710,19 @@ static int import_samples(struct slash *slash)
     }
 
     uint8_t *input_buffer = calloc(block_item_count, input_item_size);
+    pb_bytes_array_t *data = calloc(1, PB_BYTES_ARRAY_T_ALLOCSIZE(block_size));
+    if (!input_buffer || !data) {
+        free(input_buffer);
+        free(data);
+        fclose(f);
+        return SLASH_EINVAL;
+    }
 
     int r = 0;
-    eyeq_Block block;
+    eyeq_Block block = { .data = data };
 
-    block_t *bl = (block_t *)block.data.bytes;
+    block_t *bl = (block_t *)data->bytes;
+    void *samples = block_payload(bl);
     while ((r = fread(input_buffer, input_item_size, block_item_count, f)) > 0) {
         for (int i = 0; i < r; i++) {
             double item = 0;
@@ -455,29 +740,31 @@ static int import_samples(struct slash *slash)
 
             switch (output_type) {
             case BLOCK_TYPE_F32_SAMPLES:
-                bl->data.f32_samples[i] = item * scale;
+                ((float *)samples)[i] = item * scale;
                 break;
             case BLOCK_TYPE_I16_SAMPLES:
-                bl->data.i16_samples[i] = item * scale;
+                ((int16_t *)samples)[i] = item * scale;
                 break;
             case BLOCK_TYPE_I8_SAMPLES:
-                bl->data.i8_samples[i] = item * scale;
+                ((int8_t *)samples)[i] = item * scale;
                 break;
             }
         }
         bl->hdr.block_type = output_type;
-        bl->hdr.block_length = BLOCK_HEADER_LENGTH + block_item_count * output_item_size;
-        block.data.size = bl->hdr.block_length;
+        block_set_length(bl, BLOCK_HEADER_LENGTH + block_item_count * output_item_size);
+        data->size = block_get_length(bl);
 
-        int res = eyeq_write_block(client, name, path, &block, -1, NULL);
+        res = eyeq_write_block(client, name, path, &block, -1, NULL);
         if (res) {
             free(input_buffer);
+            free(data);
             fclose(f);
             return res;
         }
     }
 
     free(input_buffer);
+    free(data);
     fclose(f);
 
     return SLASH_SUCCESS;
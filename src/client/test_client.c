@@ -12,10 +12,11 @@ void tearDown(void) {
 
 void preclean() {
 	eyeq_delete_store(client, "TEST", "client-test");
+	eyeq_delete_store(client, "TEST", "client-test-codec");
 }
 
 void test_create_store() {
-	eyeq_Store store;
+	eyeq_Store store = { 0 };
 	int resp = eyeq_find_store(client, "TEST", "client-test", &store);
 	TEST_ASSERT_EQUAL_INT(EYEQ_NOT_FOUND, resp);
 
@@ -35,9 +36,10 @@ void test_create_store() {
 
 void test_write_blocks() {
 	for (int j = 0; j < 100; j++) {
-		eyeq_Block block = { 0 };
-		block_t *bt = (block_t *)&block.data.bytes;
-		block.data.size = BLOCK_LENGTH;
+		uint8_t data[PB_BYTES_ARRAY_T_ALLOCSIZE(BLOCK_LENGTH)] = { 0 };
+		eyeq_Block block = { .data = (pb_bytes_array_t *)data };
+		block_t *bt = (block_t *)block.data->bytes;
+		block.data->size = BLOCK_LENGTH;
 
 		bt->hdr.block_length = BLOCK_LENGTH;
 
@@ -56,7 +58,8 @@ void test_read_blocks() {
 	int j = 0;
 
 	bool read_block_callback(eyeq_Block *block, void *context) {
-		block_t *bt = (block_t *)&block->data.bytes;
+		TEST_ASSERT_EQUAL_INT(BLOCK_LENGTH, block->data->size);
+		block_t *bt = (block_t *)block->data->bytes;
 		TEST_ASSERT_EQUAL_INT(j, bt->hdr.block_id);
 
 		int16_t reference[BLOCK_I16_SAMPLES];
@@ -77,6 +80,57 @@ void test_read_blocks() {
 	TEST_ASSERT_EQUAL_INT(100, j);
 }
 
+// Only the sample blocks are compressed, so the server maps every other block and reads the
+// rest, across more than one read batch
+void test_read_mixed_blocks() {
+	eyeq_Store store = { 0 };
+	strcpy(store.name, "TEST");
+	strcpy(store.path, "client-test-codec");
+	store.block_count = 128;
+	store.store_type = MEMORY_STORE;
+	store.codec = eyeq_StoreCodec_DELTA_CODEC;
+	TEST_ASSERT_EQUAL_INT(EYEQ_OK, eyeq_create_store(client, &store));
+
+	for (int j = 0; j < 100; j++) {
+		uint8_t data[PB_BYTES_ARRAY_T_ALLOCSIZE(BLOCK_LENGTH)] = { 0 };
+		eyeq_Block block = { .data = (pb_bytes_array_t *)data };
+		block_t *bt = (block_t *)block.data->bytes;
+		block.data->size = BLOCK_LENGTH;
+
+		bt->hdr.block_length = BLOCK_LENGTH;
+		bt->hdr.block_type = j % 2 ? BLOCK_TYPE_I16_SAMPLES : 0;
+
+		for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
+			bt->data.i16_samples[i] = i + j;
+		}
+
+		TEST_ASSERT_EQUAL_INT(EYEQ_OK, eyeq_write_block(client, "TEST", "client-test-codec", &block, -1, NULL));
+	}
+
+	int j = 0;
+
+	bool read_block_callback(eyeq_Block *block, void *context) {
+		block_t *bt = (block_t *)block->data->bytes;
+		TEST_ASSERT_EQUAL_INT(j, bt->hdr.block_id);
+
+		int16_t reference[BLOCK_I16_SAMPLES];
+
+		for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
+			reference[i] = i + j;
+		}
+
+		TEST_ASSERT_EQUAL_INT16_ARRAY(reference, bt->data.i16_samples, BLOCK_I16_SAMPLES);
+
+		j++;
+
+		return true;
+	}
+
+	int resp = eyeq_read_blocks(client, "TEST", "client-test-codec", 0, 100, read_block_callback, 2000, NULL);
+	TEST_ASSERT_EQUAL_INT(EYEQ_OK, resp);
+	TEST_ASSERT_EQUAL_INT(100, j);
+}
+
 int main(int argc, char *argv[]) {
     UNITY_BEGIN();
 
@@ -89,6 +143,7 @@ int main(int argc, char *argv[]) {
     RUN_TEST(test_create_store);
     RUN_TEST(test_write_blocks);
     RUN_TEST(test_read_blocks);
+    RUN_TEST(test_read_mixed_blocks);
 
     eyeq_close(client);
     eyeq_destroy_context(eyeq_ctx);
@@ -1,5 +1,5 @@
 /* Automatically generated nanopb constant definitions */
-/* Generated by nanopb-0.3.9.5 at Wed Jul 14 14:23:13 2021. */
+/* Generated by nanopb-0.3.9.5 at Sun Oct 18 05:52:09 2026. */
 
 #include "samples.pb.h"
 
@@ -10,7 +10,7 @@
 
 
 
-const pb_field_t eyeq_ServerRequest_fields[14] = {
+const pb_field_t eyeq_ServerRequest_fields[17] = {
     PB_ONEOF_FIELD(req,   1, MESSAGE , ONEOF, STATIC  , FIRST, eyeq_ServerRequest, create_store, create_store, &eyeq_CreateStore_fields),
     PB_ONEOF_FIELD(req,   2, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, list_stores, list_stores, &eyeq_ListStores_fields),
     PB_ONEOF_FIELD(req,   3, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, delete_store, delete_store, &eyeq_DeleteStore_fields),
@@ -23,11 +23,14 @@ const pb_field_t eyeq_ServerRequest_fields[14] = {
     PB_ONEOF_FIELD(req,  11, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, close_stream, close_stream, &eyeq_CloseStream_fields),
     PB_ONEOF_FIELD(req,  12, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, stream_info, stream_info, &eyeq_StreamInfo_fields),
     PB_ONEOF_FIELD(req,  13, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, list_streams, list_streams, &eyeq_ListStreams_fields),
-    PB_FIELD(  7, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_ServerRequest, req_id, req.list_streams, 0),
+    PB_ONEOF_FIELD(req,  14, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, snapshot_store, snapshot_store, &eyeq_SnapshotStore_fields),
+    PB_ONEOF_FIELD(req,  15, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, query_blocks, query_blocks, &eyeq_QueryBlocks_fields),
+    PB_ONEOF_FIELD(req,  16, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerRequest, block_stats, block_stats, &eyeq_BlockStats_fields),
+    PB_FIELD(  7, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_ServerRequest, req_id, req.block_stats, 0),
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_ServerResponse_fields[15] = {
+const pb_field_t eyeq_ServerResponse_fields[18] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_ServerResponse, error, error, 0),
     PB_ONEOF_FIELD(resp,   2, MESSAGE , ONEOF, STATIC  , OTHER, eyeq_ServerResponse, create_store_response, error, &eyeq_CreateStore_Response_fields),
     PB_ONEOF_FIELD(resp,   3, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, list_stores_response, error, &eyeq_ListStores_Response_fields),
@@ -41,17 +44,37 @@ const pb_field_t eyeq_ServerResponse_fields[15] = {
     PB_ONEOF_FIELD(resp,  12, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, close_stream_response, error, &eyeq_CloseStream_Response_fields),
     PB_ONEOF_FIELD(resp,  13, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, stream_info_response, error, &eyeq_StreamInfo_Response_fields),
     PB_ONEOF_FIELD(resp,  14, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, list_streams_response, error, &eyeq_ListStreams_Response_fields),
-    PB_FIELD(  8, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_ServerResponse, req_id, resp.list_streams_response, 0),
+    PB_ONEOF_FIELD(resp,  15, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, snapshot_store_response, error, &eyeq_SnapshotStore_Response_fields),
+    PB_ONEOF_FIELD(resp,  16, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, query_blocks_response, error, &eyeq_QueryBlocks_Response_fields),
+    PB_ONEOF_FIELD(resp,  17, MESSAGE , ONEOF, STATIC  , UNION, eyeq_ServerResponse, block_stats_response, error, &eyeq_BlockStats_Response_fields),
+    PB_FIELD(  8, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_ServerResponse, req_id, resp.block_stats_response, 0),
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_Store_fields[7] = {
+const pb_field_t eyeq_Store_fields[24] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_Store, name, name, 0),
     PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_Store, path, name, 0),
     PB_FIELD(  3, UENUM   , SINGULAR, STATIC  , OTHER, eyeq_Store, store_type, path, 0),
     PB_FIELD(  4, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, block_count, store_type, 0),
     PB_FIELD(  5, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, block_offset, block_count, 0),
     PB_FIELD(  6, STRING  , SINGULAR, STATIC  , OTHER, eyeq_Store, file_path, block_offset, 0),
+    PB_FIELD(  7, UENUM   , SINGULAR, STATIC  , OTHER, eyeq_Store, codec, file_path, 0),
+    PB_FIELD(  8, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, hot_block_count, codec, 0),
+    PB_FIELD(  9, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_Store, verify_crc, hot_block_count, 0),
+    PB_FIELD( 10, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, scrub_rate, verify_crc, 0),
+    PB_FIELD( 11, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, bad_block_count, scrub_rate, 0),
+    PB_FIELD( 12, UINT32  , REPEATED, STATIC  , OTHER, eyeq_Store, bad_blocks, bad_block_count, 0),
+    PB_FIELD( 13, UENUM   , SINGULAR, STATIC  , OTHER, eyeq_Store, durability, bad_blocks, 0),
+    PB_FIELD( 14, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, sync_interval_ms, durability, 0),
+    PB_FIELD( 15, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, sync_blocks, sync_interval_ms, 0),
+    PB_FIELD( 16, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, ingest_queue_blocks, sync_blocks, 0),
+    PB_FIELD( 17, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_Store, hugepages, ingest_queue_blocks, 0),
+    PB_FIELD( 18, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_Store, numa_bind, hugepages, 0),
+    PB_FIELD( 19, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, numa_node, numa_bind, 0),
+    PB_FIELD( 20, UINT64  , SINGULAR, STATIC  , OTHER, eyeq_Store, reserved_bytes, numa_node, 0),
+    PB_FIELD( 21, UINT64  , SINGULAR, STATIC  , OTHER, eyeq_Store, resident_bytes, reserved_bytes, 0),
+    PB_FIELD( 22, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_Store, block_size, resident_bytes, 0),
+    PB_FIELD( 23, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_Store, read_only, block_size, 0),
     PB_LAST_FIELD
 };
 
@@ -65,13 +88,17 @@ const pb_field_t eyeq_CreateStore_Response_fields[2] = {
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_ListStores_fields[2] = {
+const pb_field_t eyeq_ListStores_fields[4] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_ListStores, path, path, 0),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStores, after_path, path, 0),
+    PB_FIELD(  3, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStores, after_name, after_path, 0),
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_ListStores_Response_fields[2] = {
+const pb_field_t eyeq_ListStores_Response_fields[4] = {
     PB_FIELD(  1, MESSAGE , REPEATED, STATIC  , FIRST, eyeq_ListStores_Response, stores, stores, &eyeq_Store_fields),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStores_Response, next_path, stores, 0),
+    PB_FIELD(  3, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStores_Response, next_name, next_path, 0),
     PB_LAST_FIELD
 };
 
@@ -86,6 +113,22 @@ const pb_field_t eyeq_DeleteStore_Response_fields[2] = {
     PB_LAST_FIELD
 };
 
+const pb_field_t eyeq_SnapshotStore_fields[8] = {
+    PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_SnapshotStore, name, name, 0),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_SnapshotStore, path, name, 0),
+    PB_FIELD(  3, STRING  , SINGULAR, STATIC  , OTHER, eyeq_SnapshotStore, snapshot_name, path, 0),
+    PB_FIELD(  4, STRING  , SINGULAR, STATIC  , OTHER, eyeq_SnapshotStore, snapshot_path, snapshot_name, 0),
+    PB_FIELD(  5, STRING  , SINGULAR, STATIC  , OTHER, eyeq_SnapshotStore, file_path, snapshot_path, 0),
+    PB_FIELD(  6, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_SnapshotStore, start_block, file_path, 0),
+    PB_FIELD(  7, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_SnapshotStore, block_count, start_block, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t eyeq_SnapshotStore_Response_fields[2] = {
+    PB_FIELD(  1, MESSAGE , SINGULAR, STATIC  , FIRST, eyeq_SnapshotStore_Response, store, store, &eyeq_Store_fields),
+    PB_LAST_FIELD
+};
+
 const pb_field_t eyeq_FlushStores_fields[1] = {
     PB_LAST_FIELD
 };
@@ -102,15 +145,16 @@ const pb_field_t eyeq_Timestamp_fields[3] = {
 };
 
 const pb_field_t eyeq_Block_fields[2] = {
-    PB_FIELD(  1, BYTES   , SINGULAR, STATIC  , FIRST, eyeq_Block, data, data, 0),
+    PB_FIELD(  1, BYTES   , SINGULAR, POINTER , FIRST, eyeq_Block, data, data, 0),
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_WriteBlock_fields[5] = {
+const pb_field_t eyeq_WriteBlock_fields[6] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_WriteBlock, name, name, 0),
     PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_WriteBlock, path, name, 0),
     PB_FIELD(  3, INT32   , SINGULAR, STATIC  , OTHER, eyeq_WriteBlock, offset, path, 0),
     PB_FIELD(  4, MESSAGE , SINGULAR, STATIC  , OTHER, eyeq_WriteBlock, block, offset, &eyeq_Block_fields),
+    PB_FIELD(  5, MESSAGE , REPEATED, STATIC  , OTHER, eyeq_WriteBlock, blocks, block, &eyeq_Block_fields),
     PB_LAST_FIELD
 };
 
@@ -119,11 +163,12 @@ const pb_field_t eyeq_WriteBlock_Response_fields[2] = {
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_ReadBlocks_fields[5] = {
+const pb_field_t eyeq_ReadBlocks_fields[6] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_ReadBlocks, name, name, 0),
     PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ReadBlocks, path, name, 0),
     PB_FIELD(  3, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_ReadBlocks, offset, path, 0),
     PB_FIELD(  4, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_ReadBlocks, count, offset, 0),
+    PB_FIELD(  5, MESSAGE , SINGULAR, STATIC  , OTHER, eyeq_ReadBlocks, time, count, &eyeq_Timestamp_fields),
     PB_LAST_FIELD
 };
 
@@ -132,6 +177,60 @@ const pb_field_t eyeq_ReadBlocks_Response_fields[2] = {
     PB_LAST_FIELD
 };
 
+const pb_field_t eyeq_QueryBlocks_fields[19] = {
+    PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_QueryBlocks, name, name, 0),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, path, name, 0),
+    PB_FIELD(  3, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, match_source_id, path, 0),
+    PB_FIELD(  4, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, source_id, match_source_id, 0),
+    PB_FIELD(  5, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, match_block_type, source_id, 0),
+    PB_FIELD(  6, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, block_type, match_block_type, 0),
+    PB_FIELD(  7, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, match_frequency, block_type, 0),
+    PB_FIELD(  8, FLOAT   , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, min_frequency, match_frequency, 0),
+    PB_FIELD(  9, FLOAT   , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, max_frequency, min_frequency, 0),
+    PB_FIELD( 10, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, match_sample_rate, max_frequency, 0),
+    PB_FIELD( 11, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, min_sample_rate, match_sample_rate, 0),
+    PB_FIELD( 12, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, max_sample_rate, min_sample_rate, 0),
+    PB_FIELD( 13, MESSAGE , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, start_time, max_sample_rate, &eyeq_Timestamp_fields),
+    PB_FIELD( 14, MESSAGE , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, end_time, start_time, &eyeq_Timestamp_fields),
+    PB_FIELD( 15, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, start_block, end_time, 0),
+    PB_FIELD( 16, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, match_power, start_block, 0),
+    PB_FIELD( 17, FLOAT   , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, min_power_db, match_power, 0),
+    PB_FIELD( 18, FLOAT   , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks, max_power_db, min_power_db, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t eyeq_QueryBlocks_Run_fields[3] = {
+    PB_FIELD(  1, UINT32  , SINGULAR, STATIC  , FIRST, eyeq_QueryBlocks_Run, start_block, start_block, 0),
+    PB_FIELD(  2, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks_Run, block_count, start_block, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t eyeq_QueryBlocks_Response_fields[4] = {
+    PB_FIELD(  1, MESSAGE , REPEATED, STATIC  , FIRST, eyeq_QueryBlocks_Response, runs, runs, &eyeq_QueryBlocks_Run_fields),
+    PB_FIELD(  2, BOOL    , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks_Response, more, runs, 0),
+    PB_FIELD(  3, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_QueryBlocks_Response, next_block, more, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t eyeq_BlockStats_fields[5] = {
+    PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_BlockStats, name, name, 0),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_BlockStats, path, name, 0),
+    PB_FIELD(  3, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_BlockStats, start_block, path, 0),
+    PB_FIELD(  4, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_BlockStats, stride, start_block, 0),
+    PB_LAST_FIELD
+};
+
+const pb_field_t eyeq_BlockStats_Response_fields[8] = {
+    PB_FIELD(  1, UINT32  , SINGULAR, STATIC  , FIRST, eyeq_BlockStats_Response, start_block, start_block, 0),
+    PB_FIELD(  2, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_BlockStats_Response, stride, start_block, 0),
+    PB_FIELD(  3, FLOAT   , REPEATED, STATIC  , OTHER, eyeq_BlockStats_Response, mean_power, stride, 0),
+    PB_FIELD(  4, FLOAT   , REPEATED, STATIC  , OTHER, eyeq_BlockStats_Response, peak_magnitude, mean_power, 0),
+    PB_FIELD(  5, FLOAT   , REPEATED, STATIC  , OTHER, eyeq_BlockStats_Response, dc_i, peak_magnitude, 0),
+    PB_FIELD(  6, FLOAT   , REPEATED, STATIC  , OTHER, eyeq_BlockStats_Response, dc_q, dc_i, 0),
+    PB_FIELD(  7, UINT32  , REPEATED, STATIC  , OTHER, eyeq_BlockStats_Response, clip_count, dc_q, 0),
+    PB_LAST_FIELD
+};
+
 const pb_field_t eyeq_StoreReaderStream_fields[5] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_StoreReaderStream, name, name, 0),
     PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_StoreReaderStream, path, name, 0),
@@ -153,9 +252,11 @@ const pb_field_t eyeq_ConstMultiplyStream_fields[4] = {
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_FirFilterStream_fields[3] = {
+const pb_field_t eyeq_FirFilterStream_fields[5] = {
     PB_FIELD(  1, BOOL    , SINGULAR, STATIC  , FIRST, eyeq_FirFilterStream, is_complex, is_complex, 0),
-    PB_FIELD(  2, FLOAT   , REPEATED, STATIC  , OTHER, eyeq_FirFilterStream, filter_taps, is_complex, 0),
+    PB_FIELD(  2, FLOAT   , REPEATED, POINTER , OTHER, eyeq_FirFilterStream, filter_taps, is_complex, 0),
+    PB_FIELD(  3, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_FirFilterStream, interpolation, filter_taps, 0),
+    PB_FIELD(  4, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_FirFilterStream, decimation, interpolation, 0),
     PB_LAST_FIELD
 };
 
@@ -211,10 +312,11 @@ const pb_field_t eyeq_ReadStream_Response_fields[5] = {
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_SeekStream_fields[4] = {
+const pb_field_t eyeq_SeekStream_fields[5] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_SeekStream, name, name, 0),
     PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_SeekStream, path, name, 0),
     PB_FIELD(  3, UINT32  , SINGULAR, STATIC  , OTHER, eyeq_SeekStream, block_id, path, 0),
+    PB_FIELD(  4, MESSAGE , SINGULAR, STATIC  , OTHER, eyeq_SeekStream, time, block_id, &eyeq_Timestamp_fields),
     PB_LAST_FIELD
 };
 
@@ -248,13 +350,17 @@ const pb_field_t eyeq_StreamInfo_Response_fields[5] = {
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_ListStreams_fields[2] = {
+const pb_field_t eyeq_ListStreams_fields[4] = {
     PB_FIELD(  1, STRING  , SINGULAR, STATIC  , FIRST, eyeq_ListStreams, path, path, 0),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStreams, after_path, path, 0),
+    PB_FIELD(  3, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStreams, after_name, after_path, 0),
     PB_LAST_FIELD
 };
 
-const pb_field_t eyeq_ListStreams_Response_fields[2] = {
+const pb_field_t eyeq_ListStreams_Response_fields[4] = {
     PB_FIELD(  1, MESSAGE , REPEATED, STATIC  , FIRST, eyeq_ListStreams_Response, streams, streams, &eyeq_Stream_fields),
+    PB_FIELD(  2, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStreams_Response, next_path, streams, 0),
+    PB_FIELD(  3, STRING  , SINGULAR, STATIC  , OTHER, eyeq_ListStreams_Response, next_name, next_path, 0),
     PB_LAST_FIELD
 };
 
@@ -269,11 +375,11 @@ const pb_field_t eyeq_ListStreams_Response_fields[2] = {
  * numbers or field sizes that are larger than what can fit in 8 or 16 bit
  * field descriptors.
  */
-PB_STATIC_ASSERT((pb_membersize(eyeq_ServerRequest, req.create_store) < 65536 && pb_membersize(eyeq_ServerRequest, req.list_stores) < 65536 && pb_membersize(eyeq_ServerRequest, req.delete_store) < 65536 && pb_membersize(eyeq_ServerRequest, req.write_block) < 65536 && pb_membersize(eyeq_ServerRequest, req.read_blocks) < 65536 && pb_membersize(eyeq_ServerRequest, req.flush_stores) < 65536 && pb_membersize(eyeq_ServerRequest, req.create_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.read_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.seek_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.close_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.stream_info) < 65536 && pb_membersize(eyeq_ServerRequest, req.list_streams) < 65536 && pb_membersize(eyeq_ServerResponse, resp.create_store_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.list_stores_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.delete_store_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.write_block_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.read_blocks_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.flush_stores_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.create_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.read_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.seek_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.close_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.stream_info_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.list_streams_response) < 65536 && pb_membersize(eyeq_CreateStore, store) < 65536 && pb_membersize(eyeq_CreateStore_Response, store) < 65536 && pb_membersize(eyeq_ListStores_Response, stores[0]) < 65536 && pb_membersize(eyeq_Block, data) < 65536 && pb_membersize(eyeq_WriteBlock, block) < 65536 && pb_membersize(eyeq_ReadBlocks_Response, block) < 65536 && pb_membersize(eyeq_StreamLayer, layer.frequency_translate) < 65536 && pb_membersize(eyeq_StreamLayer, layer.const_multiply) < 65536 && pb_membersize(eyeq_StreamLayer, layer.fir_filter) < 65536 && pb_membersize(eyeq_StreamLayer, layer.abs_stream) < 65536 && pb_membersize(eyeq_StreamLayer, layer.log_stream) < 65536 && pb_membersize(eyeq_StreamLayer, layer.store_reader) < 65536 && pb_membersize(eyeq_CreateStream, stream) < 65536 && pb_membersize(eyeq_CreateStream, layers[0]) < 65536 && pb_membersize(eyeq_CreateStream_Response, stream) < 65536 && pb_membersize(eyeq_ReadStream_Response, ts) < 65536 && pb_membersize(eyeq_StreamInfo_Response, stream) < 65536 && pb_membersize(eyeq_ListStreams_Response, streams[0]) < 65536), YOU_MUST_DEFINE_PB_FIELD_32BIT_FOR_MESSAGES_eyeq_ServerRequest_eyeq_ServerResponse_eyeq_Store_eyeq_CreateStore_eyeq_CreateStore_Response_eyeq_ListStores_eyeq_ListStores_Response_eyeq_DeleteStore_eyeq_DeleteStore_Response_eyeq_FlushStores_eyeq_FlushStores_Response_eyeq_Timestamp_eyeq_Block_eyeq_WriteBlock_eyeq_WriteBlock_Response_eyeq_ReadBlocks_eyeq_ReadBlocks_Response_eyeq_StoreReaderStream_eyeq_FrequencyTranslateStream_eyeq_ConstMultiplyStream_eyeq_FirFilterStream_eyeq_AbsStream_eyeq_LogStream_eyeq_StreamLayer_eyeq_Stream_eyeq_CreateStream_eyeq_CreateStream_Response_eyeq_ReadStream_eyeq_ReadStream_Response_eyeq_SeekStream_eyeq_SeekStream_Response_eyeq_CloseStream_eyeq_CloseStream_Response_eyeq_StreamInfo_eyeq_StreamInfo_Response_eyeq_ListStreams_eyeq_ListStreams_Response)
+PB_STATIC_ASSERT((pb_membersize(eyeq_ServerRequest, req.create_store) < 65536 && pb_membersize(eyeq_ServerRequest, req.list_stores) < 65536 && pb_membersize(eyeq_ServerRequest, req.delete_store) < 65536 && pb_membersize(eyeq_ServerRequest, req.write_block) < 65536 && pb_membersize(eyeq_ServerRequest, req.read_blocks) < 65536 && pb_membersize(eyeq_ServerRequest, req.flush_stores) < 65536 && pb_membersize(eyeq_ServerRequest, req.create_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.read_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.seek_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.close_stream) < 65536 && pb_membersize(eyeq_ServerRequest, req.stream_info) < 65536 && pb_membersize(eyeq_ServerRequest, req.list_streams) < 65536 && pb_membersize(eyeq_ServerRequest, req.snapshot_store) < 65536 && pb_membersize(eyeq_ServerRequest, req.query_blocks) < 65536 && pb_membersize(eyeq_ServerRequest, req.block_stats) < 65536 && pb_membersize(eyeq_ServerResponse, resp.create_store_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.list_stores_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.delete_store_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.write_block_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.read_blocks_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.flush_stores_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.create_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.read_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.seek_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.close_stream_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.stream_info_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.list_streams_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.snapshot_store_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.query_blocks_response) < 65536 && pb_membersize(eyeq_ServerResponse, resp.block_stats_response) < 65536 && pb_membersize(eyeq_CreateStore, store) < 65536 && pb_membersize(eyeq_CreateStore_Response, store) < 65536 && pb_membersize(eyeq_ListStores_Response, stores[0]) < 65536 && pb_membersize(eyeq_SnapshotStore_Response, store) < 65536 && pb_membersize(eyeq_WriteBlock, block) < 65536 && pb_membersize(eyeq_WriteBlock, blocks[0]) < 65536 && pb_membersize(eyeq_ReadBlocks, time) < 65536 && pb_membersize(eyeq_ReadBlocks_Response, block) < 65536 && pb_membersize(eyeq_QueryBlocks, start_time) < 65536 && pb_membersize(eyeq_QueryBlocks, end_time) < 65536 && pb_membersize(eyeq_QueryBlocks_Response, runs[0]) < 65536 && pb_membersize(eyeq_StreamLayer, layer.frequency_translate) < 65536 && pb_membersize(eyeq_StreamLayer, layer.const_multiply) < 65536 && pb_membersize(eyeq_StreamLayer, layer.fir_filter) < 65536 && pb_membersize(eyeq_StreamLayer, layer.abs_stream) < 65536 && pb_membersize(eyeq_StreamLayer, layer.log_stream) < 65536 && pb_membersize(eyeq_StreamLayer, layer.store_reader) < 65536 && pb_membersize(eyeq_CreateStream, stream) < 65536 && pb_membersize(eyeq_CreateStream, layers[0]) < 65536 && pb_membersize(eyeq_CreateStream_Response, stream) < 65536 && pb_membersize(eyeq_ReadStream_Response, ts) < 65536 && pb_membersize(eyeq_SeekStream, time) < 65536 && pb_membersize(eyeq_StreamInfo_Response, stream) < 65536 && pb_membersize(eyeq_ListStreams_Response, streams[0]) < 65536), YOU_MUST_DEFINE_PB_FIELD_32BIT_FOR_MESSAGES_eyeq_ServerRequest_eyeq_ServerResponse_eyeq_Store_eyeq_CreateStore_eyeq_CreateStore_Response_eyeq_ListStores_eyeq_ListStores_Response_eyeq_DeleteStore_eyeq_DeleteStore_Response_eyeq_SnapshotStore_eyeq_SnapshotStore_Response_eyeq_FlushStores_eyeq_FlushStores_Response_eyeq_Timestamp_eyeq_Block_eyeq_WriteBlock_eyeq_WriteBlock_Response_eyeq_ReadBlocks_eyeq_ReadBlocks_Response_eyeq_QueryBlocks_eyeq_QueryBlocks_Run_eyeq_QueryBlocks_Response_eyeq_BlockStats_eyeq_BlockStats_Response_eyeq_StoreReaderStream_eyeq_FrequencyTranslateStream_eyeq_ConstMultiplyStream_eyeq_FirFilterStream_eyeq_AbsStream_eyeq_LogStream_eyeq_StreamLayer_eyeq_Stream_eyeq_CreateStream_eyeq_CreateStream_Response_eyeq_ReadStream_eyeq_ReadStream_Response_eyeq_SeekStream_eyeq_SeekStream_Response_eyeq_CloseStream_eyeq_CloseStream_Response_eyeq_StreamInfo_eyeq_StreamInfo_Response_eyeq_ListStreams_eyeq_ListStreams_Response)
 #endif
 
 #if !defined(PB_FIELD_16BIT) && !defined(PB_FIELD_32BIT)
-#error Field descriptor for eyeq_Block.data is too large. Define PB_FIELD_16BIT to fix this.
+#error Field descriptor for eyeq_ReadStream_Response.samples is too large. Define PB_FIELD_16BIT to fix this.
 #endif
 
 
@@ -1,5 +1,5 @@
 /* Automatically generated nanopb header */
-/* Generated by nanopb-0.3.9.5 at Wed Jul 14 14:23:13 2021. */
+/* Generated by nanopb-0.3.9.5 at Sun Oct 18 05:52:09 2026. */
 
 #ifndef PB_EYEQ_SAMPLES_PB_H_INCLUDED
 #define PB_EYEQ_SAMPLES_PB_H_INCLUDED
@@ -17,11 +17,32 @@ extern "C" {
 /* Enum definitions */
 typedef enum _eyeq_StoreType {
     eyeq_StoreType_MEMORY_STORE = 0,
-    eyeq_StoreType_FILE_STORE = 1
+    eyeq_StoreType_FILE_STORE = 1,
+    eyeq_StoreType_MMAP_STORE = 2,
+    eyeq_StoreType_DIRECT_STORE = 3,
+    eyeq_StoreType_TIERED_STORE = 4,
+    eyeq_StoreType_STRIPED_STORE = 5
 } eyeq_StoreType;
 #define _eyeq_StoreType_MIN eyeq_StoreType_MEMORY_STORE
-#define _eyeq_StoreType_MAX eyeq_StoreType_FILE_STORE
-#define _eyeq_StoreType_ARRAYSIZE ((eyeq_StoreType)(eyeq_StoreType_FILE_STORE+1))
+#define _eyeq_StoreType_MAX eyeq_StoreType_STRIPED_STORE
+#define _eyeq_StoreType_ARRAYSIZE ((eyeq_StoreType)(eyeq_StoreType_STRIPED_STORE+1))
+
+typedef enum _eyeq_StoreCodec {
+    eyeq_StoreCodec_NO_CODEC = 0,
+    eyeq_StoreCodec_DELTA_CODEC = 1
+} eyeq_StoreCodec;
+#define _eyeq_StoreCodec_MIN eyeq_StoreCodec_NO_CODEC
+#define _eyeq_StoreCodec_MAX eyeq_StoreCodec_DELTA_CODEC
+#define _eyeq_StoreCodec_ARRAYSIZE ((eyeq_StoreCodec)(eyeq_StoreCodec_DELTA_CODEC+1))
+
+typedef enum _eyeq_StoreDurability {
+    eyeq_StoreDurability_DURABILITY_NONE = 0,
+    eyeq_StoreDurability_DURABILITY_PERIODIC = 1,
+    eyeq_StoreDurability_DURABILITY_SYNC = 2
+} eyeq_StoreDurability;
+#define _eyeq_StoreDurability_MIN eyeq_StoreDurability_DURABILITY_NONE
+#define _eyeq_StoreDurability_MAX eyeq_StoreDurability_DURABILITY_SYNC
+#define _eyeq_StoreDurability_ARRAYSIZE ((eyeq_StoreDurability)(eyeq_StoreDurability_DURABILITY_SYNC+1))
 
 /* Struct definitions */
 typedef struct _eyeq_AbsStream {
@@ -39,12 +60,35 @@ typedef struct _eyeq_FlushStores {
 /* @@protoc_insertion_point(struct:eyeq_FlushStores) */
 } eyeq_FlushStores;
 
-typedef PB_BYTES_ARRAY_T(16384) eyeq_Block_data_t;
 typedef struct _eyeq_Block {
-    eyeq_Block_data_t data;
+    pb_bytes_array_t *data;
 /* @@protoc_insertion_point(struct:eyeq_Block) */
 } eyeq_Block;
 
+typedef struct _eyeq_BlockStats {
+    char name[32];
+    char path[128];
+    uint32_t start_block;
+    uint32_t stride;
+/* @@protoc_insertion_point(struct:eyeq_BlockStats) */
+} eyeq_BlockStats;
+
+typedef struct _eyeq_BlockStats_Response {
+    uint32_t start_block;
+    uint32_t stride;
+    pb_size_t mean_power_count;
+    float mean_power[1024];
+    pb_size_t peak_magnitude_count;
+    float peak_magnitude[1024];
+    pb_size_t dc_i_count;
+    float dc_i[1024];
+    pb_size_t dc_q_count;
+    float dc_q[1024];
+    pb_size_t clip_count_count;
+    uint32_t clip_count[1024];
+/* @@protoc_insertion_point(struct:eyeq_BlockStats_Response) */
+} eyeq_BlockStats_Response;
+
 typedef struct _eyeq_CloseStream {
     char name[32];
     char path[128];
@@ -72,7 +116,9 @@ typedef struct _eyeq_DeleteStore_Response {
 typedef struct _eyeq_FirFilterStream {
     bool is_complex;
     pb_size_t filter_taps_count;
-    float filter_taps[256];
+    float *filter_taps;
+    uint32_t interpolation;
+    uint32_t decimation;
 /* @@protoc_insertion_point(struct:eyeq_FirFilterStream) */
 } eyeq_FirFilterStream;
 
@@ -89,11 +135,15 @@ typedef struct _eyeq_FrequencyTranslateStream {
 
 typedef struct _eyeq_ListStores {
     char path[128];
+    char after_path[128];
+    char after_name[32];
 /* @@protoc_insertion_point(struct:eyeq_ListStores) */
 } eyeq_ListStores;
 
 typedef struct _eyeq_ListStreams {
     char path[128];
+    char after_path[128];
+    char after_name[32];
 /* @@protoc_insertion_point(struct:eyeq_ListStreams) */
 } eyeq_ListStreams;
 
@@ -102,13 +152,11 @@ typedef struct _eyeq_LogStream {
 /* @@protoc_insertion_point(struct:eyeq_LogStream) */
 } eyeq_LogStream;
 
-typedef struct _eyeq_ReadBlocks {
-    char name[32];
-    char path[128];
-    uint32_t offset;
-    uint32_t count;
-/* @@protoc_insertion_point(struct:eyeq_ReadBlocks) */
-} eyeq_ReadBlocks;
+typedef struct _eyeq_QueryBlocks_Run {
+    uint32_t start_block;
+    uint32_t block_count;
+/* @@protoc_insertion_point(struct:eyeq_QueryBlocks_Run) */
+} eyeq_QueryBlocks_Run;
 
 typedef struct _eyeq_ReadStream {
     char name[32];
@@ -117,19 +165,23 @@ typedef struct _eyeq_ReadStream {
 /* @@protoc_insertion_point(struct:eyeq_ReadStream) */
 } eyeq_ReadStream;
 
-typedef struct _eyeq_SeekStream {
-    char name[32];
-    char path[128];
-    uint32_t block_id;
-/* @@protoc_insertion_point(struct:eyeq_SeekStream) */
-} eyeq_SeekStream;
-
 typedef struct _eyeq_SeekStream_Response {
     uint64_t sample_offset;
     bool eos;
 /* @@protoc_insertion_point(struct:eyeq_SeekStream_Response) */
 } eyeq_SeekStream_Response;
 
+typedef struct _eyeq_SnapshotStore {
+    char name[32];
+    char path[128];
+    char snapshot_name[32];
+    char snapshot_path[128];
+    char file_path[128];
+    uint32_t start_block;
+    uint32_t block_count;
+/* @@protoc_insertion_point(struct:eyeq_SnapshotStore) */
+} eyeq_SnapshotStore;
+
 typedef struct _eyeq_Store {
     char name[32];
     char path[128];
@@ -137,6 +189,24 @@ typedef struct _eyeq_Store {
     uint32_t block_count;
     uint32_t block_offset;
     char file_path[128];
+    eyeq_StoreCodec codec;
+    uint32_t hot_block_count;
+    bool verify_crc;
+    uint32_t scrub_rate;
+    uint32_t bad_block_count;
+    pb_size_t bad_blocks_count;
+    uint32_t bad_blocks[16];
+    eyeq_StoreDurability durability;
+    uint32_t sync_interval_ms;
+    uint32_t sync_blocks;
+    uint32_t ingest_queue_blocks;
+    bool hugepages;
+    bool numa_bind;
+    uint32_t numa_node;
+    uint64_t reserved_bytes;
+    uint64_t resident_bytes;
+    uint32_t block_size;
+    bool read_only;
 /* @@protoc_insertion_point(struct:eyeq_Store) */
 } eyeq_Store;
 
@@ -190,15 +260,58 @@ typedef struct _eyeq_CreateStream_Response {
 typedef struct _eyeq_ListStores_Response {
     pb_size_t stores_count;
     eyeq_Store stores[64];
+    char next_path[128];
+    char next_name[32];
 /* @@protoc_insertion_point(struct:eyeq_ListStores_Response) */
 } eyeq_ListStores_Response;
 
 typedef struct _eyeq_ListStreams_Response {
     pb_size_t streams_count;
     eyeq_Stream streams[64];
+    char next_path[128];
+    char next_name[32];
 /* @@protoc_insertion_point(struct:eyeq_ListStreams_Response) */
 } eyeq_ListStreams_Response;
 
+typedef struct _eyeq_QueryBlocks {
+    char name[32];
+    char path[128];
+    bool match_source_id;
+    uint32_t source_id;
+    bool match_block_type;
+    uint32_t block_type;
+    bool match_frequency;
+    float min_frequency;
+    float max_frequency;
+    bool match_sample_rate;
+    uint32_t min_sample_rate;
+    uint32_t max_sample_rate;
+    eyeq_Timestamp start_time;
+    eyeq_Timestamp end_time;
+    uint32_t start_block;
+    bool match_power;
+    float min_power_db;
+    float max_power_db;
+/* @@protoc_insertion_point(struct:eyeq_QueryBlocks) */
+} eyeq_QueryBlocks;
+
+typedef struct _eyeq_QueryBlocks_Response {
+    pb_size_t runs_count;
+    eyeq_QueryBlocks_Run runs[256];
+    bool more;
+    uint32_t next_block;
+/* @@protoc_insertion_point(struct:eyeq_QueryBlocks_Response) */
+} eyeq_QueryBlocks_Response;
+
+typedef struct _eyeq_ReadBlocks {
+    char name[32];
+    char path[128];
+    uint32_t offset;
+    uint32_t count;
+    eyeq_Timestamp time;
+/* @@protoc_insertion_point(struct:eyeq_ReadBlocks) */
+} eyeq_ReadBlocks;
+
 typedef struct _eyeq_ReadBlocks_Response {
     eyeq_Block block;
 /* @@protoc_insertion_point(struct:eyeq_ReadBlocks_Response) */
@@ -213,6 +326,19 @@ typedef struct _eyeq_ReadStream_Response {
 /* @@protoc_insertion_point(struct:eyeq_ReadStream_Response) */
 } eyeq_ReadStream_Response;
 
+typedef struct _eyeq_SeekStream {
+    char name[32];
+    char path[128];
+    uint32_t block_id;
+    eyeq_Timestamp time;
+/* @@protoc_insertion_point(struct:eyeq_SeekStream) */
+} eyeq_SeekStream;
+
+typedef struct _eyeq_SnapshotStore_Response {
+    eyeq_Store store;
+/* @@protoc_insertion_point(struct:eyeq_SnapshotStore_Response) */
+} eyeq_SnapshotStore_Response;
+
 typedef struct _eyeq_StreamInfo_Response {
     eyeq_Stream stream;
     uint32_t block_id;
@@ -239,6 +365,8 @@ typedef struct _eyeq_WriteBlock {
     char path[128];
     int32_t offset;
     eyeq_Block block;
+    pb_size_t blocks_count;
+    eyeq_Block blocks[8];
 /* @@protoc_insertion_point(struct:eyeq_WriteBlock) */
 } eyeq_WriteBlock;
 
@@ -265,6 +393,9 @@ typedef struct _eyeq_ServerResponse {
         eyeq_CloseStream_Response close_stream_response;
         eyeq_StreamInfo_Response stream_info_response;
         eyeq_ListStreams_Response list_streams_response;
+        eyeq_SnapshotStore_Response snapshot_store_response;
+        eyeq_QueryBlocks_Response query_blocks_response;
+        eyeq_BlockStats_Response block_stats_response;
     } resp;
     uint32_t req_id;
 /* @@protoc_insertion_point(struct:eyeq_ServerResponse) */
@@ -285,6 +416,9 @@ typedef struct _eyeq_ServerRequest {
         eyeq_CloseStream close_stream;
         eyeq_StreamInfo stream_info;
         eyeq_ListStreams list_streams;
+        eyeq_SnapshotStore snapshot_store;
+        eyeq_QueryBlocks query_blocks;
+        eyeq_BlockStats block_stats;
     } req;
     uint32_t req_id;
 /* @@protoc_insertion_point(struct:eyeq_ServerRequest) */
@@ -295,25 +429,32 @@ typedef struct _eyeq_ServerRequest {
 /* Initializer values for message structs */
 #define eyeq_ServerRequest_init_default          {0, {eyeq_CreateStore_init_default}, 0}
 #define eyeq_ServerResponse_init_default         {"", 0, {eyeq_CreateStore_Response_init_default}, 0}
-#define eyeq_Store_init_default                  {"", "", _eyeq_StoreType_MIN, 0, 0, ""}
+#define eyeq_Store_init_default                  {"", "", _eyeq_StoreType_MIN, 0, 0, "", _eyeq_StoreCodec_MIN, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, _eyeq_StoreDurability_MIN, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
 #define eyeq_CreateStore_init_default            {eyeq_Store_init_default}
 #define eyeq_CreateStore_Response_init_default   {eyeq_Store_init_default}
-#define eyeq_ListStores_init_default             {""}
-#define eyeq_ListStores_Response_init_default    {0, {eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default}}
+#define eyeq_ListStores_init_default             {"", "", ""}
+#define eyeq_ListStores_Response_init_default    {0, {eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default, eyeq_Store_init_default}, "", ""}
 #define eyeq_DeleteStore_init_default            {"", ""}
 #define eyeq_DeleteStore_Response_init_default   {0}
+#define eyeq_SnapshotStore_init_default          {"", "", "", "", "", 0, 0}
+#define eyeq_SnapshotStore_Response_init_default {eyeq_Store_init_default}
 #define eyeq_FlushStores_init_default            {0}
 #define eyeq_FlushStores_Response_init_default   {0}
 #define eyeq_Timestamp_init_default              {0, 0}
-#define eyeq_Block_init_default                  {{0, {0}}}
-#define eyeq_WriteBlock_init_default             {"", "", 0, eyeq_Block_init_default}
+#define eyeq_Block_init_default                  {NULL}
+#define eyeq_WriteBlock_init_default             {"", "", 0, eyeq_Block_init_default, 0, {eyeq_Block_init_default, eyeq_Block_init_default, eyeq_Block_init_default, eyeq_Block_init_default, eyeq_Block_init_default, eyeq_Block_init_default, eyeq_Block_init_default, eyeq_Block_init_default}}
 #define eyeq_WriteBlock_Response_init_default    {0}
-#define eyeq_ReadBlocks_init_default             {"", "", 0, 0}
+#define eyeq_ReadBlocks_init_default             {"", "", 0, 0, eyeq_Timestamp_init_default}
 #define eyeq_ReadBlocks_Response_init_default    {eyeq_Block_init_default}
+#define eyeq_QueryBlocks_init_default            {"", "", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, eyeq_Timestamp_init_default, eyeq_Timestamp_init_default, 0, 0, 0, 0}
+#define eyeq_QueryBlocks_Run_init_default        {0, 0}
+#define eyeq_QueryBlocks_Response_init_default   {0, {eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default, eyeq_QueryBlocks_Run_init_default}, 0, 0}
+#define eyeq_BlockStats_init_default             {"", "", 0, 0}
+#define eyeq_BlockStats_Response_init_default    {0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
 #define eyeq_StoreReaderStream_init_default      {"", "", 0, 0}
 #define eyeq_FrequencyTranslateStream_init_default {0, 0}
 #define eyeq_ConstMultiplyStream_init_default    {0, 0, 0}
-#define eyeq_FirFilterStream_init_default        {0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
+#define eyeq_FirFilterStream_init_default        {0, 0, NULL, 0, 0}
 #define eyeq_AbsStream_init_default              {0}
 #define eyeq_LogStream_init_default              {0}
 #define eyeq_StreamLayer_init_default            {0, {eyeq_FrequencyTranslateStream_init_default}}
@@ -322,35 +463,42 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_CreateStream_Response_init_default  {eyeq_Stream_init_default}
 #define eyeq_ReadStream_init_default             {"", "", 0}
 #define eyeq_ReadStream_Response_init_default    {0, eyeq_Timestamp_init_default, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0}
-#define eyeq_SeekStream_init_default             {"", "", 0}
+#define eyeq_SeekStream_init_default             {"", "", 0, eyeq_Timestamp_init_default}
 #define eyeq_SeekStream_Response_init_default    {0, 0}
 #define eyeq_CloseStream_init_default            {"", ""}
 #define eyeq_CloseStream_Response_init_default   {0}
 #define eyeq_StreamInfo_init_default             {"", ""}
 #define eyeq_StreamInfo_Response_init_default    {eyeq_Stream_init_default, 0, 0, 0}
-#define eyeq_ListStreams_init_default            {""}
-#define eyeq_ListStreams_Response_init_default   {0, {eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default}}
+#define eyeq_ListStreams_init_default            {"", "", ""}
+#define eyeq_ListStreams_Response_init_default   {0, {eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default, eyeq_Stream_init_default}, "", ""}
 #define eyeq_ServerRequest_init_zero             {0, {eyeq_CreateStore_init_zero}, 0}
 #define eyeq_ServerResponse_init_zero            {"", 0, {eyeq_CreateStore_Response_init_zero}, 0}
-#define eyeq_Store_init_zero                     {"", "", _eyeq_StoreType_MIN, 0, 0, ""}
+#define eyeq_Store_init_zero                     {"", "", _eyeq_StoreType_MIN, 0, 0, "", _eyeq_StoreCodec_MIN, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, _eyeq_StoreDurability_MIN, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}
 #define eyeq_CreateStore_init_zero               {eyeq_Store_init_zero}
 #define eyeq_CreateStore_Response_init_zero      {eyeq_Store_init_zero}
-#define eyeq_ListStores_init_zero                {""}
-#define eyeq_ListStores_Response_init_zero       {0, {eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero}}
+#define eyeq_ListStores_init_zero                {"", "", ""}
+#define eyeq_ListStores_Response_init_zero       {0, {eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero, eyeq_Store_init_zero}, "", ""}
 #define eyeq_DeleteStore_init_zero               {"", ""}
 #define eyeq_DeleteStore_Response_init_zero      {0}
+#define eyeq_SnapshotStore_init_zero             {"", "", "", "", "", 0, 0}
+#define eyeq_SnapshotStore_Response_init_zero    {eyeq_Store_init_zero}
 #define eyeq_FlushStores_init_zero               {0}
 #define eyeq_FlushStores_Response_init_zero      {0}
 #define eyeq_Timestamp_init_zero                 {0, 0}
-#define eyeq_Block_init_zero                     {{0, {0}}}
-#define eyeq_WriteBlock_init_zero                {"", "", 0, eyeq_Block_init_zero}
+#define eyeq_Block_init_zero                     {NULL}
+#define eyeq_WriteBlock_init_zero                {"", "", 0, eyeq_Block_init_zero, 0, {eyeq_Block_init_zero, eyeq_Block_init_zero, eyeq_Block_init_zero, eyeq_Block_init_zero, eyeq_Block_init_zero, eyeq_Block_init_zero, eyeq_Block_init_zero, eyeq_Block_init_zero}}
 #define eyeq_WriteBlock_Response_init_zero       {0}
-#define eyeq_ReadBlocks_init_zero                {"", "", 0, 0}
+#define eyeq_ReadBlocks_init_zero                {"", "", 0, 0, eyeq_Timestamp_init_zero}
 #define eyeq_ReadBlocks_Response_init_zero       {eyeq_Block_init_zero}
+#define eyeq_QueryBlocks_init_zero               {"", "", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, eyeq_Timestamp_init_zero, eyeq_Timestamp_init_zero, 0, 0, 0, 0}
+#define eyeq_QueryBlocks_Run_init_zero           {0, 0}
+#define eyeq_QueryBlocks_Response_init_zero      {0, {eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero, eyeq_QueryBlocks_Run_init_zero}, 0, 0}
+#define eyeq_BlockStats_init_zero                {"", "", 0, 0}
+#define eyeq_BlockStats_Response_init_zero       {0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
 #define eyeq_StoreReaderStream_init_zero         {"", "", 0, 0}
 #define eyeq_FrequencyTranslateStream_init_zero  {0, 0}
 #define eyeq_ConstMultiplyStream_init_zero       {0, 0, 0}
-#define eyeq_FirFilterStream_init_zero           {0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}}
+#define eyeq_FirFilterStream_init_zero           {0, 0, NULL, 0, 0}
 #define eyeq_AbsStream_init_zero                 {0}
 #define eyeq_LogStream_init_zero                 {0}
 #define eyeq_StreamLayer_init_zero               {0, {eyeq_FrequencyTranslateStream_init_zero}}
@@ -359,17 +507,28 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_CreateStream_Response_init_zero     {eyeq_Stream_init_zero}
 #define eyeq_ReadStream_init_zero                {"", "", 0}
 #define eyeq_ReadStream_Response_init_zero       {0, eyeq_Timestamp_init_zero, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, 0}
-#define eyeq_SeekStream_init_zero                {"", "", 0}
+#define eyeq_SeekStream_init_zero                {"", "", 0, eyeq_Timestamp_init_zero}
 #define eyeq_SeekStream_Response_init_zero       {0, 0}
 #define eyeq_CloseStream_init_zero               {"", ""}
 #define eyeq_CloseStream_Response_init_zero      {0}
 #define eyeq_StreamInfo_init_zero                {"", ""}
 #define eyeq_StreamInfo_Response_init_zero       {eyeq_Stream_init_zero, 0, 0, 0}
-#define eyeq_ListStreams_init_zero               {""}
-#define eyeq_ListStreams_Response_init_zero      {0, {eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero}}
+#define eyeq_ListStreams_init_zero               {"", "", ""}
+#define eyeq_ListStreams_Response_init_zero      {0, {eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero, eyeq_Stream_init_zero}, "", ""}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define eyeq_Block_data_tag                      1
+#define eyeq_BlockStats_name_tag                 1
+#define eyeq_BlockStats_path_tag                 2
+#define eyeq_BlockStats_start_block_tag          3
+#define eyeq_BlockStats_stride_tag               4
+#define eyeq_BlockStats_Response_start_block_tag 1
+#define eyeq_BlockStats_Response_stride_tag      2
+#define eyeq_BlockStats_Response_mean_power_tag  3
+#define eyeq_BlockStats_Response_peak_magnitude_tag 4
+#define eyeq_BlockStats_Response_dc_i_tag        5
+#define eyeq_BlockStats_Response_dc_q_tag        6
+#define eyeq_BlockStats_Response_clip_count_tag  7
 #define eyeq_CloseStream_name_tag                1
 #define eyeq_CloseStream_path_tag                2
 #define eyeq_ConstMultiplyStream_is_complex_tag  1
@@ -380,30 +539,55 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_DeleteStore_Response_success_tag    1
 #define eyeq_FirFilterStream_is_complex_tag      1
 #define eyeq_FirFilterStream_filter_taps_tag     2
+#define eyeq_FirFilterStream_interpolation_tag   3
+#define eyeq_FirFilterStream_decimation_tag      4
 #define eyeq_FlushStores_Response_success_tag    1
 #define eyeq_FrequencyTranslateStream_relative_frequency_tag 1
 #define eyeq_FrequencyTranslateStream_phase_tag  2
 #define eyeq_ListStores_path_tag                 1
+#define eyeq_ListStores_after_path_tag           2
+#define eyeq_ListStores_after_name_tag           3
 #define eyeq_ListStreams_path_tag                1
+#define eyeq_ListStreams_after_path_tag          2
+#define eyeq_ListStreams_after_name_tag          3
 #define eyeq_LogStream_log_base_tag              1
-#define eyeq_ReadBlocks_name_tag                 1
-#define eyeq_ReadBlocks_path_tag                 2
-#define eyeq_ReadBlocks_offset_tag               3
-#define eyeq_ReadBlocks_count_tag                4
+#define eyeq_QueryBlocks_Run_start_block_tag     1
+#define eyeq_QueryBlocks_Run_block_count_tag     2
 #define eyeq_ReadStream_name_tag                 1
 #define eyeq_ReadStream_path_tag                 2
 #define eyeq_ReadStream_sample_count_tag         3
-#define eyeq_SeekStream_name_tag                 1
-#define eyeq_SeekStream_path_tag                 2
-#define eyeq_SeekStream_block_id_tag             3
 #define eyeq_SeekStream_Response_sample_offset_tag 1
 #define eyeq_SeekStream_Response_eos_tag         2
+#define eyeq_SnapshotStore_name_tag              1
+#define eyeq_SnapshotStore_path_tag              2
+#define eyeq_SnapshotStore_snapshot_name_tag     3
+#define eyeq_SnapshotStore_snapshot_path_tag     4
+#define eyeq_SnapshotStore_file_path_tag         5
+#define eyeq_SnapshotStore_start_block_tag       6
+#define eyeq_SnapshotStore_block_count_tag       7
 #define eyeq_Store_name_tag                      1
 #define eyeq_Store_path_tag                      2
 #define eyeq_Store_store_type_tag                3
 #define eyeq_Store_block_count_tag               4
 #define eyeq_Store_block_offset_tag              5
 #define eyeq_Store_file_path_tag                 6
+#define eyeq_Store_codec_tag                     7
+#define eyeq_Store_hot_block_count_tag           8
+#define eyeq_Store_verify_crc_tag                9
+#define eyeq_Store_scrub_rate_tag                10
+#define eyeq_Store_bad_block_count_tag           11
+#define eyeq_Store_bad_blocks_tag                12
+#define eyeq_Store_durability_tag                13
+#define eyeq_Store_sync_interval_ms_tag          14
+#define eyeq_Store_sync_blocks_tag               15
+#define eyeq_Store_ingest_queue_blocks_tag       16
+#define eyeq_Store_hugepages_tag                 17
+#define eyeq_Store_numa_bind_tag                 18
+#define eyeq_Store_numa_node_tag                 19
+#define eyeq_Store_reserved_bytes_tag            20
+#define eyeq_Store_resident_bytes_tag            21
+#define eyeq_Store_block_size_tag                22
+#define eyeq_Store_read_only_tag                 23
 #define eyeq_StoreReaderStream_name_tag          1
 #define eyeq_StoreReaderStream_path_tag          2
 #define eyeq_StoreReaderStream_start_block_tag   3
@@ -420,12 +604,47 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_CreateStore_Response_store_tag      1
 #define eyeq_CreateStream_Response_stream_tag    2
 #define eyeq_ListStores_Response_stores_tag      1
+#define eyeq_ListStores_Response_next_path_tag   2
+#define eyeq_ListStores_Response_next_name_tag   3
 #define eyeq_ListStreams_Response_streams_tag    1
+#define eyeq_ListStreams_Response_next_path_tag  2
+#define eyeq_ListStreams_Response_next_name_tag  3
+#define eyeq_QueryBlocks_name_tag                1
+#define eyeq_QueryBlocks_path_tag                2
+#define eyeq_QueryBlocks_match_source_id_tag     3
+#define eyeq_QueryBlocks_source_id_tag           4
+#define eyeq_QueryBlocks_match_block_type_tag    5
+#define eyeq_QueryBlocks_block_type_tag          6
+#define eyeq_QueryBlocks_match_frequency_tag     7
+#define eyeq_QueryBlocks_min_frequency_tag       8
+#define eyeq_QueryBlocks_max_frequency_tag       9
+#define eyeq_QueryBlocks_match_sample_rate_tag   10
+#define eyeq_QueryBlocks_min_sample_rate_tag     11
+#define eyeq_QueryBlocks_max_sample_rate_tag     12
+#define eyeq_QueryBlocks_start_time_tag          13
+#define eyeq_QueryBlocks_end_time_tag            14
+#define eyeq_QueryBlocks_start_block_tag         15
+#define eyeq_QueryBlocks_match_power_tag         16
+#define eyeq_QueryBlocks_min_power_db_tag        17
+#define eyeq_QueryBlocks_max_power_db_tag        18
+#define eyeq_QueryBlocks_Response_runs_tag       1
+#define eyeq_QueryBlocks_Response_more_tag       2
+#define eyeq_QueryBlocks_Response_next_block_tag 3
+#define eyeq_ReadBlocks_name_tag                 1
+#define eyeq_ReadBlocks_path_tag                 2
+#define eyeq_ReadBlocks_offset_tag               3
+#define eyeq_ReadBlocks_count_tag                4
+#define eyeq_ReadBlocks_time_tag                 5
 #define eyeq_ReadBlocks_Response_block_tag       1
 #define eyeq_ReadStream_Response_block_tag       1
 #define eyeq_ReadStream_Response_ts_tag          2
 #define eyeq_ReadStream_Response_samples_tag     3
 #define eyeq_ReadStream_Response_eos_tag         4
+#define eyeq_SeekStream_name_tag                 1
+#define eyeq_SeekStream_path_tag                 2
+#define eyeq_SeekStream_block_id_tag             3
+#define eyeq_SeekStream_time_tag                 4
+#define eyeq_SnapshotStore_Response_store_tag    1
 #define eyeq_StreamInfo_Response_stream_tag      1
 #define eyeq_StreamInfo_Response_block_id_tag    2
 #define eyeq_StreamInfo_Response_sample_offset_tag 3
@@ -440,6 +659,7 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_WriteBlock_path_tag                 2
 #define eyeq_WriteBlock_offset_tag               3
 #define eyeq_WriteBlock_block_tag                4
+#define eyeq_WriteBlock_blocks_tag               5
 #define eyeq_CreateStream_stream_tag             1
 #define eyeq_CreateStream_layers_tag             2
 #define eyeq_ServerResponse_create_store_response_tag 2
@@ -454,6 +674,9 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_ServerResponse_close_stream_response_tag 12
 #define eyeq_ServerResponse_stream_info_response_tag 13
 #define eyeq_ServerResponse_list_streams_response_tag 14
+#define eyeq_ServerResponse_snapshot_store_response_tag 15
+#define eyeq_ServerResponse_query_blocks_response_tag 16
+#define eyeq_ServerResponse_block_stats_response_tag 17
 #define eyeq_ServerResponse_error_tag            1
 #define eyeq_ServerResponse_req_id_tag           8
 #define eyeq_ServerRequest_create_store_tag      1
@@ -468,30 +691,40 @@ typedef struct _eyeq_ServerRequest {
 #define eyeq_ServerRequest_close_stream_tag      11
 #define eyeq_ServerRequest_stream_info_tag       12
 #define eyeq_ServerRequest_list_streams_tag      13
+#define eyeq_ServerRequest_snapshot_store_tag    14
+#define eyeq_ServerRequest_query_blocks_tag      15
+#define eyeq_ServerRequest_block_stats_tag       16
 #define eyeq_ServerRequest_req_id_tag            7
 
 /* Struct field encoding specification for nanopb */
-extern const pb_field_t eyeq_ServerRequest_fields[14];
-extern const pb_field_t eyeq_ServerResponse_fields[15];
-extern const pb_field_t eyeq_Store_fields[7];
+extern const pb_field_t eyeq_ServerRequest_fields[17];
+extern const pb_field_t eyeq_ServerResponse_fields[18];
+extern const pb_field_t eyeq_Store_fields[24];
 extern const pb_field_t eyeq_CreateStore_fields[2];
 extern const pb_field_t eyeq_CreateStore_Response_fields[2];
-extern const pb_field_t eyeq_ListStores_fields[2];
-extern const pb_field_t eyeq_ListStores_Response_fields[2];
+extern const pb_field_t eyeq_ListStores_fields[4];
+extern const pb_field_t eyeq_ListStores_Response_fields[4];
 extern const pb_field_t eyeq_DeleteStore_fields[3];
 extern const pb_field_t eyeq_DeleteStore_Response_fields[2];
+extern const pb_field_t eyeq_SnapshotStore_fields[8];
+extern const pb_field_t eyeq_SnapshotStore_Response_fields[2];
 extern const pb_field_t eyeq_FlushStores_fields[1];
 extern const pb_field_t eyeq_FlushStores_Response_fields[2];
 extern const pb_field_t eyeq_Timestamp_fields[3];
 extern const pb_field_t eyeq_Block_fields[2];
-extern const pb_field_t eyeq_WriteBlock_fields[5];
+extern const pb_field_t eyeq_WriteBlock_fields[6];
 extern const pb_field_t eyeq_WriteBlock_Response_fields[2];
-extern const pb_field_t eyeq_ReadBlocks_fields[5];
+extern const pb_field_t eyeq_ReadBlocks_fields[6];
 extern const pb_field_t eyeq_ReadBlocks_Response_fields[2];
+extern const pb_field_t eyeq_QueryBlocks_fields[19];
+extern const pb_field_t eyeq_QueryBlocks_Run_fields[3];
+extern const pb_field_t eyeq_QueryBlocks_Response_fields[4];
+extern const pb_field_t eyeq_BlockStats_fields[5];
+extern const pb_field_t eyeq_BlockStats_Response_fields[8];
 extern const pb_field_t eyeq_StoreReaderStream_fields[5];
 extern const pb_field_t eyeq_FrequencyTranslateStream_fields[3];
 extern const pb_field_t eyeq_ConstMultiplyStream_fields[4];
-extern const pb_field_t eyeq_FirFilterStream_fields[3];
+extern const pb_field_t eyeq_FirFilterStream_fields[5];
 extern const pb_field_t eyeq_AbsStream_fields[1];
 extern const pb_field_t eyeq_LogStream_fields[2];
 extern const pb_field_t eyeq_StreamLayer_fields[7];
@@ -500,53 +733,60 @@ extern const pb_field_t eyeq_CreateStream_fields[3];
 extern const pb_field_t eyeq_CreateStream_Response_fields[2];
 extern const pb_field_t eyeq_ReadStream_fields[4];
 extern const pb_field_t eyeq_ReadStream_Response_fields[5];
-extern const pb_field_t eyeq_SeekStream_fields[4];
+extern const pb_field_t eyeq_SeekStream_fields[5];
 extern const pb_field_t eyeq_SeekStream_Response_fields[3];
 extern const pb_field_t eyeq_CloseStream_fields[3];
 extern const pb_field_t eyeq_CloseStream_Response_fields[1];
 extern const pb_field_t eyeq_StreamInfo_fields[3];
 extern const pb_field_t eyeq_StreamInfo_Response_fields[5];
-extern const pb_field_t eyeq_ListStreams_fields[2];
-extern const pb_field_t eyeq_ListStreams_Response_fields[2];
+extern const pb_field_t eyeq_ListStreams_fields[4];
+extern const pb_field_t eyeq_ListStreams_Response_fields[4];
 
 /* Maximum encoded size of messages (where known) */
-#define eyeq_ServerRequest_size                  16578
-#define eyeq_ServerResponse_size                 20653
-#define eyeq_Store_size                          310
-#define eyeq_CreateStore_size                    313
-#define eyeq_CreateStore_Response_size           313
-#define eyeq_ListStores_size                     131
-#define eyeq_ListStores_Response_size            20032
+/* eyeq_ServerRequest_size depends on runtime parameters */
+/* eyeq_ServerResponse_size depends on runtime parameters */
+#define eyeq_Store_size                          496
+#define eyeq_CreateStore_size                    499
+#define eyeq_CreateStore_Response_size           499
+#define eyeq_ListStores_size                     296
+#define eyeq_ListStores_Response_size            32101
 #define eyeq_DeleteStore_size                    262
 #define eyeq_DeleteStore_Response_size           2
+#define eyeq_SnapshotStore_size                  473
+#define eyeq_SnapshotStore_Response_size         499
 #define eyeq_FlushStores_size                    0
 #define eyeq_FlushStores_Response_size           2
 #define eyeq_Timestamp_size                      22
-#define eyeq_Block_size                          16388
-#define eyeq_WriteBlock_size                     16568
+/* eyeq_Block_size depends on runtime parameters */
+/* eyeq_WriteBlock_size depends on runtime parameters */
 #define eyeq_WriteBlock_Response_size            6
-#define eyeq_ReadBlocks_size                     177
-#define eyeq_ReadBlocks_Response_size            16392
+#define eyeq_ReadBlocks_size                     201
+/* eyeq_ReadBlocks_Response_size depends on runtime parameters */
+#define eyeq_QueryBlocks_size                    276
+#define eyeq_QueryBlocks_Run_size                12
+#define eyeq_QueryBlocks_Response_size           3592
+#define eyeq_BlockStats_size                     177
+#define eyeq_BlockStats_Response_size            26636
 #define eyeq_StoreReaderStream_size              177
 #define eyeq_FrequencyTranslateStream_size       10
 #define eyeq_ConstMultiplyStream_size            12
-#define eyeq_FirFilterStream_size                1282
+/* eyeq_FirFilterStream_size depends on runtime parameters */
 #define eyeq_AbsStream_size                      0
 #define eyeq_LogStream_size                      5
-#define eyeq_StreamLayer_size                    1285
+/* eyeq_StreamLayer_size depends on runtime parameters */
 #define eyeq_Stream_size                         171
-#define eyeq_CreateStream_size                   13054
+/* eyeq_CreateStream_size depends on runtime parameters */
 #define eyeq_CreateStream_Response_size          174
 #define eyeq_ReadStream_size                     171
 #define eyeq_ReadStream_Response_size            20512
-#define eyeq_SeekStream_size                     171
+#define eyeq_SeekStream_size                     195
 #define eyeq_SeekStream_Response_size            13
 #define eyeq_CloseStream_size                    165
 #define eyeq_CloseStream_Response_size           0
 #define eyeq_StreamInfo_size                     165
 #define eyeq_StreamInfo_Response_size            193
-#define eyeq_ListStreams_size                    131
-#define eyeq_ListStreams_Response_size           11136
+#define eyeq_ListStreams_size                    296
+#define eyeq_ListStreams_Response_size           11301
 
 /* Message IDs (where set with "msgid" option) */
 #ifdef PB_MSGID
@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <eyeq/block.h>
+#include <eyeq/shared.h>
+
+#include "crc32.h"
+
+// Checksums store blocks with every CRC32 implementation the CPU supports.
+//
+// usage: eyeq-crc-bench [block_count]
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t block_count = argc > 1 ? strtoul(argv[1], NULL, 10) : 16384;
+
+    uint8_t *data = malloc(BLOCK_LENGTH);
+    if (!data) {
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < BLOCK_LENGTH; i++) {
+        data[i] = rand();
+    }
+
+    const crc32_implementation_t *implementations;
+    int count = crc32_implementations(&implementations);
+
+    printf("%u blocks of %d bytes\n", block_count, BLOCK_LENGTH);
+    for (int i = 0; i < count; i++) {
+        uint32_t crc = EYEQ_CRC_INITIAL;
+        double start = now();
+        for (uint32_t b = 0; b < block_count; b++) {
+            crc = implementations[i].function(crc, data, BLOCK_LENGTH);
+        }
+        double elapsed = now() - start;
+
+        double total = (double)block_count * BLOCK_LENGTH;
+        printf("%-8s %08x %10.0f blocks/s %8.1f MB/s\n", implementations[i].name, crc ^ EYEQ_CRC_INITIAL,
+               block_count / elapsed, total / elapsed / 1e6);
+    }
+
+    free(data);
+
+    return 0;
+}
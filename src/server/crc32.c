@@ -1,5 +1,19 @@
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
 #include <eyeq/shared.h>
 
+#include "crc32.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CRC32_CLMUL
+#elif defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#define CRC32_ARM
+#endif
+
 // IEEE CRC32
 static unsigned int eyeq_crc32tab[16] = {
    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190,
@@ -9,7 +23,7 @@ static unsigned int eyeq_crc32tab[16] = {
 };
 
 // Initial crc value should be 0xffffffff
-uint32_t eyeq_crc32(uint32_t crc, const uint8_t *data, int len)
+static uint32_t crc32_nibble(uint32_t crc, const uint8_t *data, int len)
 {
 
    for (int i = 0; i < len; ++i)
@@ -22,3 +36,198 @@ uint32_t eyeq_crc32(uint32_t crc, const uint8_t *data, int len)
    // return value suitable for passing in next time, for final value invert it
    return crc /* ^ 0xffffffff*/;
 }
+
+// Slicing-by-8: table[k][b] is the CRC of byte b followed by k zero bytes, so eight bytes
+// are folded in with eight independent lookups.
+static uint32_t crc32_slice8_table[8][256];
+
+static void crc32_slice8_init(void) {
+    for (int b = 0; b < 256; b++) {
+        uint32_t crc = b;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+        crc32_slice8_table[0][b] = crc;
+    }
+    for (int b = 0; b < 256; b++) {
+        for (int k = 1; k < 8; k++) {
+            uint32_t crc = crc32_slice8_table[k - 1][b];
+            crc32_slice8_table[k][b] = (crc >> 8) ^ crc32_slice8_table[0][crc & 0xff];
+        }
+    }
+}
+
+static uint32_t crc32_slice8(uint32_t crc, const uint8_t *data, int len) {
+    const uint32_t (*t)[256] = crc32_slice8_table;
+
+    // Little endian only, like the block format
+    while (len >= 8) {
+        uint32_t low, high;
+        memcpy(&low, data, 4);
+        memcpy(&high, data + 4, 4);
+        low ^= crc;
+        crc = t[7][low & 0xff] ^ t[6][(low >> 8) & 0xff] ^ t[5][(low >> 16) & 0xff] ^ t[4][low >> 24] ^
+              t[3][high & 0xff] ^ t[2][(high >> 8) & 0xff] ^ t[1][(high >> 16) & 0xff] ^ t[0][high >> 24];
+        data += 8;
+        len -= 8;
+    }
+
+    while (len-- > 0) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xff];
+    }
+
+    return crc;
+}
+
+#ifdef CRC32_CLMUL
+/*
+ * Folds 64 bytes at a time with carry-less multiplication, then reduces to 32 bits with a
+ * Barrett reduction, as described in Intel's "Fast CRC Computation for Generic Polynomials
+ * Using PCLMULQDQ Instruction". The constants are for the bit reflected IEEE polynomial.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32_clmul(uint32_t crc, const uint8_t *data, int len) {
+    static const uint64_t k1k2[] __attribute__((aligned(16))) = { 0x0154442bd4, 0x01c6e41596 };
+    static const uint64_t k3k4[] __attribute__((aligned(16))) = { 0x01751997d0, 0x00ccaa009e };
+    static const uint64_t k5k0[] __attribute__((aligned(16))) = { 0x0163cd6124, 0x0000000000 };
+    static const uint64_t poly[] __attribute__((aligned(16))) = { 0x01db710641, 0x01f7011641 };
+
+    if (len < 64) {
+        return crc32_slice8(crc, data, len);
+    }
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(data + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+    x0 = _mm_load_si128((const __m128i *)k1k2);
+    data += 64;
+    len -= 64;
+
+    // Four parallel folds of 16 bytes
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(data + 0x30)));
+
+        data += 64;
+        len -= 64;
+    }
+
+    // Fold the four lanes into one
+    x0 = _mm_load_si128((const __m128i *)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    while (len >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)data)), x5);
+        data += 16;
+        len -= 16;
+    }
+
+    // 128 to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128((const __m128i *)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    crc = _mm_extract_epi32(x1, 1);
+
+    return crc32_slice8(crc, data, len);
+}
+#endif
+
+#ifdef CRC32_ARM
+// The ARMv8 CRC32 instructions implement the IEEE polynomial directly
+__attribute__((target("+crc")))
+static uint32_t crc32_arm(uint32_t crc, const uint8_t *data, int len) {
+    while (len >= 8) {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        crc = __crc32d(crc, word);
+        data += 8;
+        len -= 8;
+    }
+
+    while (len-- > 0) {
+        crc = __crc32b(crc, *data++);
+    }
+
+    return crc;
+}
+#endif
+
+static crc32_implementation_t crc32_supported[3];
+static int crc32_supported_count;
+static crc32_function crc32_best = crc32_nibble;
+static pthread_once_t crc32_once = PTHREAD_ONCE_INIT;
+
+static void crc32_init(void) {
+    crc32_slice8_init();
+
+    crc32_supported[crc32_supported_count++] = (crc32_implementation_t){ "nibble", crc32_nibble };
+    crc32_supported[crc32_supported_count++] = (crc32_implementation_t){ "slice8", crc32_slice8 };
+#ifdef CRC32_CLMUL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+        crc32_supported[crc32_supported_count++] = (crc32_implementation_t){ "pclmul", crc32_clmul };
+    }
+#endif
+#ifdef CRC32_ARM
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) {
+        crc32_supported[crc32_supported_count++] = (crc32_implementation_t){ "armv8", crc32_arm };
+    }
+#endif
+
+    crc32_best = crc32_supported[crc32_supported_count - 1].function;
+}
+
+int crc32_implementations(const crc32_implementation_t **implementations) {
+    pthread_once(&crc32_once, crc32_init);
+    *implementations = crc32_supported;
+    return crc32_supported_count;
+}
+
+uint32_t eyeq_crc32(uint32_t crc, const uint8_t *data, int len) {
+    pthread_once(&crc32_once, crc32_init);
+    return crc32_best(crc, data, len);
+}
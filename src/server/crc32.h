@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef uint32_t (*crc32_function)(uint32_t crc, const uint8_t *data, int len);
+
+typedef struct {
+    const char *name;
+    crc32_function function;
+} crc32_implementation_t;
+
+// Returns the CRC32 implementations this CPU supports, slowest first. All of them give the
+// same result, eyeq_crc32 uses the last one.
+int crc32_implementations(const crc32_implementation_t **implementations);
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "directory.h"
+
+#define DIRECTORY_MIN_BUCKETS 64
+
+// FNV-1a of path and name, with a separator so ("ab", "c") and ("a", "bc") differ
+static uint32_t directory_hash(const char *name, const char *path) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < STORE_MAX_PATH && path[i]; i++) {
+        hash = (hash ^ (uint8_t)path[i]) * 16777619u;
+    }
+    hash = (hash ^ 0xff) * 16777619u;
+    for (int i = 0; i < STORE_MAX_NAME && name[i]; i++) {
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static int directory_compare(const char *path1, const char *name1, const char *path2, const char *name2) {
+    int ret = strncmp(path1, path2, STORE_MAX_PATH);
+    return ret ? ret : strncmp(name1, name2, STORE_MAX_NAME);
+}
+
+// First position in the sorted array that is not before (path, name), or after it if
+// after is set.
+static uint32_t directory_search(directory_t *dir, const char *path, const char *name, bool after) {
+    uint32_t low = 0;
+    uint32_t high = dir->count;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        int ret = directory_compare(dir->sorted[mid]->path, dir->sorted[mid]->name, path, name);
+        if (ret < 0 || (after && ret == 0)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+static bool directory_rehash(directory_t *dir, uint32_t bucket_count) {
+    dir_entry_t **buckets = calloc(bucket_count, sizeof(dir_entry_t *));
+    if (!buckets) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < dir->count; i++) {
+        dir_entry_t *entry = dir->sorted[i];
+        uint32_t bucket = entry->hash & (bucket_count - 1);
+        entry->hash_next = buckets[bucket];
+        buckets[bucket] = entry;
+    }
+
+    free(dir->buckets);
+    dir->buckets = buckets;
+    dir->bucket_count = bucket_count;
+    return true;
+}
+
+dir_entry_t* directory_find(directory_t *dir, const char *name, const char *path) {
+    if (!dir->bucket_count) {
+        return NULL;
+    }
+
+    uint32_t hash = directory_hash(name, path);
+    dir_entry_t *entry = dir->buckets[hash & (dir->bucket_count - 1)];
+    while (entry) {
+        if (entry->hash == hash && !strncmp(entry->name, name, STORE_MAX_NAME) &&
+            !strncmp(entry->path, path, STORE_MAX_PATH)) {
+            return entry;
+        }
+        entry = entry->hash_next;
+    }
+
+    return NULL;
+}
+
+dir_entry_t* directory_add(directory_t *dir, const char *name, const char *path, void *item) {
+    if (dir->count == dir->capacity) {
+        uint32_t capacity = dir->capacity ? dir->capacity * 2 : DIRECTORY_MIN_BUCKETS;
+        dir_entry_t **sorted = realloc(dir->sorted, capacity * sizeof(dir_entry_t *));
+        if (!sorted) {
+            return NULL;
+        }
+        dir->sorted = sorted;
+        dir->capacity = capacity;
+    }
+
+    // Keep at most one entry per bucket on average
+    if (dir->count >= dir->bucket_count &&
+        !directory_rehash(dir, dir->bucket_count ? dir->bucket_count * 2 : DIRECTORY_MIN_BUCKETS)) {
+        return NULL;
+    }
+
+    dir_entry_t *entry = calloc(1, sizeof(dir_entry_t));
+    if (!entry) {
+        return NULL;
+    }
+
+    strncpy(entry->name, name, STORE_MAX_NAME);
+    strncpy(entry->path, path, STORE_MAX_PATH);
+    entry->hash = directory_hash(entry->name, entry->path);
+    entry->item = item;
+
+    uint32_t bucket = entry->hash & (dir->bucket_count - 1);
+    entry->hash_next = dir->buckets[bucket];
+    dir->buckets[bucket] = entry;
+
+    uint32_t position = directory_search(dir, entry->path, entry->name, false);
+    memmove(&dir->sorted[position + 1], &dir->sorted[position], (dir->count - position) * sizeof(dir_entry_t *));
+    dir->sorted[position] = entry;
+    dir->count++;
+
+    return entry;
+}
+
+void directory_remove(directory_t *dir, dir_entry_t *entry) {
+    dir_entry_t **link = &dir->buckets[entry->hash & (dir->bucket_count - 1)];
+    while (*link != entry) {
+        link = &(*link)->hash_next;
+    }
+    *link = entry->hash_next;
+
+    uint32_t position = directory_search(dir, entry->path, entry->name, false);
+    memmove(&dir->sorted[position], &dir->sorted[position + 1], (dir->count - position - 1) * sizeof(dir_entry_t *));
+    dir->count--;
+
+    free(entry);
+}
+
+void directory_iterate(directory_t *dir, const char *path, const char *after_path, const char *after_name,
+                       directory_callback callback, void *context) {
+    size_t length = strnlen(path, STORE_MAX_PATH);
+    uint32_t position = directory_search(dir, path, "", false);
+
+    if (after_name[0]) {
+        uint32_t after = directory_search(dir, after_path, after_name, true);
+        if (after > position) {
+            position = after;
+        }
+    }
+
+    for (; position < dir->count; position++) {
+        dir_entry_t *entry = dir->sorted[position];
+        if (strncmp(entry->path, path, length)) {
+            break;
+        }
+
+        // Only whole path components, "a" covers "a/b" but not "ab"
+        if (length && path[length - 1] != '/' && entry->path[length] && entry->path[length] != '/') {
+            continue;
+        }
+
+        if (callback(context, entry)) {
+            break;
+        }
+    }
+}
+
+void directory_clear(directory_t *dir) {
+    for (uint32_t i = 0; i < dir->count; i++) {
+        free(dir->sorted[i]);
+    }
+    free(dir->sorted);
+    free(dir->buckets);
+    memset(dir, 0, sizeof(directory_t));
+}
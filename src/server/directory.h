@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+#include <eyeq/server.h>
+
+// Returns true to stop the iteration
+typedef bool (*directory_callback)(void *context, dir_entry_t *entry);
+
+dir_entry_t* directory_find(directory_t *dir, const char *name, const char *path);
+
+// Adds an entry for item, the caller checks that (path, name) is not taken yet. Returns
+// NULL if out of memory.
+dir_entry_t* directory_add(directory_t *dir, const char *name, const char *path, void *item);
+void directory_remove(directory_t *dir, dir_entry_t *entry);
+
+// Visits the entries in path and below it, in (path, name) order. An empty path visits
+// all entries. If after_name is not empty, the iteration starts after the entry
+// (after_path, after_name), which does not have to exist anymore.
+void directory_iterate(directory_t *dir, const char *path, const char *after_path, const char *after_name,
+                       directory_callback callback, void *context);
+
+// Removes all entries, the items are freed by the caller
+void directory_clear(directory_t *dir);
@@ -2,8 +2,10 @@
 #include <stdlib.h>
 #include <getopt.h>
 #include <string.h>
+#include <signal.h>
 
 #include <eyeq/server.h>
+#include <eyeq/server/store.h>
 
 void print_usage(void) {
     printf("Usage: eyeq-server [--endpoint <address>] [--config <store configuration>]\n");
@@ -21,6 +23,21 @@ void save_store_list(void) {
     }
 }
 
+static bool sync_store(void *context, const char *name, const char *path, store_t *store) {
+    store_sync(store);
+    return false;
+}
+
+// Writes out queued blocks and memory store snapshots before the list is saved
+static void sync_stores(void) {
+    fprintf(stderr, "Syncing stores!\n");
+    iterate_store_list("", &stores, sync_store, NULL);
+}
+
+// Only interrupts the server loop, the stores are synced and saved at exit
+static void handle_signal(int signal) {
+}
+
 int main(int argc, char *argv[]) {
 
     static struct option long_options[] = {
@@ -56,7 +73,13 @@ int main(int argc, char *argv[]) {
         load_store_list_from_file(configuration_file, &stores);
     }
 
+    // Run in reverse order
     atexit(save_store_list);
+    atexit(sync_stores);
+
+    struct sigaction action = { .sa_handler = handle_signal };
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
 
     eyeq_server(listen_endpoint, &stores, &streams);
 
@@ -1,8 +1,10 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <assert.h>
 #include <strings.h>
 #include <errno.h>
+#include <math.h>
 
 #include <zmq.h>
 #include <eyeq/server.h>
@@ -13,12 +15,13 @@
 #include "../proto/samples.pb.h"
 #include "util.h"
 
+#define READ_BLOCKS_BATCH 64
+
 typedef struct {
     uint8_t ident[100];
     int ident_length;
     uint32_t req_id;
     void *responder;
-    uint8_t output_buffer[eyeq_ServerResponse_size];
     store_list_t *stores;
     stream_list_t *streams;
     eyeq_ServerResponse response;
@@ -29,12 +32,20 @@ static void send_response(server_context_t *ctx) {
     zmq_send(ctx->responder, ctx->ident, ctx->ident_length, ZMQ_SNDMORE);
     zmq_send(ctx->responder, 0, 0, ZMQ_SNDMORE);
     ctx->response.req_id = ctx->req_id;
-    pb_ostream_t ostream = pb_ostream_from_buffer(ctx->output_buffer, eyeq_ServerResponse_size);
-    if (pb_encode(&ostream, eyeq_ServerResponse_fields, &ctx->response)) {
-        zmq_send(ctx->responder, ctx->output_buffer, ostream.bytes_written, 0);
-    } else {
-        zmq_send(ctx->responder, "", 0, 0);
+
+    // Responses carry blocks of up to BLOCK_MAX_LENGTH, so they are encoded straight into
+    // a message of their exact size
+    size_t size;
+    zmq_msg_t msg;
+    if (pb_get_encoded_size(&size, eyeq_ServerResponse_fields, &ctx->response) && !zmq_msg_init_size(&msg, size)) {
+        pb_ostream_t ostream = pb_ostream_from_buffer(zmq_msg_data(&msg), size);
+        if (pb_encode(&ostream, eyeq_ServerResponse_fields, &ctx->response)) {
+            zmq_msg_send(&msg, ctx->responder, 0);
+            return;
+        }
+        zmq_msg_close(&msg);
     }
+    zmq_send(ctx->responder, "", 0, 0);
 }
 
 static void handle_create_store(server_context_t *ctx, eyeq_Store *request) {
@@ -44,12 +55,27 @@ static void handle_create_store(server_context_t *ctx, eyeq_Store *request) {
         return;
     }
 
+    if (request->block_size && !store_valid_block_size(request->block_size)) {
+        sprintf(ctx->response.error, "Block size should be a power of two from %d to %d bytes", BLOCK_LENGTH, BLOCK_MAX_LENGTH);
+        send_response(ctx);
+        return;
+    }
+
     store_t *store;
 
     if (request->store_type == eyeq_StoreType_MEMORY_STORE) {
-        store = new_memory_store(request->block_count);
+        store = new_snapshot_memory_store(request->file_path, request->block_count, request->block_size,
+                                          request->numa_bind ? (int)request->numa_node : -1, request->hugepages, true);
     } else if (request->store_type == eyeq_StoreType_FILE_STORE) {
-        store = new_file_store(request->file_path, request->block_count, true);
+        store = new_file_store(request->file_path, request->block_count, request->block_size, true);
+    } else if (request->store_type == eyeq_StoreType_MMAP_STORE) {
+        store = new_mmap_store(request->file_path, request->block_count, request->block_size, true);
+    } else if (request->store_type == eyeq_StoreType_DIRECT_STORE) {
+        store = new_direct_store(request->file_path, request->block_count, request->block_size, true);
+    } else if (request->store_type == eyeq_StoreType_TIERED_STORE) {
+        store = new_tiered_store(request->file_path, request->block_count, request->block_size, request->hot_block_count, true);
+    } else if (request->store_type == eyeq_StoreType_STRIPED_STORE) {
+        store = new_striped_store(request->file_path, request->block_count, request->block_size, true);
     } else {
         sprintf(ctx->response.error, "Unknown store type %d!", request->store_type);
         send_response(ctx);
@@ -62,6 +88,35 @@ static void handle_create_store(server_context_t *ctx, eyeq_Store *request) {
         return;
     }
 
+    if (store_set_codec(store, request->codec) != STORE_OK) {
+        free_store(store);
+        sprintf(ctx->response.error, "Unknown codec %d!", request->codec);
+        send_response(ctx);
+        return;
+    }
+
+    store_set_verify(store, request->verify_crc);
+    if (request->scrub_rate && store_set_scrub_rate(store, request->scrub_rate) != STORE_OK) {
+        free_store(store);
+        sprintf(ctx->response.error, "Could not start scrubbing the store");
+        send_response(ctx);
+        return;
+    }
+
+    if (store_set_durability(store, request->durability, request->sync_interval_ms, request->sync_blocks) != STORE_OK) {
+        free_store(store);
+        sprintf(ctx->response.error, "Durability %d not supported by this store", request->durability);
+        send_response(ctx);
+        return;
+    }
+
+    if (store_set_ingest_queue(store, request->ingest_queue_blocks) != STORE_OK) {
+        free_store(store);
+        sprintf(ctx->response.error, "Could not set up an ingest queue for this store");
+        send_response(ctx);
+        return;
+    }
+
     int res = add_store(request->name, request->path, ctx->stores, store);
     if (res != STORE_OK) {
         free_store(store);
@@ -72,24 +127,55 @@ static void handle_create_store(server_context_t *ctx, eyeq_Store *request) {
 
     ctx->response.which_resp = eyeq_ServerResponse_create_store_response_tag;
     memcpy(&ctx->response.resp.create_store_response.store, request, sizeof(eyeq_Store));
+    ctx->response.resp.create_store_response.store.block_count = store->block_count;
+    ctx->response.resp.create_store_response.store.block_size = store->block_size;
     send_response(ctx);
 }
 
 bool store_list_iterator(void *context, const char *name, const char *path, store_t *store) {
-    eyeq_ServerResponse *sr = ((eyeq_ServerResponse *)context);
-    eyeq_Store *s = &sr->resp.list_stores_response.stores[sr->resp.list_stores_response.stores_count++];
-    sprintf(s->name, name, STORE_MAX_NAME);
-    sprintf(s->path, path, STORE_MAX_PATH);
+    eyeq_ListStores_Response *response = &((eyeq_ServerResponse *)context)->resp.list_stores_response;
+    pb_size_t max_count = sizeof(response->stores) / sizeof(response->stores[0]);
+
+    // The page is full, the next one continues after its last store
+    if (response->stores_count == max_count) {
+        eyeq_Store *last = &response->stores[max_count - 1];
+        strcpy(response->next_path, last->path);
+        strcpy(response->next_name, last->name);
+        return true;
+    }
+
+    eyeq_Store *s = &response->stores[response->stores_count++];
+    snprintf(s->name, sizeof(s->name), "%s", name);
+    snprintf(s->path, sizeof(s->path), "%s", path);
     s->block_count = store->block_count;
+    s->block_size = store->block_size;
     s->block_offset = store->write_offset;
     s->store_type = store->store_type;
+    s->codec = store->codec;
+    s->verify_crc = store->verify_crc;
+    s->scrub_rate = store->scrub_rate;
+    s->durability = store->durability;
+    s->sync_interval_ms = store->sync_interval_ms;
+    s->sync_blocks = store->sync_blocks;
+    s->ingest_queue_blocks = store_ingest_queue_blocks(store);
+    s->read_only = store->read_only;
+    store_memory_usage(store, &s->reserved_bytes, &s->resident_bytes);
+
+    // Report the first bad blocks
+    s->bad_block_count = __atomic_load_n(&store->bad_block_count, __ATOMIC_RELAXED);
+    pb_size_t max_bad_blocks = sizeof(s->bad_blocks) / sizeof(s->bad_blocks[0]);
+    for (uint32_t offset = 0; s->bad_block_count && offset < store->block_count && s->bad_blocks_count < max_bad_blocks; offset++) {
+        if (store_is_bad_block(store, offset)) {
+            s->bad_blocks[s->bad_blocks_count++] = offset;
+        }
+    }
 
-    return sr->resp.list_stores_response.stores_count >= 64;
+    return false;
 }
 
-// iterate_store_list(const char *path, store_list_t *list, iterate_stores_callback cb, void *context);
 static void handle_list_stores(server_context_t *ctx, eyeq_ListStores *request) {
-    iterate_store_list(request->path, ctx->stores, store_list_iterator, &ctx->response);
+    iterate_store_list_after(request->path, request->after_path, request->after_name, ctx->stores,
+                             store_list_iterator, &ctx->response);
     ctx->response.which_resp = eyeq_ServerResponse_list_stores_response_tag;
     send_response(ctx);
 }
@@ -106,6 +192,59 @@ static void handle_delete_store(server_context_t *ctx, eyeq_DeleteStore *request
     send_response(ctx);
 }
 
+static void handle_snapshot_store(server_context_t *ctx, eyeq_SnapshotStore *request) {
+    store_t *source = find_store(request->name, request->path, ctx->stores);
+    if (!source) {
+        sprintf(ctx->response.error, "Store does not exist");
+        send_response(ctx);
+        return;
+    }
+
+    if (find_store(request->snapshot_name, request->snapshot_path, ctx->stores)) {
+        sprintf(ctx->response.error, "Store already exists");
+        send_response(ctx);
+        return;
+    }
+
+    store_t *store;
+    int res = store_snapshot(source, request->file_path, request->start_block, request->block_count, &store);
+    if (res == STORE_NOT_FOUND) {
+        sprintf(ctx->response.error, "Blocks %u to %u are not in the store", request->start_block,
+                request->start_block + request->block_count);
+        send_response(ctx);
+        return;
+    } else if (res == STORE_NOT_SUPPORTED) {
+        sprintf(ctx->response.error, "Snapshots are not supported by this store");
+        send_response(ctx);
+        return;
+    } else if (res != STORE_OK) {
+        sprintf(ctx->response.error, "Could not create snapshot: %d", res);
+        send_response(ctx);
+        return;
+    }
+
+    res = add_store(request->snapshot_name, request->snapshot_path, ctx->stores, store);
+    if (res != STORE_OK) {
+        free_store(store);
+        sprintf(ctx->response.error, "Could not add store to store list: %d", res);
+        send_response(ctx);
+        return;
+    }
+
+    ctx->response.which_resp = eyeq_ServerResponse_snapshot_store_response_tag;
+    eyeq_Store *s = &ctx->response.resp.snapshot_store_response.store;
+    snprintf(s->name, sizeof(s->name), "%s", request->snapshot_name);
+    snprintf(s->path, sizeof(s->path), "%s", request->snapshot_path);
+    snprintf(s->file_path, sizeof(s->file_path), "%s", request->file_path);
+    s->store_type = store->store_type;
+    s->block_count = store->block_count;
+    s->block_size = store->block_size;
+    s->block_offset = store->write_offset;
+    s->codec = store->codec;
+    s->read_only = true;
+    send_response(ctx);
+}
+
 static void handle_write_block(server_context_t *ctx, eyeq_WriteBlock *request) {
     store_t *store = find_store(request->name, request->path, ctx->stores);
     if (!store) {
@@ -114,19 +253,46 @@ static void handle_write_block(server_context_t *ctx, eyeq_WriteBlock *request)
         return;
     }
 
-    block_t block;
-    memcpy(&block, request->block.data.bytes, request->block.data.size);
-    block.hdr.block_length = request->block.data.size;
+    // A batch of blocks is written with a single store write
+    eyeq_Block *input = request->blocks_count ? request->blocks : &request->block;
+    uint32_t count = request->blocks_count ? request->blocks_count : 1;
 
-    int res = store_write_block(store, &block, request->offset);
-    if (res != STORE_OK) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (!input[i].data || input[i].data->size < BLOCK_HEADER_LENGTH || input[i].data->size > store->block_size) {
+            sprintf(ctx->response.error, "Blocks should be %d to %u bytes long", BLOCK_HEADER_LENGTH, store->block_size);
+            send_response(ctx);
+            return;
+        }
+    }
+
+    block_t *blocks = store_alloc_blocks(store, count);
+    if (!blocks) {
+        sprintf(ctx->response.error, "Out of memory");
+        send_response(ctx);
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        block_t *block = store_block(store, blocks, i);
+        memcpy(block, input[i].data->bytes, input[i].data->size);
+        block_set_length(block, input[i].data->size);
+    }
+
+    int res = store_write_blocks(store, blocks, request->offset, count);
+    uint32_t offset = blocks->hdr.block_id;
+    free(blocks);
+    if (res == STORE_READ_ONLY) {
+        sprintf(ctx->response.error, "Store is read-only");
+        send_response(ctx);
+        return;
+    } else if (res != STORE_OK) {
         sprintf(ctx->response.error, "Error while writing block.");
         send_response(ctx);
         return;
     }
 
     ctx->response.which_resp = eyeq_ServerResponse_write_block_response_tag;
-    ctx->response.resp.write_block_response.offset = block.hdr.block_id;
+    ctx->response.resp.write_block_response.offset = offset;
     send_response(ctx);
 }
 
@@ -144,25 +310,171 @@ static void handle_read_blocks(server_context_t *ctx, eyeq_ReadBlocks *request)
         return;
     }
 
-    for (int i = 0; i < request->count; i++) {
-        block_t block;
-        int res = store_read_block(store, &block, request->offset+i);
+    uint32_t offset = request->offset;
+    if (request->time.sec || request->time.nsec) {
+        uint64_t time_ns = request->time.sec * 1000000000 + request->time.nsec;
+        if (store_find_time(store, time_ns, &offset) != STORE_OK) {
+            sprintf(ctx->response.error, "No blocks at that time");
+            send_response(ctx);
+            return;
+        }
+    }
+
+    block_t *batch = NULL;
+    uint32_t batch_start = 0;
+    uint32_t batch_count = 0;
+    pb_bytes_array_t *data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(store->block_size));
+    if (!data) {
+        sprintf(ctx->response.error, "Out of memory");
+        send_response(ctx);
+        return;
+    }
+
+    for (uint32_t i = 0; i < request->count; i++) {
+        const block_t *block;
+
+        // Mapped blocks are copied straight into the response, the others are read
+        // READ_BLOCKS_BATCH blocks at a time. Stores map some blocks and not others, so the
+        // batch is refilled whenever the block is not in it.
+        int res = store_map_block(store, &block, offset+i);
+        if (res == STORE_NOT_MAPPED) {
+            res = STORE_OK;
+            if (i - batch_start >= batch_count) {
+                if (!batch) {
+                    batch = store_alloc_blocks(store, min(request->count, READ_BLOCKS_BATCH));
+                }
+                batch_start = i;
+                batch_count = min(request->count - i, READ_BLOCKS_BATCH);
+                res = batch ? store_read_blocks(store, batch, offset+i, batch_count) : STORE_OUT_OF_MEMORY;
+            }
+            block = store_block(store, batch, i - batch_start);
+        }
         if (res != STORE_OK) {
-            sprintf(ctx->response.error, "Error while writing block.");
+            sprintf(ctx->response.error, "Error while reading block.");
+            send_response(ctx);
+            free(batch);
+            free(data);
             return;
         }
 
         ctx->response.which_resp = eyeq_ServerResponse_read_blocks_response_tag;
 
         eyeq_ReadBlocks_Response *resp = &ctx->response.resp.read_blocks_response;
-        memcpy(resp->block.data.bytes, &block, block.hdr.block_length);
-        resp->block.data.size = block.hdr.block_length;
+        data->size = min(block_get_length(block), store->block_size);
+        memcpy(data->bytes, block, data->size);
+        resp->block.data = data;
         send_response(ctx);
     }
+
+    // The response is cleared for the next request, it must not free this
+    ctx->response.resp.read_blocks_response.block.data = NULL;
+    free(batch);
+    free(data);
+}
+
+static void handle_query_blocks(server_context_t *ctx, eyeq_QueryBlocks *request) {
+    store_t *store = find_store(request->name, request->path, ctx->stores);
+    if (!store) {
+        sprintf(ctx->response.error, "Store does not exist");
+        send_response(ctx);
+        return;
+    }
+
+    store_query_t query = {
+        .match_source_id = request->match_source_id,
+        .source_id = request->source_id,
+        .match_block_type = request->match_block_type,
+        .block_type = request->block_type,
+        .match_frequency = request->match_frequency,
+        .min_frequency = request->min_frequency,
+        .max_frequency = request->max_frequency,
+        .match_sample_rate = request->match_sample_rate,
+        .min_sample_rate = request->min_sample_rate,
+        .max_sample_rate = request->max_sample_rate,
+        .start_time_ns = request->start_time.sec * 1000000000 + request->start_time.nsec,
+        .end_time_ns = request->end_time.sec * 1000000000 + request->end_time.nsec,
+        .match_power = request->match_power,
+        .min_power = powf(10, request->min_power_db / 10),
+        .max_power = powf(10, request->max_power_db / 10),
+    };
+
+    eyeq_QueryBlocks_Response *resp = &ctx->response.resp.query_blocks_response;
+    store_run_t runs[sizeof(resp->runs) / sizeof(resp->runs[0])];
+    uint32_t count, next;
+    store_query_blocks(store, &query, request->start_block, runs, sizeof(runs) / sizeof(runs[0]), &count, &next);
+
+    ctx->response.which_resp = eyeq_ServerResponse_query_blocks_response_tag;
+    for (uint32_t i = 0; i < count; i++) {
+        resp->runs[i].start_block = runs[i].start_block;
+        resp->runs[i].block_count = runs[i].block_count;
+    }
+    resp->runs_count = count;
+    resp->next_block = next;
+    resp->more = next < store->write_offset;
+    send_response(ctx);
+}
+
+static void handle_block_stats(server_context_t *ctx, eyeq_BlockStats *request) {
+    store_t *store = find_store(request->name, request->path, ctx->stores);
+    if (!store) {
+        sprintf(ctx->response.error, "Store does not exist");
+        send_response(ctx);
+        return;
+    }
+
+    eyeq_BlockStats_Response *resp = &ctx->response.resp.block_stats_response;
+    uint32_t max_count = sizeof(resp->mean_power) / sizeof(resp->mean_power[0]);
+    block_stats_t *stats = malloc(max_count * sizeof(block_stats_t));
+    if (!stats) {
+        sprintf(ctx->response.error, "Out of memory");
+        send_response(ctx);
+        return;
+    }
+
+    uint32_t from = request->start_block, count;
+    uint32_t stride = max(request->stride, 1);
+    if (store_block_stats(store, &from, stride, stats, max_count, &count) != STORE_OK) {
+        free(stats);
+        sprintf(ctx->response.error, "No blocks from %u on", request->start_block);
+        send_response(ctx);
+        return;
+    }
+
+    ctx->response.which_resp = eyeq_ServerResponse_block_stats_response_tag;
+    resp->start_block = from;
+    resp->stride = stride;
+    for (uint32_t i = 0; i < count; i++) {
+        resp->mean_power[i] = stats[i].mean_power;
+        resp->peak_magnitude[i] = stats[i].peak_magnitude;
+        resp->dc_i[i] = stats[i].dc_i;
+        resp->dc_q[i] = stats[i].dc_q;
+        resp->clip_count[i] = stats[i].clip_count;
+    }
+    resp->mean_power_count = resp->peak_magnitude_count = resp->dc_i_count = resp->dc_q_count =
+        resp->clip_count_count = count;
+    free(stats);
+    send_response(ctx);
+}
+
+static bool store_sync_iterator(void *context, const char *name, const char *path, store_t *store) {
+    if (store_sync(store) != STORE_OK) {
+        (*(int *)context)++;
+    }
+    return false;
 }
 
 static void handle_flush_stores(server_context_t *ctx, eyeq_FlushStores *requests) {
+    int failed = 0;
+    iterate_store_list("", ctx->stores, store_sync_iterator, &failed);
     save_store_list();
+
+    if (failed) {
+        sprintf(ctx->response.error, "Could not sync %d stores", failed);
+    } else {
+        ctx->response.which_resp = eyeq_ServerResponse_flush_stores_response_tag;
+        ctx->response.resp.flush_stores_response.success = true;
+    }
+    send_response(ctx);
 }
 
 static void handle_create_stream(server_context_t *ctx, eyeq_CreateStream *request) {
@@ -208,8 +520,7 @@ static void handle_create_stream(server_context_t *ctx, eyeq_CreateStream *reque
         case eyeq_StreamLayer_frequency_translate_tag: {
             eyeq_FrequencyTranslateStream *fts = &layer->layer.frequency_translate;
 
-            stream_t *sine = new_complex_sine_stream(fts->phase, fts->relative_frequency, 1.0);
-            stream = new_complex_multiply_stream(stream, sine);
+            stream = new_frequency_translate_stream(stream, fts->relative_frequency, fts->phase);
 
             break;
         }
@@ -218,8 +529,29 @@ static void handle_create_stream(server_context_t *ctx, eyeq_CreateStream *reque
             break;
         case eyeq_StreamLayer_fir_filter_tag: {
             eyeq_FirFilterStream *ffs = &layer->layer.fir_filter;
+            if (ffs->filter_taps_count > FIR_MAX_TAPS) {
+                if (stream) {
+                    free_stream(stream);
+                }
+                sprintf(ctx->response.error, "Too many filter taps: %d, at most %d", (int)ffs->filter_taps_count, FIR_MAX_TAPS);
+                send_response(ctx);
+                return;
+            }
+            if (ffs->interpolation > FIR_MAX_RATE || ffs->decimation > FIR_MAX_RATE) {
+                if (stream) {
+                    free_stream(stream);
+                }
+                sprintf(ctx->response.error, "Interpolation and decimation are at most %d", FIR_MAX_RATE);
+                send_response(ctx);
+                return;
+            }
 
-            stream = new_fir_stream(stream, ffs->filter_taps, ffs->filter_taps_count, ffs->is_complex);
+            if (ffs->interpolation > 1 || ffs->decimation > 1) {
+                stream = new_polyphase_fir_stream(stream, ffs->filter_taps, ffs->filter_taps_count, ffs->is_complex,
+                                                  max(ffs->interpolation, 1), max(ffs->decimation, 1));
+            } else {
+                stream = new_fir_stream(stream, ffs->filter_taps, ffs->filter_taps_count, ffs->is_complex);
+            }
 
             break;
         }
@@ -303,8 +635,18 @@ static void handle_seek_stream(server_context_t *ctx, eyeq_SeekStream *request)
         return;
     }
 
+    uint32_t block_id = request->block_id;
+    if (request->time.sec || request->time.nsec) {
+        uint64_t time_ns = request->time.sec * 1000000000 + request->time.nsec;
+        if (!stream->find_time || !stream->find_time(stream, time_ns, &block_id)) {
+            sprintf(ctx->response.error, "Stream cannot seek by time");
+            send_response(ctx);
+            return;
+        }
+    }
+
     if (stream->seek) {
-        stream->seek(stream, request->block_id);
+        stream->seek(stream, block_id);
     }
 
     ctx->response.which_resp = eyeq_ServerResponse_seek_stream_response_tag;
@@ -336,22 +678,30 @@ static void handle_stream_info(server_context_t *ctx, eyeq_StreamInfo *request)
 }
 
 bool stream_list_iterator(void *context, const char *name, const char *path, stream_t *store) {
-    eyeq_ServerResponse *sr = ((eyeq_ServerResponse *)context);
-    eyeq_Stream *s = &sr->resp.list_streams_response.streams[sr->resp.list_streams_response.streams_count++];
-    sprintf(s->name, name, STORE_MAX_NAME);
-    sprintf(s->path, path, STORE_MAX_PATH);
+    eyeq_ListStreams_Response *response = &((eyeq_ServerResponse *)context)->resp.list_streams_response;
+    pb_size_t max_count = sizeof(response->streams) / sizeof(response->streams[0]);
+
+    if (response->streams_count == max_count) {
+        eyeq_Stream *last = &response->streams[max_count - 1];
+        strcpy(response->next_path, last->path);
+        strcpy(response->next_name, last->name);
+        return true;
+    }
 
-    return sr->resp.list_streams_response.streams_count >= 64;
+    eyeq_Stream *s = &response->streams[response->streams_count++];
+    snprintf(s->name, sizeof(s->name), "%s", name);
+    snprintf(s->path, sizeof(s->path), "%s", path);
+
+    return false;
 }
 
 static void handle_list_streams(server_context_t *ctx, eyeq_ListStreams *request) {
-    iterate_stream_list(request->path, ctx->streams, stream_list_iterator, &ctx->response);
+    iterate_stream_list_after(request->path, request->after_path, request->after_name, ctx->streams,
+                              stream_list_iterator, &ctx->response);
     ctx->response.which_resp = eyeq_ServerResponse_list_streams_response_tag;
     send_response(ctx);
 }
 
-
-
 void eyeq_server(const char *endpoint, store_list_t *stores, stream_list_t *streams) {
     void *context = zmq_ctx_new();
     void *responder = zmq_socket(context, ZMQ_ROUTER);
@@ -364,8 +714,9 @@ void eyeq_server(const char *endpoint, store_list_t *stores, stream_list_t *stre
         .streams = streams,
     };
 
-    uint8_t input_buffer[eyeq_ServerRequest_size];
+    uint8_t empty_frame[1];
     eyeq_ServerRequest request;
+    zmq_msg_t msg;
 
     while (1) {
         ctx.ident_length = zmq_recv(ctx.responder, ctx.ident, 100, 0);
@@ -386,7 +737,7 @@ void eyeq_server(const char *endpoint, store_list_t *stores, stream_list_t *stre
         }
 
         // Receive empty frame
-        int nbytes = zmq_recv(ctx.responder, input_buffer, eyeq_ServerRequest_size, 0);
+        int nbytes = zmq_recv(ctx.responder, empty_frame, sizeof(empty_frame), 0);
         if (nbytes) {
             continue;
         }
@@ -399,15 +750,17 @@ void eyeq_server(const char *endpoint, store_list_t *stores, stream_list_t *stre
             continue;
         }
 
-        // Receive contents
-        nbytes = zmq_recv(ctx.responder, input_buffer, eyeq_ServerRequest_size, 0);
+        // Receive contents, of any size since blocks vary in size between stores
+        zmq_msg_init(&msg);
+        nbytes = zmq_msg_recv(&msg, ctx.responder, 0);
         if (nbytes == -1) {
+            zmq_msg_close(&msg);
             break;
         }
 
         bzero(&ctx.response, sizeof(eyeq_ServerResponse));
 
-        pb_istream_t stream = pb_istream_from_buffer(input_buffer, nbytes);
+        pb_istream_t stream = pb_istream_from_buffer(zmq_msg_data(&msg), nbytes);
         if (pb_decode(&stream, eyeq_ServerRequest_fields, &request)) {
             ctx.req_id = request.req_id;
             // printf("Handling request: %d\n", request.which_req);
@@ -449,12 +802,23 @@ void eyeq_server(const char *endpoint, store_list_t *stores, stream_list_t *stre
             case eyeq_ServerRequest_list_streams_tag:
                 handle_list_streams(&ctx, &request.req.list_streams);
                 break;
+            case eyeq_ServerRequest_snapshot_store_tag:
+                handle_snapshot_store(&ctx, &request.req.snapshot_store);
+                break;
+            case eyeq_ServerRequest_query_blocks_tag:
+                handle_query_blocks(&ctx, &request.req.query_blocks);
+                break;
+            case eyeq_ServerRequest_block_stats_tag:
+                handle_block_stats(&ctx, &request.req.block_stats);
+                break;
             }
+            pb_release(eyeq_ServerRequest_fields, &request);
         } else {
             // Set error message
             sprintf(ctx.response.error, "Could not decode packet of length %d", nbytes);
             send_response(&ctx);
         }
+        zmq_msg_close(&msg);
     }
 
     zmq_close(responder);
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <eyeq/server/store.h>
+
+// Reads a direct store in random batches of blocks and in random single blocks, with pread
+// and at different io_uring queue depths.
+//
+// usage: eyeq-store-bench [filename] [block_count] [block_size]
+//
+// The file (or block device) should be on the device to measure, O_DIRECT does not work
+// on tmpfs.
+
+#define BATCH_BLOCKS 64
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Reads as many blocks as the store has, in batch_blocks runs at random offsets
+static int bench_reads(store_t *store, block_t *blocks, uint32_t batch_blocks, uint32_t queue_depth) {
+    int res = store_set_queue_depth(store, queue_depth);
+    if (res != STORE_OK) {
+        fprintf(stderr, "Queue depth %u is not supported: %d\n", queue_depth, res);
+        return res;
+    }
+
+    uint32_t batches = store->block_count / batch_blocks;
+    srand(1);
+
+    double start = now();
+    for (uint32_t i = 0; i < batches; i++) {
+        uint32_t offset = (rand() % batches) * batch_blocks;
+        res = store_read_blocks(store, blocks, offset, batch_blocks);
+        if (res != STORE_OK) {
+            fprintf(stderr, "Error reading blocks: %d\n", res);
+            return res;
+        }
+    }
+    double elapsed = now() - start;
+
+    double total = (double)batches * batch_blocks;
+    if (queue_depth) {
+        printf("%2u blocks, io_uring, queue depth %2u: %8.0f blocks/s %8.1f MB/s\n", batch_blocks, queue_depth,
+               total / elapsed, total * store->block_size / elapsed / 1e6);
+    } else {
+        printf("%2u blocks, pread:                   %8.0f blocks/s %8.1f MB/s\n", batch_blocks,
+               total / elapsed, total * store->block_size / elapsed / 1e6);
+    }
+
+    return STORE_OK;
+}
+
+int main(int argc, char *argv[]) {
+    const char *filename = argc > 1 ? argv[1] : "eyeq_bench_store.dat";
+    uint32_t block_count = argc > 2 ? strtoul(argv[2], NULL, 10) : 8192;
+    uint32_t block_size = argc > 3 ? strtoul(argv[3], NULL, 10) : BLOCK_LENGTH;
+
+    if (block_count < BATCH_BLOCKS) {
+        fprintf(stderr, "Need at least %d blocks\n", BATCH_BLOCKS);
+        return 1;
+    }
+
+    store_t *store = new_direct_store(filename, block_count, block_size, true);
+    if (!store) {
+        return 1;
+    }
+
+    block_t *blocks = store_alloc_blocks(store, BATCH_BLOCKS);
+    if (!blocks) {
+        free_store(store);
+        return 1;
+    }
+
+    // Fill the store so every read hits written data
+    for (uint32_t i = 0; i < BATCH_BLOCKS; i++) {
+        block_set_length(store_block(store, blocks, i), store->block_size);
+    }
+    for (uint32_t i = 0; i + BATCH_BLOCKS <= store->block_count; i += BATCH_BLOCKS) {
+        if (store_write_blocks(store, blocks, -1, BATCH_BLOCKS) != STORE_OK) {
+            fprintf(stderr, "Error writing blocks\n");
+            free(blocks);
+            free_store(store);
+            return 1;
+        }
+    }
+
+    printf("%u blocks of %u bytes\n", store->block_count, store->block_size);
+
+    // 0 is a single synchronous pread per batch, for comparison. Single blocks are read with
+    // pread at any queue depth, they show the cost of one request.
+    const uint32_t batch_sizes[] = { BATCH_BLOCKS, 1 };
+    const uint32_t queue_depths[] = { 0, 1, 8, 32 };
+    int res = STORE_OK;
+    for (size_t i = 0; !res && i < sizeof(batch_sizes) / sizeof(batch_sizes[0]); i++) {
+        for (size_t j = 0; !res && j < sizeof(queue_depths) / sizeof(queue_depths[0]); j++) {
+            res = bench_reads(store, blocks, batch_sizes[i], queue_depths[j]);
+        }
+    }
+
+    free(blocks);
+    free_store(store);
+    if (argc < 2) {
+        unlink(filename);
+    }
+
+    return res ? 1 : 0;
+}
@@ -0,0 +1,282 @@
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "codec.h"
+#include "../util.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CODEC_AVX2
+#endif
+
+/*
+ * Delta codec for 8 and 16 bit integer samples. Every sample is predicted by the previous
+ * sample of the same channel, and the zigzag encoded residuals are bit packed in frames of
+ * CODEC_FRAME_SAMPLES residuals, each frame as wide as its largest residual:
+ *
+ *   [width:8][CODEC_FRAME_SAMPLES residuals of width bits, LSB first] ...
+ *
+ * ADCs that do not use their full range, and oversampled signals, only need a few bits
+ * per residual.
+ */
+#define CODEC_FRAME_SAMPLES 64
+#define CODEC_MAX_CHANNELS 8
+
+// The unpacker loads 8 bytes at a time, so keep that much room after the packed data
+#define CODEC_SLACK 8
+
+static inline uint32_t zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t unzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static int sample_size(uint16_t block_type) {
+    if (block_type == BLOCK_TYPE_I8_SAMPLES) {
+        return 1;
+    } else if (block_type == BLOCK_TYPE_I16_SAMPLES) {
+        return 2;
+    }
+    return 0;
+}
+
+static uint32_t channel_count(const block_t *block) {
+    uint32_t channels = block->hdr.sample_block_header.num_channels;
+    return channels >= 1 && channels <= CODEC_MAX_CHANNELS ? channels : 1;
+}
+
+bool codec_compress_block(int codec, const block_t *input, block_t *output, uint32_t block_size) {
+    int size = sample_size(input->hdr.block_type);
+    uint32_t length = block_get_length(input);
+    if (codec != BLOCK_CODEC_DELTA || !size || length <= BLOCK_HEADER_LENGTH || length > block_size ||
+        (length - BLOCK_HEADER_LENGTH) % size) {
+        return false;
+    }
+
+    uint32_t count = (length - BLOCK_HEADER_LENGTH) / size;
+    uint32_t channels = channel_count(input);
+    int32_t previous[CODEC_MAX_CHANNELS] = { 0 };
+    uint32_t channel = 0;
+
+    // Give up as soon as the packed data is no smaller than the samples
+    size_t limit = min((size_t)length - BLOCK_HEADER_LENGTH - 1, block_payload_size(block_size) - CODEC_SLACK);
+    const int8_t *i8_samples = block_payload(input);
+    const int16_t *i16_samples = block_payload(input);
+    uint8_t *out = block_payload(output);
+    size_t pos = 0;
+
+    for (uint32_t start = 0; start < count; start += CODEC_FRAME_SAMPLES) {
+        uint32_t n = min(count - start, CODEC_FRAME_SAMPLES);
+        uint32_t residuals[CODEC_FRAME_SAMPLES];
+        uint32_t bits = 0;
+
+        for (uint32_t k = 0; k < n; k++) {
+            int32_t sample = size == 1 ? i8_samples[start + k] : i16_samples[start + k];
+            residuals[k] = zigzag(sample - previous[channel]);
+            previous[channel] = sample;
+            bits |= residuals[k];
+            channel = channel + 1 == channels ? 0 : channel + 1;
+        }
+
+        uint32_t width = bits ? 32 - __builtin_clz(bits) : 0;
+        if (pos + 1 + (n * width + 7) / 8 > limit) {
+            return false;
+        }
+
+        out[pos++] = width;
+
+        uint64_t acc = 0;
+        uint32_t acc_bits = 0;
+        for (uint32_t k = 0; k < n; k++) {
+            acc |= (uint64_t)residuals[k] << acc_bits;
+            acc_bits += width;
+            while (acc_bits >= 8) {
+                out[pos++] = (uint8_t)acc;
+                acc >>= 8;
+                acc_bits -= 8;
+            }
+        }
+        if (acc_bits) {
+            out[pos++] = (uint8_t)acc;
+        }
+    }
+
+    memcpy(output->hdr_bytes, input->hdr_bytes, BLOCK_HEADER_LENGTH);
+    output->hdr.codec = codec;
+    block_set_raw_length(output, length);
+    block_set_length(output, BLOCK_HEADER_LENGTH + pos);
+
+    return true;
+}
+
+// Branch free unpacking: every residual is within one unaligned 8 byte load
+static inline void codec_unpack_residuals(const uint8_t *in, uint32_t width, uint32_t from, uint32_t n, int size,
+                                          uint32_t channels, uint32_t *channel, int32_t *previous, void *samples) {
+    uint64_t mask = ((uint64_t)1 << width) - 1;
+    uint64_t bit = (uint64_t)from * width;
+    uint32_t c = *channel;
+
+    for (uint32_t k = from; k < n; k++) {
+        uint64_t word;
+        memcpy(&word, &in[bit >> 3], sizeof(word));
+        int32_t sample = previous[c] + unzigzag((word >> (bit & 7)) & mask);
+        previous[c] = sample;
+        bit += width;
+
+        if (size == 1) {
+            ((int8_t *)samples)[k] = (int8_t)sample;
+        } else {
+            ((int16_t *)samples)[k] = (int16_t)sample;
+        }
+        c = c + 1 == channels ? 0 : c + 1;
+    }
+
+    *channel = c;
+}
+
+static void codec_unpack_scalar(const uint8_t *in, uint32_t width, uint32_t n, int size, uint32_t channels,
+                                uint32_t *channel, int32_t *previous, void *samples) {
+    codec_unpack_residuals(in, width, 0, n, size, channels, channel, previous, samples);
+}
+
+#ifdef CODEC_AVX2
+/*
+ * Eight residuals at a time: each one is gathered with a 4 byte load, which holds any
+ * width up to 17 bits at any bit offset, and the samples of every channel are summed up
+ * with log2(8 / channels) shifts across the vector. Vectors only line up with the channels
+ * for 1, 2, 4 and 8 of them, others are unpacked one residual at a time.
+ */
+__attribute__((target("avx2")))
+static void codec_unpack_avx2(const uint8_t *in, uint32_t width, uint32_t n, int size, uint32_t channels,
+                              uint32_t *channel, int32_t *previous, void *samples) {
+    uint32_t k = 0;
+
+    if (!(8 % channels) && *channel == 0 && n >= 8) {
+        const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i lane_channel = _mm256_and_si256(lanes, _mm256_set1_epi32(channels - 1));
+        const __m256i mask = _mm256_set1_epi32((1u << width) - 1);
+        const __m256i one = _mm256_set1_epi32(1), seven = _mm256_set1_epi32(7);
+        const __m256i advance = _mm256_set1_epi32(8 * width);
+
+        // Lane i gets lane i - shift, or zero, for each shift of the running sums
+        __m256i shift_index[3], shift_keep[3];
+        int shifts = 0;
+        for (uint32_t shift = channels; shift < 8; shift *= 2, shifts++) {
+            shift_index[shifts] = _mm256_and_si256(_mm256_sub_epi32(lanes, _mm256_set1_epi32(shift)), seven);
+            shift_keep[shifts] = _mm256_cmpgt_epi32(lanes, _mm256_set1_epi32(shift - 1));
+        }
+
+        // The previous sample of the channel of every lane, and where the next vector takes
+        // it from
+        __m256i carry = _mm256_i32gather_epi32(previous, lane_channel, 4);
+        const __m256i last = _mm256_add_epi32(lane_channel, _mm256_set1_epi32(8 - channels));
+        // The low 1 or 2 bytes of every lane, moved to the low 8 or 16 bytes
+        const __m256i narrow = size == 1 ?
+            _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                             0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1) :
+            _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+                             0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        const __m256i halves = size == 1 ? _mm256_setr_epi32(0, 4, 1, 2, 3, 5, 6, 7)
+                                         : _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+
+        __m256i bits = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(width));
+        for (; k + 8 <= n; k += 8) {
+            __m256i word = _mm256_i32gather_epi32((const int *)in, _mm256_srli_epi32(bits, 3), 1);
+            __m256i r = _mm256_and_si256(_mm256_srlv_epi32(word, _mm256_and_si256(bits, seven)), mask);
+            __m256i x = _mm256_xor_si256(_mm256_srli_epi32(r, 1), _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(r, one)));
+            for (int i = 0; i < shifts; i++) {
+                x = _mm256_add_epi32(x, _mm256_and_si256(_mm256_permutevar8x32_epi32(x, shift_index[i]), shift_keep[i]));
+            }
+            x = _mm256_add_epi32(x, carry);
+            carry = _mm256_permutevar8x32_epi32(x, last);
+
+            __m128i packed = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(x, narrow), halves));
+            if (size == 1) {
+                _mm_storel_epi64((__m128i *)((int8_t *)samples + k), packed);
+            } else {
+                _mm_storeu_si128((__m128i *)((int16_t *)samples + k), packed);
+            }
+            bits = _mm256_add_epi32(bits, advance);
+        }
+
+        int32_t carried[8];
+        _mm256_storeu_si256((__m256i *)carried, carry);
+        memcpy(previous, carried, channels * sizeof(int32_t));
+    }
+
+    codec_unpack_residuals(in, width, k, n, size, channels, channel, previous, samples);
+}
+#endif
+
+static codec_unpack_implementation_t codec_supported[2];
+static int codec_supported_count;
+static codec_unpack_function codec_unpack;
+static pthread_once_t codec_once = PTHREAD_ONCE_INIT;
+
+static void codec_init(void) {
+    codec_supported[codec_supported_count++] = (codec_unpack_implementation_t){ "scalar", codec_unpack_scalar };
+#ifdef CODEC_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        codec_supported[codec_supported_count++] = (codec_unpack_implementation_t){ "avx2", codec_unpack_avx2 };
+    }
+#endif
+
+    codec_unpack = codec_supported[codec_supported_count - 1].function;
+}
+
+int codec_unpack_implementations(const codec_unpack_implementation_t **implementations) {
+    pthread_once(&codec_once, codec_init);
+    *implementations = codec_supported;
+    return codec_supported_count;
+}
+
+bool codec_decompress_block(const block_t *input, block_t *output, uint32_t block_size) {
+    int size = sample_size(input->hdr.block_type);
+    uint32_t raw_length = block_get_raw_length(input);
+    uint32_t length = block_get_length(input);
+    if (input->hdr.codec != BLOCK_CODEC_DELTA || !size ||
+        raw_length <= BLOCK_HEADER_LENGTH || raw_length > block_size ||
+        length < BLOCK_HEADER_LENGTH || length > block_size - CODEC_SLACK) {
+        return false;
+    }
+
+    pthread_once(&codec_once, codec_init);
+
+    const uint8_t *in = block_payload(input);
+    int8_t *i8_samples = block_payload(output);
+    int16_t *i16_samples = block_payload(output);
+    size_t packed = length - BLOCK_HEADER_LENGTH;
+    uint32_t count = (raw_length - BLOCK_HEADER_LENGTH) / size;
+    uint32_t channels = channel_count(input);
+    int32_t previous[CODEC_MAX_CHANNELS] = { 0 };
+    uint32_t channel = 0;
+    size_t pos = 0;
+
+    for (uint32_t start = 0; start < count; start += CODEC_FRAME_SAMPLES) {
+        uint32_t n = min(count - start, CODEC_FRAME_SAMPLES);
+        if (pos >= packed) {
+            return false;
+        }
+
+        uint32_t width = in[pos++];
+        size_t frame_bytes = (n * width + 7) / 8;
+        if (width > (uint32_t)size * 8 + 1 || pos + frame_bytes > packed) {
+            return false;
+        }
+
+        void *frame = size == 1 ? (void *)(i8_samples + start) : (void *)(i16_samples + start);
+        codec_unpack(in + pos, width, n, size, channels, &channel, previous, frame);
+        pos += frame_bytes;
+    }
+
+    memcpy(output->hdr_bytes, input->hdr_bytes, BLOCK_HEADER_LENGTH);
+    block_set_length(output, raw_length);
+    output->hdr.codec = BLOCK_CODEC_NONE;
+    block_set_raw_length(output, 0);
+
+    return true;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <eyeq/block.h>
+
+// Compresses the samples of input into output with the given BLOCK_CODEC_x codec, keeping
+// the header. Both blocks are block_size bytes long. Returns false if the block type is not
+// supported by the codec or the block does not get smaller, the block should then be stored
+// as it is.
+bool codec_compress_block(int codec, const block_t *input, block_t *output, uint32_t block_size);
+
+// Restores the original block from a compressed one. Returns false if the compressed data
+// is corrupt.
+bool codec_decompress_block(const block_t *input, block_t *output, uint32_t block_size);
+
+// Unpacks a frame of n residuals of width bits from in, adding each to the previous sample
+// of its channel, into n samples of size bytes. channel is the channel of the first sample
+// and previous the last sample of every channel, both are updated.
+typedef void (*codec_unpack_function)(const uint8_t *in, uint32_t width, uint32_t n, int size, uint32_t channels,
+                                      uint32_t *channel, int32_t *previous, void *samples);
+
+typedef struct {
+    const char *name;
+    codec_unpack_function function;
+} codec_unpack_implementation_t;
+
+// Returns the frame unpackers this CPU supports, slowest first. All of them give the same
+// result, codec_decompress_block uses the last one.
+int codec_unpack_implementations(const codec_unpack_implementation_t **implementations);
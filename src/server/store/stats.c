@@ -0,0 +1,203 @@
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "stats.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define STATS_AVX2
+#endif
+
+// Sums over the samples of a block, turned into block_stats_t by stats_finish
+typedef struct {
+    double sum_i;
+    double sum_q;
+    double sum_power;
+    double peak_power;
+    uint32_t clip_count;
+} stats_sums_t;
+
+static void stats_finish(const stats_sums_t *sums, size_t count, bool complex, double full_scale,
+                         block_stats_t *stats) {
+    size_t samples = complex ? count / 2 : count;
+    if (!samples) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+
+    double power_scale = full_scale * full_scale;
+    stats->mean_power = sums->sum_power / samples / power_scale;
+    stats->peak_magnitude = sqrt(sums->peak_power / power_scale);
+    stats->dc_i = sums->sum_i / samples / full_scale;
+    stats->dc_q = complex ? sums->sum_q / samples / full_scale : 0;
+    stats->clip_count = sums->clip_count;
+}
+
+// Samples at either end of the range of integer types, or at or beyond +-1 for floats, clip
+#define STATS_SCALAR(name, type, clip_low, clip_high)                                      \
+static void name(const type *x, size_t count, bool complex, stats_sums_t *s) {             \
+    size_t step = complex ? 2 : 1;                                                         \
+    count -= count % step;                                                                 \
+    for (size_t n = 0; n < count; n += step) {                                             \
+        double i = x[n];                                                                   \
+        double q = complex ? x[n + 1] : 0;                                                 \
+        double power = i * i + q * q;                                                      \
+        s->sum_i += i;                                                                     \
+        s->sum_q += q;                                                                     \
+        s->sum_power += power;                                                             \
+        s->peak_power = power > s->peak_power ? power : s->peak_power;                     \
+        for (size_t k = n; k < n + step; k++) {                                            \
+            s->clip_count += x[k] <= (clip_low) || x[k] >= (clip_high);                    \
+        }                                                                                  \
+    }                                                                                      \
+}
+
+STATS_SCALAR(stats_scalar_i8, int8_t, INT8_MIN, INT8_MAX)
+STATS_SCALAR(stats_scalar_i16, int16_t, INT16_MIN, INT16_MAX)
+STATS_SCALAR(stats_scalar_i32, int32_t, INT32_MIN, INT32_MAX)
+STATS_SCALAR(stats_scalar_f32, float, -1.0f, 1.0f)
+STATS_SCALAR(stats_scalar_f64, double, -1.0, 1.0)
+
+static void stats_i16_scalar(const int16_t *samples, size_t count, bool complex, block_stats_t *stats) {
+    stats_sums_t sums = { 0 };
+    stats_scalar_i16(samples, count, complex, &sums);
+    stats_finish(&sums, count, complex, 32768.0, stats);
+}
+
+#ifdef STATS_AVX2
+__attribute__((target("avx2")))
+static inline __m256i stats_add_u32_to_u64(__m256i sum, __m256i values) {
+    sum = _mm256_add_epi64(sum, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(values)));
+    return _mm256_add_epi64(sum, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values, 1)));
+}
+
+__attribute__((target("avx2")))
+static inline uint64_t stats_sum_u64(__m256i v) {
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+/*
+ * 16 samples at a time. I*I + Q*Q of a complex sample is one multiply-add of the pair,
+ * which can reach 2^31 and is treated as unsigned. Real samples take their peak from the
+ * absolute values instead. I and Q sums come from multiply-adds with 1/0 and 0/1 masks.
+ */
+__attribute__((target("avx2")))
+static void stats_i16_avx2(const int16_t *samples, size_t count, bool complex, block_stats_t *stats) {
+    const __m256i i_mask = complex ? _mm256_set1_epi32(0x00000001) : _mm256_set1_epi16(1);
+    const __m256i q_mask = _mm256_set1_epi32(0x00010000);
+    const __m256i high = _mm256_set1_epi16(INT16_MAX);
+    const __m256i low = _mm256_set1_epi16(INT16_MIN);
+
+    __m256i sum_i = _mm256_setzero_si256();
+    __m256i sum_q = _mm256_setzero_si256();
+    __m256i sum_power = _mm256_setzero_si256();
+    __m256i peak = _mm256_setzero_si256();
+    uint32_t clips = 0;
+
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(samples + n));
+        __m256i power = _mm256_madd_epi16(x, x);
+
+        sum_power = stats_add_u32_to_u64(sum_power, power);
+        sum_i = _mm256_add_epi64(sum_i, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(_mm256_madd_epi16(x, i_mask))));
+        sum_i = _mm256_add_epi64(sum_i, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(_mm256_madd_epi16(x, i_mask), 1)));
+        if (complex) {
+            __m256i q = _mm256_madd_epi16(x, q_mask);
+            sum_q = _mm256_add_epi64(sum_q, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(q)));
+            sum_q = _mm256_add_epi64(sum_q, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(q, 1)));
+            peak = _mm256_max_epu32(peak, power);
+        } else {
+            peak = _mm256_max_epu16(peak, _mm256_abs_epi16(x));
+        }
+
+        __m256i clipped = _mm256_or_si256(_mm256_cmpeq_epi16(x, high), _mm256_cmpeq_epi16(x, low));
+        clips += __builtin_popcount(_mm256_movemask_epi8(clipped)) / 2;
+    }
+
+    uint32_t lanes[8];
+    double peak_power = 0;
+    if (complex) {
+        _mm256_storeu_si256((__m256i *)lanes, peak);
+        for (int k = 0; k < 8; k++) {
+            peak_power = lanes[k] > peak_power ? lanes[k] : peak_power;
+        }
+    } else {
+        uint16_t magnitudes[16];
+        _mm256_storeu_si256((__m256i *)magnitudes, peak);
+        for (int k = 0; k < 16; k++) {
+            double power = (double)magnitudes[k] * magnitudes[k];
+            peak_power = power > peak_power ? power : peak_power;
+        }
+    }
+
+    stats_sums_t sums = {
+        .sum_i = (double)(int64_t)stats_sum_u64(sum_i),
+        .sum_q = (double)(int64_t)stats_sum_u64(sum_q),
+        .sum_power = (double)stats_sum_u64(sum_power),
+        .peak_power = peak_power,
+        .clip_count = clips,
+    };
+    stats_scalar_i16(samples + n, count - n, complex, &sums);
+    stats_finish(&sums, count, complex, 32768.0, stats);
+}
+#endif
+
+static stats_implementation_t stats_supported[2];
+static int stats_supported_count;
+static stats_i16_function stats_i16_best = stats_i16_scalar;
+static pthread_once_t stats_once = PTHREAD_ONCE_INIT;
+
+static void stats_init(void) {
+    stats_supported[stats_supported_count++] = (stats_implementation_t){ "scalar", stats_i16_scalar };
+#ifdef STATS_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        stats_supported[stats_supported_count++] = (stats_implementation_t){ "avx2", stats_i16_avx2 };
+    }
+#endif
+
+    stats_i16_best = stats_supported[stats_supported_count - 1].function;
+}
+
+int stats_implementations(const stats_implementation_t **implementations) {
+    pthread_once(&stats_once, stats_init);
+    *implementations = stats_supported;
+    return stats_supported_count;
+}
+
+void block_compute_stats(const block_t *block, block_stats_t *stats) {
+    uint32_t length = block_get_length(block);
+    size_t bytes = length > BLOCK_HEADER_LENGTH ? length - BLOCK_HEADER_LENGTH : 0;
+    bool complex = block->hdr.sample_block_header.num_channels == 2;
+    const void *payload = block_payload(block);
+    stats_sums_t sums = { 0 };
+
+    switch (block->hdr.block_type) {
+    case BLOCK_TYPE_I16_SAMPLES:
+        pthread_once(&stats_once, stats_init);
+        stats_i16_best(payload, bytes / sizeof(int16_t), complex, stats);
+        return;
+    case BLOCK_TYPE_I8_SAMPLES:
+        stats_scalar_i8(payload, bytes, complex, &sums);
+        stats_finish(&sums, bytes, complex, 128.0, stats);
+        return;
+    case BLOCK_TYPE_I32_SAMPLES:
+        stats_scalar_i32(payload, bytes / sizeof(int32_t), complex, &sums);
+        stats_finish(&sums, bytes / sizeof(int32_t), complex, 2147483648.0, stats);
+        return;
+    case BLOCK_TYPE_F32_SAMPLES:
+        stats_scalar_f32(payload, bytes / sizeof(float), complex, &sums);
+        stats_finish(&sums, bytes / sizeof(float), complex, 1.0, stats);
+        return;
+    case BLOCK_TYPE_F64_SAMPLES:
+        stats_scalar_f64(payload, bytes / sizeof(double), complex, &sums);
+        stats_finish(&sums, bytes / sizeof(double), complex, 1.0, stats);
+        return;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+#include <eyeq/block.h>
+#include <eyeq/server/store.h>
+
+// Summarizes the samples of a block. Blocks with two channels are taken as interleaved I/Q,
+// others as real samples. Byte blocks and blocks without samples give all zeros.
+void block_compute_stats(const block_t *block, block_stats_t *stats);
+
+typedef void (*stats_i16_function)(const int16_t *samples, size_t count, bool complex, block_stats_t *stats);
+
+typedef struct {
+    const char *name;
+    stats_i16_function function;
+} stats_implementation_t;
+
+// Returns the kernels for 16 bit samples this CPU supports, slowest first. All of them give
+// the same result, block_compute_stats uses the last one.
+int stats_implementations(const stats_implementation_t **implementations);
@@ -1,156 +1,2705 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>
 
 #include <eyeq/shared.h>
 #include <eyeq/server/store.h>
 
+#include "../util.h"
+#include "uring.h"
+#include "time_index.h"
+#include "codec.h"
+#include "../directory.h"
+
 typedef struct {
-    FILE *file;
+    int fd;
     char filepath[STORE_MAX_PATH];
+
+    // Runs of blocks go through io_uring when set, otherwise pread/pwrite
+    uring_t *ring;
+
+    // Blocks start after the superblock, or at 0 in files from before superblocks
+    off_t data_offset;
+    uint64_t generation;
+    uint32_t superblock_interval;
 } file_store_t;
 
-store_t* new_memory_store(uint32_t number_of_blocks) {
-    store_t *store = calloc(1, sizeof(store_t));
-    if (store == NULL) {
-        return NULL;
+/*
+ * The first block of a file store holds the superblock. It is rewritten every
+ * superblock_interval appended blocks and when the store is closed, so the write offset
+ * it holds is at most one interval behind. The true head is found by store_find_head.
+ */
+#define STORE_SUPERBLOCK_MAGIC 0x53514559 // "EYQS"
+#define STORE_SUPERBLOCK_VERSION 1
+#define STORE_SUPERBLOCK_INTERVAL 1024
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint32_t block_count;
+    uint32_t write_offset;
+    uint32_t reserved;
+    uint64_t generation;
+    uint32_t crc32;
+} store_superblock_t;
+
+/*
+ * Memory stores live in an anonymous mapping, so pages are only committed when blocks are
+ * written. The mapping can be backed by huge pages and bound to a NUMA node.
+ *
+ * A memory store with a snapshot file is written to it on store_sync, and mapped back
+ * privately from it when it is loaded again, so blocks are read from the file on first use
+ * instead of all at startup. The snapshot file holds a superblock, the mapping and the
+ * time index.
+ *
+ * A copy-on-write snapshot of a memory store is a memory store of its own that starts out
+ * empty. The source copies a block into it just before overwriting it, with the source
+ * write lock held, and the snapshot reads the blocks it has not got yet from the source.
+ */
+typedef struct {
+    block_t *blocks;
+    size_t length;
+    bool hugepages;
+    int numa_node;
+    char snapshot_path[STORE_MAX_PATH];
+
+    // Copy-on-write snapshots of this store, linked through next_snapshot
+    store_t *snapshots;
+
+    // In a snapshot: the store it came from, the id of its first block and a bitmap of the
+    // blocks copied into it so far. source is NULL once all blocks have been copied.
+    store_t *source;
+    store_t *next_snapshot;
+    uint32_t first_block;
+    uint64_t *copied;
+} memory_store_t;
+
+#define STORE_SNAPSHOT_MAGIC 0x53534559 // "EYSS"
+
+// Memory stores are rounded up to whole huge pages
+#define MEMORY_STORE_HUGEPAGE_SIZE (2 * 1024 * 1024)
+
+// From linux/mempolicy.h, which is not available everywhere
+#define MEMORY_STORE_MPOL_BIND 2
+#define MEMORY_STORE_MAX_NUMA_NODES 1024
+
+typedef struct {
+    int fd;
+    block_t *blocks;
+    size_t length;
+    char filepath[STORE_MAX_PATH];
+} mmap_store_t;
+
+/*
+ * A tiered store keeps the newest hot_count blocks in memory and writes them behind to a
+ * file store of block_count blocks from a flusher thread. Blocks still in memory are read
+ * from there, older blocks from the file.
+ *
+ * Blocks [flushed, written) are only in memory, ingest waits for the flusher when that
+ * would be more than hot_count blocks. The hot ring holds blocks [hot_start, written),
+ * at most the last hot_count of them.
+ */
+typedef struct {
+    store_t *cold;
+    block_t *hot;
+    uint32_t hot_count;
+
+    uint32_t hot_start;
+    uint32_t written;
+    uint32_t flushed;
+    bool stop;
+
+    block_t *batch;
+    pthread_t flusher;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+} tiered_store_t;
+
+#define TIERED_FLUSH_BATCH 64
+
+/*
+ * A striped store spreads consecutive blocks round-robin over stripe_count file stores,
+ * block n goes to block n / stripe_count of file n % stripe_count. Runs of blocks are
+ * read and written through one io_uring, so every file has I/Os in flight at once. The
+ * write offset is kept in the superblock of the first file.
+ */
+typedef struct {
+    uint32_t stripe_count;
+    store_t *stripes[STORE_MAX_STRIPES];
+    uring_t *ring;
+    char filepaths[STORE_MAX_PATH];
+} striped_store_t;
+
+// I/Os kept in flight per file by striped stores
+#define STRIPED_QUEUE_DEPTH 8
+
+/*
+ * The scrubber reads the store in batches of SCRUB_BATCH blocks and checks their CRCs,
+ * pacing itself to rate blocks per second. It runs at the lowest CPU priority and in the
+ * idle I/O class, and only holds the store's read lock for one batch at a time, so ingest
+ * goes first.
+ */
+typedef struct store_scrubber_s {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t rate;
+    bool stop;
+} store_scrubber_t;
+
+#define SCRUB_BATCH 16
+
+/*
+ * The committer of a store writes out its ingest queue and, with periodic durability,
+ * syncs the store files every sync_interval_ms, or earlier once sync_blocks blocks were
+ * written since the last sync (group commit).
+ *
+ * The ingest queue holds appended blocks [queue_start, queue_start + queue_count) that are
+ * not written yet, so consecutive appends go to disk as one large write. It is protected
+ * by the store lock, reads of queued blocks are served from it.
+ */
+typedef struct store_committer_s {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool stop;
+    bool kick;
+
+    block_t *queue;
+    uint32_t queue_capacity;
+    uint32_t queue_start;
+    uint32_t queue_count;
+
+    // Blocks written since the last sync
+    uint32_t unsynced;
+} store_committer_t;
+
+// Commit interval of stores that only have an ingest queue
+#define STORE_DEFAULT_COMMIT_INTERVAL_MS 100
+
+static void store_stop_committer(store_t *store);
+
+// From linux/ioprio.h, which is not available everywhere
+#define SCRUB_IOPRIO_WHO_PROCESS 1
+#define SCRUB_IOPRIO_CLASS_IDLE 3
+#define SCRUB_IOPRIO_CLASS_SHIFT 13
+
+bool store_valid_block_size(uint32_t block_size) {
+    return block_size >= BLOCK_LENGTH && block_size <= BLOCK_MAX_LENGTH && !(block_size & (block_size - 1));
+}
+
+// A block size of 0 picks the default BLOCK_LENGTH
+static store_t* alloc_store(int store_type, uint32_t number_of_blocks, uint32_t block_size) {
+    if (!block_size) {
+        block_size = BLOCK_LENGTH;
+    }
+    if (!store_valid_block_size(block_size)) {
+        fprintf(stderr, "Unsupported block size %"PRIu32"\n", block_size);
+        return NULL;
+    }
+
+    store_t *store = calloc(1, sizeof(store_t));
+    if (store == NULL) {
+        return NULL;
+    }
+
+    if (pthread_rwlock_init(&store->lock, NULL)) {
+        free(store);
+        return NULL;
+    }
+
+    store->block_count = number_of_blocks;
+    store->block_size = block_size;
+    store->store_type = store_type;
+
+    return store;
+}
+
+static void release_store(store_t *store) {
+    free_time_index(store->time_index);
+    free(store->bad_blocks);
+    pthread_rwlock_destroy(&store->lock);
+    free(store);
+}
+
+// The time index of file backed stores is kept next to the store file, memory stores
+// only keep it in memory.
+static bool store_open_time_index(store_t *store, const char *filepath, bool initialize) {
+    store->time_index = new_time_index(filepath, store->block_count, initialize);
+    if (!store->time_index) {
+        fprintf(stderr, "Error while allocating memory for time index.\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Maps length bytes of zeroed memory. Explicit huge pages are only there if the system
+// reserved them, otherwise transparent huge pages are asked for.
+static void* memory_store_map(size_t length, bool hugepages) {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    void *ptr = MAP_FAILED;
+
+    // Huge pages are reserved up front, so a short pool fails here and not on first write
+    if (hugepages) {
+        ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+    }
+    if (ptr == MAP_FAILED) {
+        ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, flags | MAP_NORESERVE, -1, 0);
+        if (ptr == MAP_FAILED) {
+            return NULL;
+        }
+        if (hugepages && madvise(ptr, length, MADV_HUGEPAGE)) {
+            perror("Error enabling transparent huge pages");
+        }
+    }
+
+    return ptr;
+}
+
+static bool memory_store_bind(void *ptr, size_t length, int numa_node) {
+    unsigned long nodemask[MEMORY_STORE_MAX_NUMA_NODES / (8 * sizeof(unsigned long))] = { 0 };
+    if (numa_node >= MEMORY_STORE_MAX_NUMA_NODES) {
+        fprintf(stderr, "NUMA node %d out of range\n", numa_node);
+        return false;
+    }
+    nodemask[numa_node / (8 * sizeof(unsigned long))] = 1UL << (numa_node % (8 * sizeof(unsigned long)));
+
+    // Nothing is committed yet, so all pages are allocated on the node
+    if (syscall(SYS_mbind, ptr, length, MEMORY_STORE_MPOL_BIND, nodemask, MEMORY_STORE_MAX_NUMA_NODES + 1, 0)) {
+        perror("Error binding memory store to NUMA node");
+        return false;
+    }
+
+    return true;
+}
+
+static bool pwrite_full(int fd, const void *data, size_t length, off_t position) {
+    const uint8_t *ptr = (const uint8_t *)data;
+    while (length > 0) {
+        ssize_t ret = pwrite(fd, ptr, length, position);
+        if (ret <= 0) {
+            return false;
+        }
+        ptr += ret;
+        position += ret;
+        length -= ret;
+    }
+    return true;
+}
+
+// Maps the blocks of a valid snapshot copy-on-write, and reads back its time index.
+// Snapshots with an older, smaller index only have usable times, the rest is rebuilt then.
+static bool memory_store_load_snapshot(store_t *store) {
+    memory_store_t *ms = (memory_store_t *)store->internal;
+    size_t times_length = time_index_data_length(store->block_count);
+    size_t legacy_length = (size_t)store->block_count * sizeof(uint64_t);
+
+    int fd = open(ms->snapshot_path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    store_superblock_t sb;
+    struct stat st = { 0 };
+    bool valid = pread(fd, &sb, sizeof(sb), 0) == sizeof(sb) && !fstat(fd, &st) &&
+                 sb.magic == STORE_SNAPSHOT_MAGIC && sb.version == STORE_SUPERBLOCK_VERSION &&
+                 sb.crc32 == (eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)&sb, offsetof(store_superblock_t, crc32)) ^ EYEQ_CRC_INITIAL) &&
+                 sb.block_size == store->block_size && sb.block_count == store->block_count;
+    size_t index_length = (size_t)st.st_size - min((size_t)st.st_size, store->block_size + ms->length);
+    if (valid && index_length >= legacy_length && index_length < times_length) {
+        store->time_index->rebuild = true;
+        times_length = index_length = legacy_length;
+    }
+    valid = valid && index_length == times_length;
+    if (!valid) {
+        fprintf(stderr, "Ignoring snapshot %s, it does not match the store\n", ms->snapshot_path);
+        close(fd);
+        return false;
+    }
+
+    void *ptr = mmap(NULL, ms->length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, store->block_size);
+    if (ptr == MAP_FAILED) {
+        perror("Error mapping snapshot");
+        close(fd);
+        return false;
+    }
+
+    if (pread(fd, store->time_index->times, times_length, store->block_size + ms->length) != (ssize_t)times_length) {
+        fprintf(stderr, "Error reading time index of snapshot %s\n", ms->snapshot_path);
+        memset(store->time_index->times, 0, times_length);
+        munmap(ptr, ms->length);
+        close(fd);
+        return false;
+    }
+
+    // The mapping keeps the file, also after a newer snapshot replaced it
+    close(fd);
+    ms->blocks = ptr;
+    store->write_offset = sb.write_offset;
+
+    return true;
+}
+
+static int memory_store_cow_snapshot(store_t *source, uint32_t start_block, uint32_t block_count, store_t **output);
+static void memory_snapshot_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count);
+
+// Blocks written to a snapshot file at a time
+#define MEMORY_SNAPSHOT_CHUNK_LENGTH (4 << 20)
+
+/*
+ * Writes the store to a new snapshot file that then replaces the old one. The blocks are
+ * frozen with a copy-on-write snapshot first, and then written out a chunk at a time, each
+ * under the read lock, so writes only ever wait for the copy of one chunk.
+ */
+static int memory_store_snapshot(store_t *store) {
+    memory_store_t *ms = (memory_store_t *)store->internal;
+    size_t times_length = time_index_data_length(store->block_count);
+
+    // The blocks the store holds. A write between reading the write offset and freezing
+    // them moves them on, then try again.
+    store_t *frozen = NULL;
+    uint32_t write_offset, count;
+    int res;
+    do {
+        pthread_rwlock_rdlock(&store->lock);
+        write_offset = store->write_offset;
+        pthread_rwlock_unlock(&store->lock);
+        count = min(write_offset, store->block_count);
+        res = count ? memory_store_cow_snapshot(store, write_offset - count, count, &frozen) : STORE_OK;
+    } while (res == STORE_NOT_FOUND);
+    if (res != STORE_OK) {
+        return res;
+    }
+
+    char path[STORE_MAX_PATH + 8];
+    snprintf(path, sizeof(path), "%s.tmp", ms->snapshot_path);
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        perror("Error creating snapshot");
+        free_store(frozen);
+        return STORE_WRITE_ERROR;
+    }
+
+    // Until the store wraps around the frozen blocks are at the same positions as in the
+    // store, and after that the frozen store is as long as the store.
+    uint32_t chunk_blocks = max(MEMORY_SNAPSHOT_CHUNK_LENGTH / store->block_size, 1u);
+    block_t *header = store_alloc_blocks(store, 1);
+    block_t *chunk = store_alloc_blocks(store, chunk_blocks);
+    time_index_t *times = new_time_index(NULL, store->block_count, true);
+    if (!header || !chunk || !times) {
+        free(header);
+        free(chunk);
+        free_time_index(times);
+        free_store(frozen);
+        close(fd);
+        unlink(path);
+        return STORE_OUT_OF_MEMORY;
+    }
+    memset(header, 0, store->block_size);
+
+    store_superblock_t *sb = (store_superblock_t *)header;
+    sb->magic = STORE_SNAPSHOT_MAGIC;
+    sb->version = STORE_SUPERBLOCK_VERSION;
+    sb->block_size = store->block_size;
+    sb->block_count = store->block_count;
+    sb->write_offset = write_offset;
+    sb->crc32 = eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)sb, offsetof(store_superblock_t, crc32)) ^ EYEQ_CRC_INITIAL;
+
+    // Blocks that were never written stay holes in the file
+    bool ok = !ftruncate(fd, store->block_size + ms->length + times_length) &&
+              pwrite_full(fd, header, store->block_size, 0);
+    for (uint32_t position = 0; ok && position < count; position += chunk_blocks) {
+        uint32_t blocks = min(count - position, chunk_blocks);
+        memory_snapshot_read_run(frozen, chunk, position, blocks);
+        ok = pwrite_full(fd, chunk, (size_t)blocks * store->block_size, (off_t)(position + 1) * store->block_size);
+    }
+    for (uint32_t position = 0; position < count; position++) {
+        time_index_copy(times, position, frozen->time_index, position);
+    }
+    ok = ok && pwrite_full(fd, times->times, times_length, store->block_size + ms->length);
+
+    free(header);
+    free(chunk);
+    free_time_index(times);
+    free_store(frozen);
+
+    ok = ok && !fdatasync(fd);
+    close(fd);
+    if (!ok || rename(path, ms->snapshot_path)) {
+        perror("Error writing snapshot");
+        unlink(path);
+        return STORE_WRITE_ERROR;
+    }
+
+    return STORE_OK;
+}
+
+store_t* new_snapshot_memory_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size,
+                                   int numa_node, bool hugepages, bool initialize) {
+    store_t *store = alloc_store(MEMORY_STORE, number_of_blocks, block_size);
+    if (store == NULL) {
+        return NULL;
+    }
+
+    memory_store_t *ms = calloc(1, sizeof(memory_store_t));
+    if (!ms) {
+        release_store(store);
+        return NULL;
+    }
+    store->internal = ms;
+    ms->hugepages = hugepages;
+    ms->numa_node = numa_node;
+    ms->length = ((size_t)number_of_blocks * store->block_size + MEMORY_STORE_HUGEPAGE_SIZE - 1) &
+                 ~((size_t)MEMORY_STORE_HUGEPAGE_SIZE - 1);
+    if (filepath) {
+        strncpy(ms->snapshot_path, filepath, STORE_MAX_PATH - 1);
+    }
+
+    if (!store_open_time_index(store, NULL, true)) {
+        free(ms);
+        release_store(store);
+        return NULL;
+    }
+
+    if (initialize || !ms->snapshot_path[0] || !memory_store_load_snapshot(store)) {
+        ms->blocks = memory_store_map(ms->length, hugepages);
+    }
+
+    if (!ms->blocks || (numa_node >= 0 && !memory_store_bind(ms->blocks, ms->length, numa_node))) {
+        if (ms->blocks) {
+            munmap(ms->blocks, ms->length);
+        }
+        free(ms);
+        release_store(store);
+        return NULL;
+    }
+
+    return store;
+}
+
+store_t* new_memory_store_on_node(uint32_t number_of_blocks, int numa_node, bool hugepages) {
+    return new_snapshot_memory_store(NULL, number_of_blocks, 0, numa_node, hugepages, true);
+}
+
+store_t* new_memory_store(uint32_t number_of_blocks) {
+    return new_memory_store_on_node(number_of_blocks, -1, false);
+}
+
+static int file_store_write_superblock(store_t *store) {
+    file_store_t *fs = (file_store_t *)store->internal;
+
+    // A whole block, so the write stays aligned for O_DIRECT
+    block_t *buffer = store_alloc_blocks(store, 1);
+    if (!buffer) {
+        return STORE_OUT_OF_MEMORY;
+    }
+    memset(buffer, 0, store->block_size);
+
+    store_superblock_t *sb = (store_superblock_t *)buffer;
+    sb->magic = STORE_SUPERBLOCK_MAGIC;
+    sb->version = STORE_SUPERBLOCK_VERSION;
+    sb->block_size = store->block_size;
+    sb->block_count = store->block_count;
+    sb->write_offset = store->write_offset;
+    sb->generation = ++fs->generation;
+    sb->crc32 = eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)sb, offsetof(store_superblock_t, crc32)) ^ EYEQ_CRC_INITIAL;
+
+    ssize_t ret = pwrite(fs->fd, buffer, store->block_size, 0);
+    free(buffer);
+
+    return ret == (ssize_t)store->block_size ? STORE_OK : STORE_WRITE_ERROR;
+}
+
+// Rewrites the superblock if the write offset crossed a multiple of superblock_interval
+// since previous_offset.
+static void file_store_update_superblock(store_t *store, uint32_t previous_offset) {
+    file_store_t *fs = (file_store_t *)store->internal;
+
+    if (fs->data_offset && previous_offset / fs->superblock_interval != store->write_offset / fs->superblock_interval &&
+        file_store_write_superblock(store) != STORE_OK) {
+        fprintf(stderr, "Error updating superblock of %s\n", fs->filepath);
+    }
+}
+
+// Moves the write offset forward, and rewrites the superblock every superblock_interval blocks.
+static void file_store_advance(store_t *store, uint32_t count) {
+    uint32_t previous_offset = store->write_offset;
+    store->write_offset += count;
+    file_store_update_superblock(store, previous_offset);
+}
+
+// Reads the superblock before the block size of the store is known. It is at the start of
+// the first block, which is at least BLOCK_LENGTH bytes long.
+static bool file_store_read_superblock(file_store_t *fs, store_superblock_t *output) {
+    void *buffer;
+    if (posix_memalign(&buffer, STORE_BLOCK_ALIGNMENT, BLOCK_LENGTH)) {
+        return false;
+    }
+
+    ssize_t ret = pread(fs->fd, buffer, BLOCK_LENGTH, 0);
+    memcpy(output, buffer, sizeof(store_superblock_t));
+    free(buffer);
+
+    return ret == BLOCK_LENGTH &&
+        output->magic == STORE_SUPERBLOCK_MAGIC &&
+        output->crc32 == (eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)output, offsetof(store_superblock_t, crc32)) ^ EYEQ_CRC_INITIAL);
+}
+
+// Writes a fresh superblock when initializing, otherwise picks up the geometry and write
+// offset from the existing one.
+static int file_store_open(store_t *store, bool initialize) {
+    file_store_t *fs = (file_store_t *)store->internal;
+
+    // Keep the superblock well within one lap of the ring, so store_find_head can find the head
+    fs->superblock_interval = max(1, min(STORE_SUPERBLOCK_INTERVAL, store->block_count / 4));
+    fs->data_offset = store->block_size;
+
+    if (initialize) {
+        return file_store_write_superblock(store);
+    }
+
+    store_superblock_t sb;
+    if (!file_store_read_superblock(fs, &sb)) {
+        // Store file from before superblocks, blocks start at the beginning of the file
+        fs->data_offset = 0;
+        return STORE_OK;
+    }
+
+    if (sb.version != STORE_SUPERBLOCK_VERSION || !store_valid_block_size(sb.block_size)) {
+        fprintf(stderr, "Store %s has an unsupported layout (version %"PRIu32", block size %"PRIu32")\n",
+                fs->filepath, sb.version, sb.block_size);
+        return STORE_READ_ERROR;
+    }
+
+    if (sb.block_size != store->block_size) {
+        fprintf(stderr, "Store %s has blocks of %"PRIu32" bytes, not %"PRIu32"\n", fs->filepath, sb.block_size, store->block_size);
+    }
+    store->block_size = sb.block_size;
+    fs->data_offset = sb.block_size;
+
+    if (store->block_count && sb.block_count != store->block_count) {
+        fprintf(stderr, "Store %s has %"PRIu32" blocks, not %"PRIu32"\n", fs->filepath, sb.block_count, store->block_count);
+    }
+    store->block_count = sb.block_count;
+    store->write_offset = sb.write_offset;
+    fs->generation = sb.generation;
+    fs->superblock_interval = max(1, min(STORE_SUPERBLOCK_INTERVAL, store->block_count / 4));
+
+    return STORE_OK;
+}
+
+// File stores that are part of a striped store share the time index of the striped store
+static store_t* create_file_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize,
+                                  bool time_index) {
+    // If initializing, create or truncate the file, otherwise it has to exist already.
+    int fd = open(filepath, O_RDWR | (initialize ? O_CREAT | O_TRUNC : 0), 0644);
+    if (fd < 0) {
+        perror("Error opening store output file");
+        return NULL;
+    }
+
+    store_t *store = alloc_store(FILE_STORE, number_of_blocks, block_size);
+    if (store == NULL) {
+        fprintf(stderr, "Error while allocating memory for store.\n");
+        close(fd);
+        return NULL;
+    }
+
+    file_store_t *fs = calloc(1, sizeof(file_store_t));
+    if (!fs) {
+        fprintf(stderr, "Error while allocating memory for file_store.\n");
+        close(fd);
+        release_store(store);
+        return NULL;
+    }
+
+    fs->fd = fd;
+    strncpy(fs->filepath, filepath, STORE_MAX_PATH - 1);
+    store->internal = fs;
+
+    if (file_store_open(store, initialize) != STORE_OK || (time_index && !store_open_time_index(store, filepath, initialize))) {
+        fprintf(stderr, "Error opening file store %s\n", filepath);
+        close(fd);
+        free(fs);
+        release_store(store);
+        return NULL;
+    }
+
+    return store;
+}
+
+store_t* new_file_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize) {
+    return create_file_store(filepath, number_of_blocks, block_size, initialize, true);
+}
+
+// Maps the whole store file into memory. Blocks are read and written in place and the
+// kernel page cache takes care of caching and writeback.
+store_t* new_mmap_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize) {
+    block_size = block_size ? block_size : BLOCK_LENGTH;
+    if (!store_valid_block_size(block_size)) {
+        fprintf(stderr, "Unsupported block size %"PRIu32"\n", block_size);
+        return NULL;
+    }
+
+    int fd = open(filepath, O_RDWR | O_CREAT | (initialize ? O_TRUNC : 0), 0644);
+    if (fd < 0) {
+        perror("Error opening store output file");
+        return NULL;
+    }
+
+    size_t length = (size_t)number_of_blocks * block_size;
+
+    // Grow the file to fit all blocks; blocks that were never written read back as zeros.
+    struct stat sb;
+    if (fstat(fd, &sb) || ((size_t)sb.st_size < length && ftruncate(fd, length))) {
+        perror("Error resizing store output file");
+        close(fd);
+        return NULL;
+    }
+
+    block_t *blocks = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (blocks == MAP_FAILED) {
+        perror("Error mapping store output file");
+        close(fd);
+        return NULL;
+    }
+
+    store_t *store = alloc_store(MMAP_STORE, number_of_blocks, block_size);
+    mmap_store_t *ms = calloc(1, sizeof(mmap_store_t));
+    if (!store || !ms) {
+        fprintf(stderr, "Error while allocating memory for mmap_store.\n");
+        munmap(blocks, length);
+        close(fd);
+        if (store) {
+            release_store(store);
+        }
+        free(ms);
+        return NULL;
+    }
+
+    ms->fd = fd;
+    ms->blocks = blocks;
+    ms->length = length;
+    strncpy(ms->filepath, filepath, STORE_MAX_PATH - 1);
+    store->internal = ms;
+
+    if (!store_open_time_index(store, filepath, initialize)) {
+        free_store(store);
+        return NULL;
+    }
+
+    return store;
+}
+
+// Opens a raw block device or a preallocated file with O_DIRECT, so reads and writes
+// bypass the page cache. Block buffers passed to it should come from store_alloc_blocks,
+// unaligned buffers are bounced through an aligned copy. If number_of_blocks is 0, the
+// whole device is used.
+store_t* new_direct_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, bool initialize) {
+    block_size = block_size ? block_size : BLOCK_LENGTH;
+    if (!store_valid_block_size(block_size)) {
+        fprintf(stderr, "Unsupported block size %"PRIu32"\n", block_size);
+        return NULL;
+    }
+
+    struct stat sb;
+    int ret = stat(filepath, &sb);
+    bool file_exists = !ret;
+    bool block_device = file_exists && (sb.st_mode & S_IFMT) == S_IFBLK;
+    if (file_exists && !block_device && (sb.st_mode & S_IFMT) != S_IFREG) {
+        fprintf(stderr, "Store output %s is neither a regular file or a block device.\n", filepath);
+        return NULL;
+    }
+
+    int flags = O_RDWR | O_DIRECT;
+    if (initialize && !block_device) {
+        flags |= O_CREAT | O_TRUNC;
+    }
+
+    int fd = open(filepath, flags, 0644);
+    if (fd < 0) {
+        perror("Error opening store output file");
+        return NULL;
+    }
+
+    // Size of the device, or of the existing file
+    uint64_t size = 0;
+    if (block_device) {
+        ret = ioctl(fd, BLKGETSIZE64, &size);
+    } else {
+        ret = fstat(fd, &sb);
+        size = sb.st_size;
+    }
+    if (ret) {
+        perror("Error getting store output size");
+        close(fd);
+        return NULL;
+    }
+
+    // The first block holds the superblock
+    uint64_t device_blocks = size / block_size;
+    device_blocks = device_blocks ? device_blocks - 1 : 0;
+    if (number_of_blocks == 0) {
+        number_of_blocks = min(device_blocks, UINT32_MAX);
+    }
+
+    if (!block_device && device_blocks < number_of_blocks) {
+        // Allocate the whole file up front, so ingest never waits for block allocation.
+        ret = posix_fallocate(fd, 0, ((off_t)number_of_blocks + 1) * block_size);
+        if (ret) {
+            fprintf(stderr, "Error allocating store output file: %s\n", strerror(ret));
+            close(fd);
+            return NULL;
+        }
+    } else if (device_blocks < number_of_blocks || number_of_blocks == 0) {
+        fprintf(stderr, "Store output %s only has room for %"PRIu64" blocks.\n", filepath, device_blocks);
+        close(fd);
+        return NULL;
+    }
+
+    store_t *store = alloc_store(DIRECT_STORE, number_of_blocks, block_size);
+    file_store_t *fs = calloc(1, sizeof(file_store_t));
+    if (!store || !fs) {
+        fprintf(stderr, "Error while allocating memory for direct_store.\n");
+        close(fd);
+        if (store) {
+            release_store(store);
+        }
+        free(fs);
+        return NULL;
+    }
+
+    fs->fd = fd;
+    strncpy(fs->filepath, filepath, STORE_MAX_PATH - 1);
+    store->internal = fs;
+
+    if (file_store_open(store, initialize) != STORE_OK || !store_open_time_index(store, filepath, initialize)) {
+        fprintf(stderr, "Error opening direct store %s\n", filepath);
+        close(fd);
+        free(fs);
+        release_store(store);
+        return NULL;
+    }
+
+    return store;
+}
+
+// filepaths is a comma separated list of the files (or block devices) to stripe over
+store_t* new_striped_store(const char *filepaths, uint32_t number_of_blocks, uint32_t block_size, bool initialize) {
+    char paths[STORE_MAX_PATH];
+    strncpy(paths, filepaths, STORE_MAX_PATH - 1);
+    paths[STORE_MAX_PATH - 1] = '\0';
+
+    char *files[STORE_MAX_STRIPES];
+    uint32_t stripe_count = 0;
+    char *saveptr;
+    for (char *path = strtok_r(paths, ",", &saveptr); path; path = strtok_r(NULL, ",", &saveptr)) {
+        if (stripe_count == STORE_MAX_STRIPES) {
+            fprintf(stderr, "Striped store can use at most %d files.\n", STORE_MAX_STRIPES);
+            return NULL;
+        }
+        files[stripe_count++] = path;
+    }
+
+    if (!stripe_count || !number_of_blocks) {
+        fprintf(stderr, "Striped store needs files and a block count.\n");
+        return NULL;
+    }
+
+    store_t *store = alloc_store(STRIPED_STORE, number_of_blocks, block_size);
+    striped_store_t *ss = calloc(1, sizeof(striped_store_t));
+    if (!store || !ss) {
+        fprintf(stderr, "Error while allocating memory for striped_store.\n");
+        if (store) {
+            release_store(store);
+        }
+        free(ss);
+        return NULL;
+    }
+
+    ss->stripe_count = stripe_count;
+    strncpy(ss->filepaths, filepaths, STORE_MAX_PATH - 1);
+    store->internal = ss;
+
+    uint32_t stripe_blocks = (number_of_blocks + stripe_count - 1) / stripe_count;
+    for (uint32_t i = 0; i < stripe_count; i++) {
+        ss->stripes[i] = create_file_store(files[i], stripe_blocks, store->block_size, initialize, false);
+        if (!ss->stripes[i] || ss->stripes[i]->block_size != ss->stripes[0]->block_size) {
+            free_store(store);
+            return NULL;
+        }
+    }
+    store->write_offset = ss->stripes[0]->write_offset;
+    store->block_size = ss->stripes[0]->block_size;
+
+    if (!store_open_time_index(store, files[0], initialize)) {
+        free_store(store);
+        return NULL;
+    }
+
+    // Without io_uring the files are accessed one block at a time
+    ss->ring = new_uring(STRIPED_QUEUE_DEPTH * stripe_count);
+
+    return store;
+}
+
+int store_set_queue_depth(store_t *store, uint32_t queue_depth) {
+    if (store->store_type == TIERED_STORE) {
+        return store_set_queue_depth(((tiered_store_t *)store->internal)->cold, queue_depth);
+    }
+
+    if (store->store_type != FILE_STORE && store->store_type != DIRECT_STORE && store->store_type != STRIPED_STORE) {
+        return STORE_NOT_SUPPORTED;
+    }
+
+    uring_t *ring = NULL;
+    if (queue_depth > 0) {
+        ring = new_uring(queue_depth);
+        if (!ring) {
+            return STORE_NOT_SUPPORTED;
+        }
+    }
+
+    uring_t **store_ring = store->store_type == STRIPED_STORE ? &((striped_store_t *)store->internal)->ring
+                                                              : &((file_store_t *)store->internal)->ring;
+
+    pthread_rwlock_wrlock(&store->lock);
+    uring_t *old_ring = *store_ring;
+    *store_ring = ring;
+    pthread_rwlock_unlock(&store->lock);
+
+    free_uring(old_ring);
+
+    return STORE_OK;
+}
+
+int store_set_codec(store_t *store, int codec) {
+    if (codec != BLOCK_CODEC_NONE && codec != BLOCK_CODEC_DELTA) {
+        return STORE_NOT_SUPPORTED;
+    }
+
+    // The blocks of a tiered store reach its file store already compressed
+    if (store->store_type == TIERED_STORE) {
+        store_set_codec(((tiered_store_t *)store->internal)->cold, codec);
+    }
+
+    pthread_rwlock_wrlock(&store->lock);
+    store->codec = codec;
+    pthread_rwlock_unlock(&store->lock);
+
+    return STORE_OK;
+}
+
+block_t* store_alloc_blocks(store_t *store, uint32_t count) {
+    void *blocks;
+    if (posix_memalign(&blocks, STORE_BLOCK_ALIGNMENT, (size_t)count * store->block_size)) {
+        return NULL;
+    }
+
+    return blocks;
+}
+
+static void memory_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count);
+
+static int memory_store_read_block(store_t *store, block_t *output, uint32_t offset) {
+    memory_store_read_run(store, output, offset, 1);
+    return STORE_OK;
+}
+
+// Blocks past the end of the file read back as zeros, like in file_store_read_run. Compressed
+// blocks at the end of the file only take the pages they use.
+static int file_store_read_block(store_t *store, block_t *output, uint32_t offset) {
+    file_store_t *fs = (file_store_t *)store->internal;
+    ssize_t ret = pread(fs->fd, output, store->block_size, fs->data_offset + (off_t)offset * store->block_size);
+    if (ret < 0) {
+        return STORE_READ_ERROR;
+    }
+
+    if (ret < (ssize_t)store->block_size) {
+        memset((uint8_t *)output + ret, 0, store->block_size - ret);
+    }
+
+    return STORE_OK;
+}
+
+static int mmap_store_read_block(store_t *store, block_t *output, uint32_t offset) {
+    mmap_store_t *ms = (mmap_store_t *)store->internal;
+    memcpy(output, store_block(store, ms->blocks, offset), store->block_size);
+    return STORE_OK;
+}
+
+// Position in the source of the block at position offset of a memory snapshot
+static uint32_t memory_snapshot_source_offset(store_t *snapshot, uint32_t offset) {
+    memory_store_t *ss = (memory_store_t *)snapshot->internal;
+    uint32_t id = ss->first_block + (offset + snapshot->block_count - ss->first_block % snapshot->block_count) % snapshot->block_count;
+    return id % ss->source->block_count;
+}
+
+static bool memory_snapshot_copied(memory_store_t *ss, uint32_t offset) {
+    return ss->copied[offset / 64] & (1ULL << (offset % 64));
+}
+
+// Blocks the snapshot has not got yet come from the source, with the source read lock held
+// so they are not overwritten meanwhile.
+static void memory_snapshot_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    memory_store_t *ss = (memory_store_t *)store->internal;
+    store_t *source = ss->source;
+    memory_store_t *ms = (memory_store_t *)source->internal;
+
+    pthread_rwlock_rdlock(&source->lock);
+    for (uint32_t i = 0; i < count; i++) {
+        const block_t *block = memory_snapshot_copied(ss, offset + i) ?
+            store_block(store, ss->blocks, offset + i) :
+            store_block(source, ms->blocks, memory_snapshot_source_offset(store, offset + i));
+        memcpy(store_block(store, output, i), block, store->block_size);
+    }
+    pthread_rwlock_unlock(&source->lock);
+}
+
+static void memory_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    memory_store_t *ms = (memory_store_t *)store->internal;
+    if (ms->source) {
+        memory_snapshot_read_run(store, output, offset, count);
+        return;
+    }
+    memcpy(output, store_block(store, ms->blocks, offset), (size_t)count * store->block_size);
+}
+
+// Reads a run of consecutive blocks with one positional read. Blocks past the end of the
+// file were never written and read back as zeros, like in the other store types.
+static int file_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    file_store_t *fs = (file_store_t *)store->internal;
+    if (fs->ring && count > 1) {
+        return uring_read_blocks(fs->ring, fs->fd, output, store->block_size,
+                                 fs->data_offset + (off_t)offset * store->block_size, count);
+    }
+
+    uint8_t *ptr = (uint8_t *)output;
+    size_t remaining = (size_t)count * store->block_size;
+    off_t position = fs->data_offset + (off_t)offset * store->block_size;
+
+    while (remaining > 0) {
+        ssize_t ret = pread(fs->fd, ptr, remaining, position);
+        if (ret < 0) {
+            return STORE_READ_ERROR;
+        }
+        if (ret == 0) {
+            memset(ptr, 0, remaining);
+            break;
+        }
+        ptr += ret;
+        position += ret;
+        remaining -= ret;
+    }
+
+    return STORE_OK;
+}
+
+static void mmap_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    mmap_store_t *ms = (mmap_store_t *)store->internal;
+    memcpy(output, store_block(store, ms->blocks, offset), (size_t)count * store->block_size);
+}
+
+static int direct_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    if (!((uintptr_t)output % STORE_BLOCK_ALIGNMENT)) {
+        return file_store_read_run(store, output, offset, count);
+    }
+
+    block_t *bounce = store_alloc_blocks(store, count);
+    if (!bounce) {
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    int ret = file_store_read_run(store, bounce, offset, count);
+    memcpy(output, bounce, (size_t)count * store->block_size);
+    free(bounce);
+
+    return ret;
+}
+
+static bool block_is_compressed(const block_t *block) {
+    return block->hdr.block_magic == BLOCK_MAGIC && block->hdr.codec != BLOCK_CODEC_NONE;
+}
+
+// Decompresses the compressed blocks among blocks that were just read
+static int store_decompress_blocks(store_t *store, block_t *blocks, uint32_t count) {
+    block_t *packed = NULL;
+    int ret = STORE_OK;
+
+    for (uint32_t i = 0; !ret && i < count; i++) {
+        block_t *block = store_block(store, blocks, i);
+        if (!block_is_compressed(block)) {
+            continue;
+        }
+        if (!packed && !(packed = malloc(store->block_size))) {
+            return STORE_OUT_OF_MEMORY;
+        }
+        memcpy(packed, block, min((size_t)block_get_length(block), (size_t)store->block_size));
+        if (!codec_decompress_block(packed, block, store->block_size)) {
+            ret = STORE_READ_ERROR;
+        }
+    }
+
+    free(packed);
+    return ret;
+}
+
+/*
+ * Reads or writes a run of a striped store through its ring. The blocks of the run that
+ * fall in one file are consecutive there, so each file gets one vectored I/O per
+ * URING_CHUNK_LENGTH bytes, and the files are accessed in parallel.
+ */
+static int striped_store_run_uring(store_t *store, bool write, block_t *buffer, uint32_t offset, uint32_t count) {
+    striped_store_t *ss = (striped_store_t *)store->internal;
+    uint32_t chunk_blocks = min(max(URING_CHUNK_LENGTH / store->block_size, 1u), (uint32_t)IOV_MAX);
+
+    uring_io_t *ios = malloc(count * (sizeof(uring_io_t) + sizeof(struct iovec)));
+    if (!ios) {
+        return STORE_OUT_OF_MEMORY;
+    }
+    struct iovec *iov = (struct iovec *)(ios + count);
+
+    uint32_t io_count = 0;
+    uint32_t iov_count = 0;
+    for (uint32_t stripe = 0; stripe < min(ss->stripe_count, count); stripe++) {
+        file_store_t *fs = (file_store_t *)ss->stripes[(offset + stripe) % ss->stripe_count]->internal;
+        uring_io_t *io = NULL;
+        for (uint32_t i = stripe; i < count; i += ss->stripe_count) {
+            if (!io || io->iovcnt == (int)chunk_blocks) {
+                io = &ios[io_count++];
+                *io = (uring_io_t){ .fd = fs->fd, .iov = &iov[iov_count], .iovcnt = 0,
+                                    .position = fs->data_offset + (off_t)((offset + i) / ss->stripe_count) * store->block_size };
+            }
+            iov[iov_count++] = (struct iovec){ store_block(store, buffer, i), store->block_size };
+            io->iovcnt++;
+        }
+    }
+
+    int ret = uring_run(ss->ring, write, ios, io_count);
+    free(ios);
+
+    return ret;
+}
+
+static int striped_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    striped_store_t *ss = (striped_store_t *)store->internal;
+    if (ss->ring) {
+        return striped_store_run_uring(store, false, output, offset, count);
+    }
+
+    int ret = STORE_OK;
+    for (uint32_t i = 0; !ret && i < count; i++) {
+        ret = file_store_read_run(ss->stripes[(offset + i) % ss->stripe_count], store_block(store, output, i),
+                                  (offset + i) / ss->stripe_count, 1);
+    }
+
+    return ret;
+}
+
+// Finds the absolute offset of the newest block at a ring offset, and whether it is still
+// in memory.
+static bool tiered_store_in_memory(store_t *store, uint32_t offset, uint32_t *absolute) {
+    tiered_store_t *ts = (tiered_store_t *)store->internal;
+    uint32_t written = ts->written;
+    if (!written) {
+        return false;
+    }
+
+    uint32_t back = ((written - 1) % store->block_count + store->block_count - offset) % store->block_count;
+    if (back >= written) {
+        return false;
+    }
+
+    *absolute = written - 1 - back;
+    return *absolute >= ts->hot_start && written - *absolute <= ts->hot_count;
+}
+
+static int tiered_store_read_run(store_t *store, block_t *output, uint32_t offset, uint32_t count) {
+    tiered_store_t *ts = (tiered_store_t *)store->internal;
+    uint32_t absolute;
+
+    for (uint32_t i = 0; i < count; ) {
+        if (tiered_store_in_memory(store, offset + i, &absolute)) {
+            memcpy(store_block(store, output, i), store_block(store, ts->hot, absolute % ts->hot_count), store->block_size);
+            i++;
+            continue;
+        }
+
+        // Read the blocks that are only on disk in one go
+        uint32_t run = 1;
+        while (i + run < count && !tiered_store_in_memory(store, offset + i + run, &absolute)) {
+            run++;
+        }
+
+        pthread_rwlock_rdlock(&ts->cold->lock);
+        int ret = file_store_read_run(ts->cold, store_block(store, output, i), offset + i, run);
+        pthread_rwlock_unlock(&ts->cold->lock);
+        if (ret != STORE_OK) {
+            return ret;
+        }
+        i += run;
+    }
+
+    return STORE_OK;
+}
+
+// Positions that were never written read back as zeros and have nothing to check. A block
+// with any other header but no magic was damaged.
+static bool block_crc_ok(block_t *block, uint32_t block_size) {
+    if (block->hdr.block_magic != BLOCK_MAGIC) {
+        for (int i = 0; i < BLOCK_HEADER_LENGTH; i++) {
+            if (block->hdr_bytes[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    uint32_t length = block_get_length(block);
+    if (length > block_size) {
+        return false;
+    }
+
+    uint32_t crc = block->hdr.crc32;
+    block->hdr.crc32 = 0;
+    uint32_t expected = eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)block, length) ^ EYEQ_CRC_INITIAL;
+    block->hdr.crc32 = crc;
+
+    return crc == expected;
+}
+
+static void store_mark_bad_block(store_t *store, uint32_t offset) {
+    uint64_t *bitmap = __atomic_load_n(&store->bad_blocks, __ATOMIC_ACQUIRE);
+    if (!bitmap) {
+        uint64_t *allocated = calloc((store->block_count + 63) / 64, sizeof(uint64_t));
+        if (!allocated) {
+            return;
+        }
+        if (__atomic_compare_exchange_n(&store->bad_blocks, &bitmap, allocated, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            bitmap = allocated;
+        } else {
+            free(allocated);
+        }
+    }
+
+    uint64_t bit = (uint64_t)1 << (offset % 64);
+    if (!(__atomic_fetch_or(&bitmap[offset / 64], bit, __ATOMIC_ACQ_REL) & bit)) {
+        __atomic_fetch_add(&store->bad_block_count, 1, __ATOMIC_RELAXED);
+        fprintf(stderr, "Block %"PRIu32" of store failed its CRC check\n", offset);
+    }
+}
+
+// Called with the write lock held
+static void store_clear_bad_block(store_t *store, uint32_t offset) {
+    if (!store->bad_blocks) {
+        return;
+    }
+
+    uint64_t bit = (uint64_t)1 << (offset % 64);
+    if (__atomic_fetch_and(&store->bad_blocks[offset / 64], ~bit, __ATOMIC_ACQ_REL) & bit) {
+        __atomic_fetch_sub(&store->bad_block_count, 1, __ATOMIC_RELAXED);
+    }
+}
+
+bool store_is_bad_block(store_t *store, uint32_t block_offset) {
+    uint64_t *bitmap = __atomic_load_n(&store->bad_blocks, __ATOMIC_ACQUIRE);
+    block_offset %= store->block_count;
+    return bitmap && (__atomic_load_n(&bitmap[block_offset / 64], __ATOMIC_RELAXED) >> (block_offset % 64)) & 1;
+}
+
+// Decompresses blocks that were just read and checks their CRCs, recording the blocks that
+// fail. Called with the read lock held, so a block rewritten meanwhile is not marked bad.
+static int store_check_blocks(store_t *store, block_t *blocks, uint32_t block_offset, uint32_t count) {
+    block_t *packed = NULL;
+    int ret = STORE_OK;
+
+    for (uint32_t i = 0; i < count; i++) {
+        block_t *block = store_block(store, blocks, i);
+        bool intact = true;
+        if (block_is_compressed(block)) {
+            if (!packed && !(packed = malloc(store->block_size))) {
+                return STORE_OUT_OF_MEMORY;
+            }
+            memcpy(packed, block, min((size_t)block_get_length(block), (size_t)store->block_size));
+            intact = codec_decompress_block(packed, block, store->block_size);
+        }
+        if (!intact || !block_crc_ok(block, store->block_size)) {
+            store_mark_bad_block(store, (block_offset + i) % store->block_count);
+            ret = STORE_BAD_CRC;
+        }
+    }
+
+    free(packed);
+    return ret;
+}
+
+// Replaces blocks that were read from disk with their newer versions in the ingest queue
+static void store_read_queued(store_t *store, block_t *output, uint32_t block_offset, uint32_t count) {
+    store_committer_t *sc = store->committer;
+    if (!sc || !sc->queue_count) {
+        return;
+    }
+
+    uint32_t start = sc->queue_start % store->block_count;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t index = ((block_offset + i) % store->block_count + store->block_count - start) % store->block_count;
+        if (index < sc->queue_count) {
+            memcpy(store_block(store, output, i), store_block(store, sc->queue, index), store->block_size);
+        }
+    }
+}
+
+int store_read_block(store_t *store, block_t *output, uint32_t block_offset) {
+    block_offset %= store->block_count;
+
+    int ret = STORE_UNKNOWN_STORE_TYPE;
+
+    pthread_rwlock_rdlock(&store->lock);
+    if (store->store_type == MEMORY_STORE) {
+        ret = memory_store_read_block(store, output, block_offset);
+    } else if (store->store_type == FILE_STORE) {
+        ret = file_store_read_block(store, output, block_offset);
+    } else if (store->store_type == MMAP_STORE) {
+        ret = mmap_store_read_block(store, output, block_offset);
+    } else if (store->store_type == DIRECT_STORE) {
+        ret = direct_store_read_run(store, output, block_offset, 1);
+    } else if (store->store_type == TIERED_STORE) {
+        ret = tiered_store_read_run(store, output, block_offset, 1);
+    } else if (store->store_type == STRIPED_STORE) {
+        ret = striped_store_read_run(store, output, block_offset, 1);
+    }
+    if (ret == STORE_OK) {
+        store_read_queued(store, output, block_offset, 1);
+    }
+
+    bool verify = store->verify_crc;
+    if (ret == STORE_OK && verify) {
+        ret = store_check_blocks(store, output, block_offset, 1);
+    }
+    pthread_rwlock_unlock(&store->lock);
+
+    if (ret == STORE_OK && !verify) {
+        ret = store_decompress_blocks(store, output, 1);
+    }
+
+    return ret;
+}
+
+// Reads the blocks as they are stored, with the read lock held
+static int store_read_runs(store_t *store, block_t *output, uint32_t block_offset, uint32_t count) {
+    int ret = STORE_OK;
+    block_t *blocks = output;
+    uint32_t first = block_offset;
+    uint32_t total = count;
+
+    // Split the range into runs that do not cross the end of the ring.
+    while (!ret && count > 0) {
+        uint32_t offset = block_offset % store->block_count;
+        uint32_t run = min(count, store->block_count - offset);
+
+        if (store->store_type == MEMORY_STORE) {
+            memory_store_read_run(store, output, offset, run);
+        } else if (store->store_type == FILE_STORE) {
+            ret = file_store_read_run(store, output, offset, run);
+        } else if (store->store_type == MMAP_STORE) {
+            mmap_store_read_run(store, output, offset, run);
+        } else if (store->store_type == DIRECT_STORE) {
+            ret = direct_store_read_run(store, output, offset, run);
+        } else if (store->store_type == TIERED_STORE) {
+            ret = tiered_store_read_run(store, output, offset, run);
+        } else if (store->store_type == STRIPED_STORE) {
+            ret = striped_store_read_run(store, output, offset, run);
+        } else {
+            ret = STORE_UNKNOWN_STORE_TYPE;
+        }
+
+        output = store_block(store, output, run);
+        block_offset += run;
+        count -= run;
+    }
+
+    if (ret == STORE_OK) {
+        store_read_queued(store, blocks, first, total);
+    }
+
+    return ret;
+}
+
+int store_read_blocks(store_t *store, block_t *output, uint32_t block_offset, uint32_t count) {
+    pthread_rwlock_rdlock(&store->lock);
+
+    int ret = store_read_runs(store, output, block_offset, count);
+
+    bool verify = store->verify_crc;
+    if (ret == STORE_OK && verify) {
+        ret = store_check_blocks(store, output, block_offset, count);
+    }
+
+    pthread_rwlock_unlock(&store->lock);
+
+    if (ret == STORE_OK && !verify) {
+        ret = store_decompress_blocks(store, output, count);
+    }
+
+    return ret;
+}
+
+void store_set_verify(store_t *store, bool verify) {
+    pthread_rwlock_wrlock(&store->lock);
+    store->verify_crc = verify;
+    pthread_rwlock_unlock(&store->lock);
+}
+
+static void* store_scrubber(void *context) {
+    store_t *store = (store_t *)context;
+    store_scrubber_t *sc = store->scrubber;
+
+    // Stay out of the way of ingest
+    pid_t tid = syscall(SYS_gettid);
+    setpriority(PRIO_PROCESS, tid, 19);
+    syscall(SYS_ioprio_set, SCRUB_IOPRIO_WHO_PROCESS, tid, SCRUB_IOPRIO_CLASS_IDLE << SCRUB_IOPRIO_CLASS_SHIFT);
+
+    block_t *blocks = store_alloc_blocks(store, SCRUB_BATCH);
+    if (!blocks) {
+        fprintf(stderr, "Error while allocating memory for scrubber.\n");
+        return NULL;
+    }
+
+    uint32_t offset = 0;
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&sc->mutex);
+    while (!sc->stop) {
+        uint32_t rate = sc->rate;
+        pthread_mutex_unlock(&sc->mutex);
+
+        uint32_t count = min(SCRUB_BATCH, store->block_count - offset);
+        pthread_rwlock_rdlock(&store->lock);
+        int ret = store_read_runs(store, blocks, offset, count);
+        if (ret == STORE_OK) {
+            store_check_blocks(store, blocks, offset, count);
+        }
+        pthread_rwlock_unlock(&store->lock);
+        if (ret != STORE_OK) {
+            fprintf(stderr, "Scrubber could not read blocks %"PRIu32"-%"PRIu32": %d\n", offset, offset + count - 1, ret);
+        }
+        offset = (offset + count) % store->block_count;
+
+        // Each batch gets count / rate seconds. Time lost to slow reads is not made up
+        // for with a burst later.
+        uint64_t ns = next.tv_nsec + (uint64_t)count * 1000000000 / rate;
+        next.tv_sec += ns / 1000000000;
+        next.tv_nsec = ns % 1000000000;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (now.tv_sec > next.tv_sec || (now.tv_sec == next.tv_sec && now.tv_nsec > next.tv_nsec)) {
+            next = now;
+        }
+
+        pthread_mutex_lock(&sc->mutex);
+        while (!sc->stop && sc->rate == rate && pthread_cond_timedwait(&sc->cond, &sc->mutex, &next) != ETIMEDOUT) {
+        }
+    }
+    pthread_mutex_unlock(&sc->mutex);
+
+    free(blocks);
+
+    return NULL;
+}
+
+static void store_stop_scrubber(store_t *store) {
+    store_scrubber_t *sc = store->scrubber;
+    if (!sc) {
+        return;
+    }
+
+    pthread_mutex_lock(&sc->mutex);
+    sc->stop = true;
+    pthread_cond_signal(&sc->cond);
+    pthread_mutex_unlock(&sc->mutex);
+    pthread_join(sc->thread, NULL);
+
+    pthread_mutex_destroy(&sc->mutex);
+    pthread_cond_destroy(&sc->cond);
+    free(sc);
+    store->scrubber = NULL;
+    store->scrub_rate = 0;
+}
+
+int store_set_scrub_rate(store_t *store, uint32_t blocks_per_second) {
+    if (store->store_type == MEMORY_STORE) {
+        return STORE_NOT_SUPPORTED;
+    }
+
+    if (!blocks_per_second) {
+        store_stop_scrubber(store);
+        return STORE_OK;
+    }
+
+    store->scrub_rate = blocks_per_second;
+
+    if (store->scrubber) {
+        pthread_mutex_lock(&store->scrubber->mutex);
+        store->scrubber->rate = blocks_per_second;
+        pthread_cond_signal(&store->scrubber->cond);
+        pthread_mutex_unlock(&store->scrubber->mutex);
+        return STORE_OK;
+    }
+
+    store_scrubber_t *sc = calloc(1, sizeof(store_scrubber_t));
+    if (!sc) {
+        return STORE_OUT_OF_MEMORY;
+    }
+    sc->rate = blocks_per_second;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&sc->mutex, NULL);
+    pthread_cond_init(&sc->cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    store->scrubber = sc;
+    if (pthread_create(&sc->thread, NULL, store_scrubber, store)) {
+        perror("Error starting scrubber");
+        pthread_mutex_destroy(&sc->mutex);
+        pthread_cond_destroy(&sc->cond);
+        free(sc);
+        store->scrubber = NULL;
+        store->scrub_rate = 0;
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    return STORE_OK;
+}
+
+// Bytes of the mapping that are in memory
+static uint64_t mapping_resident_bytes(void *addr, size_t length) {
+    unsigned char vec[4096];
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uint64_t pages = 0;
+
+    for (size_t offset = 0; offset < length; offset += sizeof(vec) * page) {
+        size_t chunk = min(length - offset, sizeof(vec) * page);
+        if (mincore((uint8_t *)addr + offset, chunk, vec)) {
+            return 0;
+        }
+        for (size_t i = 0; i < (chunk + page - 1) / page; i++) {
+            pages += vec[i] & 1;
+        }
+    }
+
+    return pages * page;
+}
+
+int store_memory_usage(store_t *store, uint64_t *reserved, uint64_t *resident) {
+    if (store->store_type == MEMORY_STORE) {
+        memory_store_t *ms = (memory_store_t *)store->internal;
+        *reserved = ms->length;
+        *resident = mapping_resident_bytes(ms->blocks, ms->length);
+    } else if (store->store_type == MMAP_STORE) {
+        mmap_store_t *ms = (mmap_store_t *)store->internal;
+        *reserved = ms->length;
+        *resident = mapping_resident_bytes(ms->blocks, ms->length);
+    } else {
+        return STORE_NOT_SUPPORTED;
+    }
+
+    return STORE_OK;
+}
+
+int store_map_block(store_t *store, const block_t **output, uint32_t block_offset) {
+    block_offset %= store->block_count;
+
+    if (store->store_type == MEMORY_STORE) {
+        // Snapshots may still have to read the block from their source
+        memory_store_t *ms = (memory_store_t *)store->internal;
+        if (ms->source) {
+            return STORE_NOT_MAPPED;
+        }
+        *output = store_block(store, ms->blocks, block_offset);
+        return block_is_compressed(*output) ? STORE_NOT_MAPPED : STORE_OK;
+    } else if (store->store_type == MMAP_STORE) {
+        *output = store_block(store, ((mmap_store_t *)store->internal)->blocks, block_offset);
+        return block_is_compressed(*output) ? STORE_NOT_MAPPED : STORE_OK;
+    } else if (store->store_type == FILE_STORE || store->store_type == DIRECT_STORE || store->store_type == TIERED_STORE ||
+               store->store_type == STRIPED_STORE) {
+        return STORE_NOT_MAPPED;
+    }
+
+    return STORE_UNKNOWN_STORE_TYPE;
+}
+
+// Copies the blocks at positions [offset, offset + count) that snapshots still need into
+// them, before they are overwritten. Called with the write lock held.
+static void memory_store_preserve(store_t *store, uint32_t offset, uint32_t count) {
+    memory_store_t *ms = (memory_store_t *)store->internal;
+
+    for (store_t *snapshot = ms->snapshots; snapshot; snapshot = ((memory_store_t *)snapshot->internal)->next_snapshot) {
+        memory_store_t *ss = (memory_store_t *)snapshot->internal;
+        for (uint32_t position = offset; position < offset + count; position++) {
+            // The one snapshot block, if any, that is at this position in the ring
+            uint32_t id = ss->first_block + (position + store->block_count - ss->first_block % store->block_count) % store->block_count;
+            uint32_t target = id % snapshot->block_count;
+            if (id - ss->first_block >= snapshot->block_count || memory_snapshot_copied(ss, target)) {
+                continue;
+            }
+            memcpy(store_block(snapshot, ss->blocks, target), store_block(store, ms->blocks, position), store->block_size);
+            ss->copied[target / 64] |= 1ULL << (target % 64);
+        }
+    }
+}
+
+static void memory_store_write_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    memory_store_t *ms = (memory_store_t *)store->internal;
+    if (ms->snapshots) {
+        memory_store_preserve(store, offset, count);
+    }
+    memcpy(store_block(store, ms->blocks, offset), input, (size_t)count * store->block_size);
+}
+
+// Bytes of a block that have to be stored, whole pages so O_DIRECT writes stay aligned
+static size_t block_used_length(const block_t *block, uint32_t block_size) {
+    size_t length = max((size_t)block_get_length(block), (size_t)BLOCK_HEADER_LENGTH);
+    return min((length + STORE_BLOCK_ALIGNMENT - 1) & ~((size_t)STORE_BLOCK_ALIGNMENT - 1), (size_t)block_size);
+}
+
+// Punches the pages a block does not use out of the file, so the file system can reuse
+// them and reads of them do not hit the disk.
+static void punch_block_tail(int fd, off_t position, size_t used, uint32_t block_size) {
+    if (used < block_size) {
+        fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, position + used, block_size - used);
+    }
+}
+
+// Compressed stores write each block separately, only the pages it uses.
+static int file_store_write_packed_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    file_store_t *fs = (file_store_t *)store->internal;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const block_t *block = store_block(store, input, i);
+        const uint8_t *ptr = (const uint8_t *)block;
+        off_t position = fs->data_offset + ((off_t)offset + i) * store->block_size;
+        size_t used = block_used_length(block, store->block_size);
+
+        for (size_t done = 0; done < used; ) {
+            ssize_t ret = pwrite(fs->fd, ptr + done, used - done, position + done);
+            if (ret <= 0) {
+                return STORE_WRITE_ERROR;
+            }
+            done += ret;
+        }
+        punch_block_tail(fs->fd, position, used, store->block_size);
+    }
+
+    return STORE_OK;
+}
+
+static int file_store_write_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    file_store_t *fs = (file_store_t *)store->internal;
+    if (store->codec) {
+        return file_store_write_packed_run(store, input, offset, count);
+    }
+    if (fs->ring && count > 1) {
+        return uring_write_blocks(fs->ring, fs->fd, input, store->block_size,
+                                  fs->data_offset + (off_t)offset * store->block_size, count);
+    }
+
+    const uint8_t *ptr = (const uint8_t *)input;
+    size_t remaining = (size_t)count * store->block_size;
+    off_t position = fs->data_offset + (off_t)offset * store->block_size;
+
+    while (remaining > 0) {
+        ssize_t ret = pwrite(fs->fd, ptr, remaining, position);
+        if (ret <= 0) {
+            return STORE_WRITE_ERROR;
+        }
+        ptr += ret;
+        position += ret;
+        remaining -= ret;
+    }
+
+    return STORE_OK;
+}
+
+static void mmap_store_write_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    mmap_store_t *ms = (mmap_store_t *)store->internal;
+    if (!store->codec) {
+        memcpy(store_block(store, ms->blocks, offset), input, (size_t)count * store->block_size);
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        const block_t *block = store_block(store, input, i);
+        size_t used = block_used_length(block, store->block_size);
+        memcpy(store_block(store, ms->blocks, offset + i), block, used);
+        punch_block_tail(ms->fd, ((off_t)offset + i) * store->block_size, used, store->block_size);
+    }
+}
+
+static int direct_store_write_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    if (!((uintptr_t)input % STORE_BLOCK_ALIGNMENT)) {
+        return file_store_write_run(store, input, offset, count);
+    }
+
+    block_t *bounce = store_alloc_blocks(store, count);
+    if (!bounce) {
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    memcpy(bounce, input, (size_t)count * store->block_size);
+    int ret = file_store_write_run(store, bounce, offset, count);
+    free(bounce);
+
+    return ret;
+}
+
+static int striped_store_write_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    striped_store_t *ss = (striped_store_t *)store->internal;
+    if (ss->ring) {
+        return striped_store_run_uring(store, true, input, offset, count);
+    }
+
+    int ret = STORE_OK;
+    for (uint32_t i = 0; !ret && i < count; i++) {
+        ret = file_store_write_run(ss->stripes[(offset + i) % ss->stripe_count], store_block(store, input, i),
+                                   (offset + i) / ss->stripe_count, 1);
+    }
+
+    return ret;
+}
+
+// Writes blocks [from, from + count) from the hot ring to the file store. The hot ring
+// and the batch hold blocks of the block size of the file store.
+static int tiered_store_flush(tiered_store_t *ts, uint32_t from, uint32_t count) {
+    store_t *cold = ts->cold;
+
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(store_block(cold, ts->batch, i), store_block(cold, ts->hot, (from + i) % ts->hot_count), cold->block_size);
+    }
+
+    int ret = STORE_OK;
+
+    pthread_rwlock_wrlock(&cold->lock);
+    for (uint32_t i = 0; !ret && i < count; ) {
+        uint32_t offset = (from + i) % cold->block_count;
+        uint32_t run = min(count - i, cold->block_count - offset);
+        ret = file_store_write_run(cold, store_block(cold, ts->batch, i), offset, run);
+        i += run;
+    }
+    if (!ret && from + count > cold->write_offset) {
+        file_store_advance(cold, from + count - cold->write_offset);
+    }
+    pthread_rwlock_unlock(&cold->lock);
+
+    return ret;
+}
+
+static void* tiered_store_flusher(void *context) {
+    tiered_store_t *ts = (tiered_store_t *)context;
+
+    pthread_mutex_lock(&ts->mutex);
+    for (;;) {
+        while (!ts->stop && ts->flushed == ts->written) {
+            pthread_cond_wait(&ts->cond, &ts->mutex);
+        }
+        if (ts->flushed == ts->written) {
+            break;
+        }
+
+        uint32_t from = ts->flushed;
+        uint32_t count = min(ts->written - from, TIERED_FLUSH_BATCH);
+        pthread_mutex_unlock(&ts->mutex);
+
+        if (tiered_store_flush(ts, from, count) != STORE_OK) {
+            fprintf(stderr, "Error writing blocks %"PRIu32"-%"PRIu32" of tiered store to disk\n", from, from + count - 1);
+        }
+
+        pthread_mutex_lock(&ts->mutex);
+        ts->flushed = from + count;
+        pthread_cond_broadcast(&ts->cond);
+    }
+    pthread_mutex_unlock(&ts->mutex);
+
+    return NULL;
+}
+
+static void tiered_store_append(tiered_store_t *ts, block_t *input, uint32_t position, uint32_t count) {
+    pthread_mutex_lock(&ts->mutex);
+
+    // Writing past the head starts the hot ring over
+    if (position != ts->written) {
+        while (ts->flushed != ts->written) {
+            pthread_cond_wait(&ts->cond, &ts->mutex);
+        }
+        ts->hot_start = ts->written = ts->flushed = position;
+    }
+
+    // Wait until the flusher has made room
+    while (position + count - ts->flushed > ts->hot_count) {
+        pthread_cond_wait(&ts->cond, &ts->mutex);
+    }
+    pthread_mutex_unlock(&ts->mutex);
+
+    for (uint32_t i = 0; i < count; i++) {
+        memcpy(store_block(ts->cold, ts->hot, (position + i) % ts->hot_count), store_block(ts->cold, input, i),
+               ts->cold->block_size);
+    }
+
+    pthread_mutex_lock(&ts->mutex);
+    ts->written = position + count;
+    pthread_cond_broadcast(&ts->cond);
+    pthread_mutex_unlock(&ts->mutex);
+}
+
+// Appends go to memory and are written to disk by the flusher. Blocks written at an older
+// offset go straight to disk, and to memory if they are still there.
+static int tiered_store_write_run(store_t *store, block_t *input, uint32_t offset, uint32_t count) {
+    tiered_store_t *ts = (tiered_store_t *)store->internal;
+    uint32_t position = input->hdr.block_id;
+
+    if (position >= ts->written) {
+        for (uint32_t i = 0; i < count; ) {
+            uint32_t run = min(count - i, ts->hot_count);
+            tiered_store_append(ts, store_block(store, input, i), position + i, run);
+            i += run;
+        }
+        return STORE_OK;
+    }
+
+    uint32_t absolute;
+    for (uint32_t i = 0; i < count; i++) {
+        if (tiered_store_in_memory(store, offset + i, &absolute) && absolute == position + i) {
+            memcpy(store_block(store, ts->hot, absolute % ts->hot_count), store_block(store, input, i), store->block_size);
+        }
+    }
+
+    pthread_rwlock_wrlock(&ts->cold->lock);
+    int ret = file_store_write_run(ts->cold, input, offset, count);
+    pthread_rwlock_unlock(&ts->cold->lock);
+
+    return ret;
+}
+
+store_t* new_tiered_store(const char *filepath, uint32_t number_of_blocks, uint32_t block_size, uint32_t hot_blocks,
+                          bool initialize) {
+    if (!hot_blocks) {
+        fprintf(stderr, "Tiered store needs at least one block in memory.\n");
+        return NULL;
+    }
+
+    store_t *cold = new_file_store(filepath, number_of_blocks, block_size, initialize);
+    if (!cold) {
+        return NULL;
+    }
+    if (!initialize && store_find_head(cold) != STORE_OK) {
+        fprintf(stderr, "Error finding write offset of store %s\n", filepath);
+    }
+
+    store_t *store = alloc_store(TIERED_STORE, cold->block_count, cold->block_size);
+    tiered_store_t *ts = calloc(1, sizeof(tiered_store_t));
+    hot_blocks = min(hot_blocks, cold->block_count);
+    block_t *hot = ts ? calloc(hot_blocks, cold->block_size) : NULL;
+    block_t *batch = hot ? store_alloc_blocks(cold, TIERED_FLUSH_BATCH) : NULL;
+    if (!store || !batch) {
+        fprintf(stderr, "Error while allocating memory for tiered_store.\n");
+        if (store) {
+            release_store(store);
+        }
+        free(ts);
+        free(hot);
+        free_store(cold);
+        return NULL;
+    }
+
+    ts->cold = cold;
+    ts->hot = hot;
+    ts->hot_count = hot_blocks;
+    ts->batch = batch;
+    ts->hot_start = ts->written = ts->flushed = cold->write_offset;
+    pthread_mutex_init(&ts->mutex, NULL);
+    pthread_cond_init(&ts->cond, NULL);
+
+    store->write_offset = cold->write_offset;
+    store->internal = ts;
+
+    // The time index is kept for the whole store, in the file store's index file
+    store->time_index = cold->time_index;
+    cold->time_index = NULL;
+
+    if (pthread_create(&ts->flusher, NULL, tiered_store_flusher, ts)) {
+        fprintf(stderr, "Error starting tiered store flusher.\n");
+        pthread_mutex_destroy(&ts->mutex);
+        pthread_cond_destroy(&ts->cond);
+        free(batch);
+        free(hot);
+        free(ts);
+        free_store(cold);
+        release_store(store);
+        return NULL;
+    }
+
+    return store;
+}
+
+// Stops the flusher once everything is on disk
+static void free_tiered_store(tiered_store_t *ts) {
+    pthread_mutex_lock(&ts->mutex);
+    ts->stop = true;
+    pthread_cond_broadcast(&ts->cond);
+    pthread_mutex_unlock(&ts->mutex);
+    pthread_join(ts->flusher, NULL);
+
+    pthread_mutex_destroy(&ts->mutex);
+    pthread_cond_destroy(&ts->cond);
+    free_store(ts->cold);
+    free(ts->batch);
+    free(ts->hot);
+    free(ts);
+}
+
+// Waits until the flusher has written every block in memory to the file store
+static void tiered_store_drain(tiered_store_t *ts) {
+    pthread_mutex_lock(&ts->mutex);
+    while (ts->flushed != ts->written) {
+        pthread_cond_wait(&ts->cond, &ts->mutex);
+    }
+    pthread_mutex_unlock(&ts->mutex);
+}
+
+// Syncs what was written to the store files to disk, memory stores write their snapshot
+static int store_sync_files(store_t *store) {
+    int ret = 0;
+
+    if (store->store_type == MEMORY_STORE) {
+        memory_store_t *ms = (memory_store_t *)store->internal;
+        return ms->snapshot_path[0] ? memory_store_snapshot(store) : STORE_OK;
+    } else if (store->store_type == FILE_STORE || store->store_type == DIRECT_STORE) {
+        ret = fdatasync(((file_store_t *)store->internal)->fd);
+    } else if (store->store_type == MMAP_STORE) {
+        mmap_store_t *ms = (mmap_store_t *)store->internal;
+        ret = msync(ms->blocks, ms->length, MS_SYNC);
+    } else if (store->store_type == TIERED_STORE) {
+        tiered_store_t *ts = (tiered_store_t *)store->internal;
+        tiered_store_drain(ts);
+        ret = fdatasync(((file_store_t *)ts->cold->internal)->fd);
+    } else if (store->store_type == STRIPED_STORE) {
+        striped_store_t *ss = (striped_store_t *)store->internal;
+        for (uint32_t i = 0; !ret && i < ss->stripe_count; i++) {
+            ret = fdatasync(((file_store_t *)ss->stripes[i]->internal)->fd);
+        }
+    }
+
+    if (ret) {
+        perror("Error syncing store");
+        return STORE_WRITE_ERROR;
+    }
+
+    return STORE_OK;
+}
+
+// Writes blocks at absolute offset position, split into runs that do not cross the end of the ring
+static int store_write_runs(store_t *store, block_t *input, uint32_t position, uint32_t count) {
+    int ret = STORE_OK;
+
+    while (!ret && count > 0) {
+        uint32_t offset = position % store->block_count;
+        uint32_t run = min(count, store->block_count - offset);
+
+        if (store->store_type == MEMORY_STORE) {
+            memory_store_write_run(store, input, offset, run);
+        } else if (store->store_type == FILE_STORE) {
+            ret = file_store_write_run(store, input, offset, run);
+        } else if (store->store_type == MMAP_STORE) {
+            mmap_store_write_run(store, input, offset, run);
+        } else if (store->store_type == DIRECT_STORE) {
+            ret = direct_store_write_run(store, input, offset, run);
+        } else if (store->store_type == TIERED_STORE) {
+            ret = tiered_store_write_run(store, input, offset, run);
+        } else if (store->store_type == STRIPED_STORE) {
+            ret = striped_store_write_run(store, input, offset, run);
+        } else {
+            ret = STORE_UNKNOWN_STORE_TYPE;
+        }
+
+        input = store_block(store, input, run);
+        position += run;
+        count -= run;
+    }
+
+    return ret;
+}
+
+// Records on disk that count blocks were appended at from, once they are written
+static void store_persist_append(store_t *store, uint32_t from, uint32_t count) {
+    if (store->store_type == FILE_STORE || store->store_type == DIRECT_STORE) {
+        file_store_update_superblock(store, from);
+    } else if (store->store_type == STRIPED_STORE) {
+        file_store_advance(((striped_store_t *)store->internal)->stripes[0], count);
+    }
+}
+
+// Writes the ingest queue as one run, with the write lock held. The write offset already
+// includes the queued blocks.
+static int store_flush_queue(store_t *store) {
+    store_committer_t *sc = store->committer;
+    if (!sc || !sc->queue_count) {
+        return STORE_OK;
+    }
+
+    int ret = store_write_runs(store, sc->queue, sc->queue_start, sc->queue_count);
+    if (ret == STORE_OK) {
+        store_persist_append(store, sc->queue_start, sc->queue_count);
+    } else {
+        fprintf(stderr, "Error writing %"PRIu32" queued blocks from %"PRIu32"\n", sc->queue_count, sc->queue_start);
+    }
+    sc->queue_count = 0;
+
+    return ret;
+}
+
+int store_write_blocks(store_t *store, block_t *blocks, int32_t block_offset, uint32_t count) {
+    bool appending = false;
+
+    if (store->read_only) {
+        return STORE_READ_ONLY;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (block_get_length(store_block(store, blocks, i)) > store->block_size) {
+            return STORE_WRITE_ERROR;
+        }
+    }
+
+    pthread_rwlock_wrlock(&store->lock);
+
+    if (block_offset < 0) {
+        block_offset = store->write_offset;
+        appending = true;
+    }
+
+    // Update the blocks
+    for (uint32_t i = 0; i < count; i++) {
+        block_t *block = store_block(store, blocks, i);
+        block->hdr.block_id = (uint32_t)block_offset + i;
+        block->hdr.block_magic = BLOCK_MAGIC;
+
+        block->hdr.codec = BLOCK_CODEC_NONE;
+        block_set_raw_length(block, 0);
+
+        block->hdr.crc32 = 0;
+        block->hdr.crc32 = eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)block, block_get_length(block)) ^ EYEQ_CRC_INITIAL;
+    }
+
+    // The CRC covers the block as written, so it still holds after decompression.
+    block_t *packed = NULL;
+    if (store->codec) {
+        packed = store_alloc_blocks(store, count);
+        if (!packed) {
+            pthread_rwlock_unlock(&store->lock);
+            return STORE_OUT_OF_MEMORY;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            block_t *block = store_block(store, blocks, i);
+            if (!codec_compress_block(store->codec, block, store_block(store, packed, i), store->block_size)) {
+                memcpy(store_block(store, packed, i), block, store->block_size);
+            }
+        }
+    }
+
+    block_t *input = packed ? packed : blocks;
+    store_committer_t *sc = store->committer;
+    bool queued = appending && sc && sc->queue_capacity && count <= sc->queue_capacity &&
+                  store->durability != STORE_DURABILITY_SYNC;
+    int ret = STORE_OK;
+
+    if (queued) {
+        if (sc->queue_count + count > sc->queue_capacity) {
+            ret = store_flush_queue(store);
+        }
+        if (!ret) {
+            if (!sc->queue_count) {
+                sc->queue_start = (uint32_t)block_offset;
+            }
+            memcpy(store_block(store, sc->queue, sc->queue_count), input, (size_t)count * store->block_size);
+            sc->queue_count += count;
+        }
+    } else {
+        // Queued appends go first, so a block written at an offset is not overwritten by them
+        ret = store_flush_queue(store);
+        if (!ret) {
+            ret = store_write_runs(store, input, (uint32_t)block_offset, count);
+        }
+    }
+
+    free(packed);
+
+    if (!ret) {
+        for (uint32_t i = 0; i < count; i++) {
+            time_index_set(store->time_index, ((uint32_t)block_offset + i) % store->block_count, store_block(store, blocks, i));
+            store_clear_bad_block(store, ((uint32_t)block_offset + i) % store->block_count);
+        }
+    }
+
+    // If appending, increment write offset (wrapping around if necessary). Queued blocks
+    // are recorded on disk when the queue is written.
+    if (!ret && appending) {
+        if (queued) {
+            store->write_offset += count;
+        } else if (store->store_type == FILE_STORE || store->store_type == DIRECT_STORE) {
+            file_store_advance(store, count);
+        } else if (store->store_type == STRIPED_STORE) {
+            file_store_advance(((striped_store_t *)store->internal)->stripes[0], count);
+            store->write_offset += count;
+        } else {
+            store->write_offset += count;
+        }
     }
 
-    store->block_count = number_of_blocks;
-    store->store_type = MEMORY_STORE;
+    if (!ret && store->durability == STORE_DURABILITY_SYNC) {
+        ret = store_sync_files(store);
+    } else if (!ret && sc && store->durability == STORE_DURABILITY_PERIODIC) {
+        sc->unsynced += count;
+        if (store->sync_blocks && sc->unsynced >= store->sync_blocks) {
+            pthread_mutex_lock(&sc->mutex);
+            sc->kick = true;
+            pthread_cond_signal(&sc->cond);
+            pthread_mutex_unlock(&sc->mutex);
+        }
+    }
 
-    store->internal = calloc(number_of_blocks, sizeof(block_t));
-    if (!store->internal) {
-        free(store);
-        return NULL;
+    if (!ret && queued && sc->queue_count == sc->queue_capacity) {
+        ret = store_flush_queue(store);
     }
 
-    return store;
+    pthread_rwlock_unlock(&store->lock);
+
+    return ret;
 }
 
-/*
-    struct stat sb;
-    int ret = stat(filepath, &sb);
-    bool file_exists = !ret;
-    if (file_exists && (sb.st_mode & S_IFMT) != S_IFBLK && (sb.st_mode & S_IFMT) != S_IFREG)) {
-        // File is neither a regular file or a block device.
+int store_write_block(store_t *store, block_t *block, int32_t block_offset) {
+    return store_write_blocks(store, block, block_offset, 1);
+}
 
-        return NULL;
+// Writes out the ingest queue and, with periodic durability, syncs what was written since
+// the last commit.
+static int store_commit(store_t *store) {
+    store_committer_t *sc = store->committer;
+
+    pthread_rwlock_wrlock(&store->lock);
+    int ret = store_flush_queue(store);
+    uint32_t unsynced = sc->unsynced;
+    sc->unsynced = 0;
+    pthread_rwlock_unlock(&store->lock);
+
+    // Ingest goes on while the files are synced
+    if (ret == STORE_OK && unsynced && store->durability == STORE_DURABILITY_PERIODIC) {
+        ret = store_sync_files(store);
     }
 
- */
-// TODO: Metadata block?
-store_t* new_file_store(const char *filepath, uint32_t number_of_blocks, bool initialize) {
-    // If it exists, open it for reading and writing, otherwise create a new file.
-    FILE *file = fopen(filepath, initialize ? "w+" : "r+");
-    if (!file) {
-        perror("Error opening store output file");
-        return NULL;
+    return ret;
+}
+
+static void* store_committer(void *context) {
+    store_t *store = (store_t *)context;
+    store_committer_t *sc = store->committer;
+    uint32_t interval_ms = store->sync_interval_ms ? store->sync_interval_ms : STORE_DEFAULT_COMMIT_INTERVAL_MS;
+
+    pthread_mutex_lock(&sc->mutex);
+    while (!sc->stop) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        uint64_t ns = deadline.tv_nsec + (uint64_t)interval_ms * 1000000;
+        deadline.tv_sec += ns / 1000000000;
+        deadline.tv_nsec = ns % 1000000000;
+
+        while (!sc->stop && !sc->kick && pthread_cond_timedwait(&sc->cond, &sc->mutex, &deadline) != ETIMEDOUT) {
+        }
+        sc->kick = false;
+        pthread_mutex_unlock(&sc->mutex);
+
+        if (store_commit(store) != STORE_OK) {
+            fprintf(stderr, "Error committing store writes\n");
+        }
+
+        pthread_mutex_lock(&sc->mutex);
     }
+    pthread_mutex_unlock(&sc->mutex);
 
-    store_t *store = calloc(1, sizeof(store_t));
-    if (store == NULL) {
-        fprintf(stderr, "Error while allocating memory for store.\n");
-        fclose(file);
-        return NULL;
+    return NULL;
+}
+
+// Stops the committer after a last commit
+static void store_stop_committer(store_t *store) {
+    store_committer_t *sc = store->committer;
+    if (!sc) {
+        return;
     }
 
-    store->block_count = number_of_blocks;
-    store->store_type = FILE_STORE;
+    pthread_mutex_lock(&sc->mutex);
+    sc->stop = true;
+    pthread_cond_signal(&sc->cond);
+    pthread_mutex_unlock(&sc->mutex);
+    pthread_join(sc->thread, NULL);
 
-    file_store_t *fs = calloc(1, sizeof(file_store_t));
-    if (!fs) {
-        fprintf(stderr, "Error while allocating memory for file_store.\n");
-        fclose(file);
-        free(store);
-        return NULL;
+    store_commit(store);
+
+    pthread_rwlock_wrlock(&store->lock);
+    store->committer = NULL;
+    pthread_rwlock_unlock(&store->lock);
+
+    pthread_mutex_destroy(&sc->mutex);
+    pthread_cond_destroy(&sc->cond);
+    free(sc->queue);
+    free(sc);
+}
+
+// Starts a committer if the durability mode or an ingest queue needs one
+static int store_start_committer(store_t *store, uint32_t queue_blocks) {
+    if (store->durability != STORE_DURABILITY_PERIODIC && !queue_blocks) {
+        return STORE_OK;
     }
 
-    fs->file = file;
-    strncpy(fs->filepath, filepath, STORE_MAX_PATH);
-    store->internal = fs;
+    store_committer_t *sc = calloc(1, sizeof(store_committer_t));
+    if (!sc) {
+        return STORE_OUT_OF_MEMORY;
+    }
+    if (queue_blocks) {
+        sc->queue = store_alloc_blocks(store, queue_blocks);
+        if (!sc->queue) {
+            free(sc);
+            return STORE_OUT_OF_MEMORY;
+        }
+        sc->queue_capacity = queue_blocks;
+    }
 
-    return store;
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&sc->mutex, NULL);
+    pthread_cond_init(&sc->cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    pthread_rwlock_wrlock(&store->lock);
+    store->committer = sc;
+    pthread_rwlock_unlock(&store->lock);
+
+    if (pthread_create(&sc->thread, NULL, store_committer, store)) {
+        perror("Error starting store committer");
+        pthread_rwlock_wrlock(&store->lock);
+        store->committer = NULL;
+        pthread_rwlock_unlock(&store->lock);
+        pthread_mutex_destroy(&sc->mutex);
+        pthread_cond_destroy(&sc->cond);
+        free(sc->queue);
+        free(sc);
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    return STORE_OK;
 }
 
-static int memory_store_read_block(store_t *store, block_t *output, uint32_t offset) {
-    block_t *ptr = (block_t *)store->internal;
-    memcpy(output, &ptr[offset], sizeof(block_t));
+int store_set_durability(store_t *store, int durability, uint32_t interval_ms, uint32_t blocks) {
+    if (durability < STORE_DURABILITY_NONE || durability > STORE_DURABILITY_SYNC ||
+        (store->store_type == MEMORY_STORE && durability != STORE_DURABILITY_NONE)) {
+        return STORE_NOT_SUPPORTED;
+    }
+
+    uint32_t queue_blocks = store->committer ? store->committer->queue_capacity : 0;
+    int old_durability = store->durability;
+    uint32_t old_interval_ms = store->sync_interval_ms;
+    uint32_t old_blocks = store->sync_blocks;
+    store_stop_committer(store);
+
+    pthread_rwlock_wrlock(&store->lock);
+    store->durability = durability;
+    store->sync_interval_ms = interval_ms;
+    store->sync_blocks = blocks;
+    pthread_rwlock_unlock(&store->lock);
+
+    int ret = store_start_committer(store, queue_blocks);
+    if (ret != STORE_OK) {
+        // Keep the settings the committer last ran with, and try to run it again
+        pthread_rwlock_wrlock(&store->lock);
+        store->durability = old_durability;
+        store->sync_interval_ms = old_interval_ms;
+        store->sync_blocks = old_blocks;
+        pthread_rwlock_unlock(&store->lock);
+        store_start_committer(store, queue_blocks);
+    }
+
+    return ret;
+}
+
+int store_set_ingest_queue(store_t *store, uint32_t blocks) {
+    if (blocks && (store->store_type == MEMORY_STORE || store->store_type == MMAP_STORE ||
+                   store->store_type == TIERED_STORE)) {
+        return STORE_NOT_SUPPORTED;
+    }
+
+    uint32_t queue_blocks = store->committer ? store->committer->queue_capacity : 0;
+    store_stop_committer(store);
+
+    int ret = store_start_committer(store, blocks);
+    if (ret != STORE_OK) {
+        // Go on with the queue the store had
+        store_start_committer(store, queue_blocks);
+    }
+
+    return ret;
+}
+
+uint32_t store_ingest_queue_blocks(store_t *store) {
+    pthread_rwlock_rdlock(&store->lock);
+    uint32_t blocks = store->committer ? store->committer->queue_capacity : 0;
+    pthread_rwlock_unlock(&store->lock);
+    return blocks;
+}
+
+int store_sync(store_t *store) {
+    pthread_rwlock_wrlock(&store->lock);
+    int ret = store_flush_queue(store);
+    if (store->committer) {
+        store->committer->unsynced = 0;
+    }
+    pthread_rwlock_unlock(&store->lock);
+
+    if (ret == STORE_OK) {
+        ret = store_sync_files(store);
+    }
+
+    return ret;
+}
+
+// Block ids are absolute offsets. Starting from a write offset that is known to be written,
+// every block up to the head has the id of its offset, and every block from the head on
+// still has an id from the previous lap (or was never written). That makes the head the
+// first offset where the id does not match, which a binary search finds in log2(block_count) reads.
+int store_find_head(store_t *store) {
+    block_t *block = store_alloc_blocks(store, 1);
+    if (!block) {
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    uint64_t low = store->write_offset;
+    uint64_t high = low + store->block_count;
+
+    while (low < high) {
+        uint64_t mid = low + (high - low) / 2;
+        int res = store_read_block(store, block, (uint32_t)mid);
+        bool written = res == STORE_OK && block->hdr.block_magic == BLOCK_MAGIC && block->hdr.block_id == (uint32_t)mid;
+        if (written) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    free(block);
+
+    pthread_rwlock_wrlock(&store->lock);
+    store->write_offset = (uint32_t)low;
+    pthread_rwlock_unlock(&store->lock);
+
     return STORE_OK;
 }
 
-static int file_store_read_block(store_t *store, block_t *output, uint32_t offset) {
-    file_store_t *fs = (file_store_t *)store->internal;
-    int ret = fseek(fs->file, (size_t)offset * sizeof(block_t), SEEK_SET);
-    if (ret != 0) {
-        return STORE_SEEK_ERROR;
+// First block id in [low, high) with a time after time_ns, or high. With the lock held.
+static uint32_t store_search_time(store_t *store, uint32_t low, uint32_t high, uint64_t time_ns) {
+    const uint64_t *times = store->time_index->times;
+
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (times[mid % store->block_count] <= time_ns) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
     }
 
-    return fread(output, sizeof(block_t), 1, fs->file) == 1 ? STORE_OK : STORE_READ_ERROR;
+    return low;
 }
 
-int store_read_block(store_t *store, block_t *output, uint32_t block_offset) {
-    block_offset %= store->block_count;
+int store_find_time(store_t *store, uint64_t time_ns, uint32_t *block_offset) {
+    pthread_rwlock_rdlock(&store->lock);
 
-    if (store->store_type == MEMORY_STORE) {
-        return memory_store_read_block(store, output, block_offset);
-    } else if (store->store_type == FILE_STORE) {
-        return file_store_read_block(store, output, block_offset);
+    // Blocks from the oldest still in the ring up to the newest
+    uint32_t newest = store->write_offset;
+    uint32_t oldest = newest > store->block_count ? newest - store->block_count : 0;
+    if (newest == oldest) {
+        pthread_rwlock_unlock(&store->lock);
+        return STORE_NOT_FOUND;
     }
 
-    return STORE_UNKNOWN_STORE_TYPE;
+    // Find the first block after time_ns, the one before it covers time_ns
+    uint32_t low = store_search_time(store, oldest, newest, time_ns);
+
+    pthread_rwlock_unlock(&store->lock);
+
+    *block_offset = low > oldest ? low - 1 : oldest;
+
+    return STORE_OK;
+}
+
+int store_query_blocks(store_t *store, const store_query_t *query, uint32_t from, store_run_t *runs, uint32_t max_runs,
+                       uint32_t *run_count, uint32_t *next) {
+    pthread_rwlock_rdlock(&store->lock);
+
+    uint32_t to = store->write_offset;
+    uint32_t oldest = to > store->block_count ? to - store->block_count : 0;
+    from = max(from, oldest);
+
+    // Times only go forward, so the time range is found with binary searches
+    if (query->start_time_ns) {
+        uint32_t first = store_search_time(store, from, to, query->start_time_ns);
+        from = first > from ? first - 1 : from;
+    }
+    if (query->end_time_ns) {
+        to = store_search_time(store, from, to, query->end_time_ns - 1);
+    }
+
+    const time_index_t *index = store->time_index;
+    uint32_t count = 0;
+    uint32_t id = from;
+    uint32_t position = from % store->block_count;
+
+    for (; id < to; id++, position = position + 1 == store->block_count ? 0 : position + 1) {
+        if ((query->match_source_id && index->source_ids[position] != query->source_id) ||
+            (query->match_block_type && index->block_types[position] != query->block_type) ||
+            (query->match_frequency && !(index->center_frequencies[position] >= query->min_frequency &&
+                                         index->center_frequencies[position] <= query->max_frequency)) ||
+            (query->match_sample_rate && (index->sample_rates[position] < query->min_sample_rate ||
+                                          index->sample_rates[position] > query->max_sample_rate)) ||
+            (query->match_power && !(index->stats[position].mean_power >= query->min_power &&
+                                     index->stats[position].mean_power <= query->max_power))) {
+            continue;
+        }
+
+        if (count && runs[count - 1].start_block + runs[count - 1].block_count == id) {
+            runs[count - 1].block_count++;
+        } else if (count < max_runs) {
+            runs[count++] = (store_run_t){ .start_block = id, .block_count = 1 };
+        } else {
+            break;
+        }
+    }
+
+    // Continue at the write offset if the search got to the end of the time range
+    *next = id < to ? id : store->write_offset;
+    *run_count = count;
+
+    pthread_rwlock_unlock(&store->lock);
+
+    return STORE_OK;
 }
 
-static void memory_store_write_block(store_t *store, block_t *output, uint32_t offset) {
-    offset %= store->block_count;
+int store_block_stats(store_t *store, uint32_t *from, uint32_t stride, block_stats_t *stats, uint32_t max_count,
+                      uint32_t *count) {
+    stride = max(stride, 1);
+
+    pthread_rwlock_rdlock(&store->lock);
+
+    uint32_t to = store->write_offset;
+    uint32_t oldest = to > store->block_count ? to - store->block_count : 0;
+    uint32_t id = max(*from, oldest);
+    if (id >= to) {
+        pthread_rwlock_unlock(&store->lock);
+        return STORE_NOT_FOUND;
+    }
+    *from = id;
+
+    const block_stats_t *column = store->time_index->stats;
+    uint32_t n = 0;
+    for (; n < max_count && id < to; n++) {
+        uint32_t blocks = min(stride, to - id);
+        double power = 0, dc_i = 0, dc_q = 0;
+        block_stats_t *entry = &stats[n];
+        memset(entry, 0, sizeof(*entry));
+
+        for (uint32_t i = 0; i < blocks; i++, id++) {
+            const block_stats_t *block = &column[id % store->block_count];
+            power += block->mean_power;
+            dc_i += block->dc_i;
+            dc_q += block->dc_q;
+            entry->peak_magnitude = max(entry->peak_magnitude, block->peak_magnitude);
+            entry->clip_count += block->clip_count;
+        }
+        entry->mean_power = power / blocks;
+        entry->dc_i = dc_i / blocks;
+        entry->dc_q = dc_q / blocks;
+    }
+    *count = n;
+
+    pthread_rwlock_unlock(&store->lock);
 
-    block_t *ptr = (block_t *)store->internal;
-    memcpy(&ptr[offset], output, sizeof(block_t));
+    return STORE_OK;
 }
 
-static int file_store_write_block(store_t *store, block_t *output, uint32_t offset) {
-    offset %= store->block_count;
+// Blocks of BLOCK_LENGTH bytes read at a time, fewer for larger blocks
+#define TIME_INDEX_BATCH 64
 
-    file_store_t *fs = (file_store_t *)store->internal;
-    int ret = fseek(fs->file, (size_t)offset * sizeof(block_t), SEEK_SET);
-    if (ret != 0) {
-        return STORE_SEEK_ERROR;
+// Fills in the time index from the block headers of blocks from up to the write offset.
+// Used after a restart, for blocks written after the index was last saved.
+static int store_rebuild_time_index(store_t *store, uint32_t from) {
+    uint32_t batch_count = max(1, TIME_INDEX_BATCH * BLOCK_LENGTH / store->block_size);
+    block_t *batch = store_alloc_blocks(store, batch_count);
+    if (!batch) {
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    uint32_t to = store->write_offset;
+    int res = STORE_OK;
+
+    while (!res && from < to) {
+        uint32_t count = min(to - from, batch_count);
+        res = store_read_blocks(store, batch, from, count);
+
+        for (uint32_t i = 0; !res && i < count; i++) {
+            uint32_t offset = from + i;
+            const block_t *block = store_block(store, batch, i);
+            bool written = block->hdr.block_magic == BLOCK_MAGIC && block->hdr.block_id == offset;
+            time_index_set(store->time_index, offset % store->block_count, written ? block : NULL);
+        }
+        from += count;
     }
 
-    return fwrite(output, sizeof(block_t), 1, fs->file) == 1 ? STORE_OK : STORE_WRITE_ERROR;
+    free(batch);
+
+    return res;
 }
 
-int store_write_block(store_t *store, block_t *block, int32_t block_offset) {
-    bool appending = false;
+// Gives the snapshots of a memory store that is going away all the blocks they still read
+// from it.
+static void memory_store_detach_snapshots(store_t *store) {
+    memory_store_t *ms = (memory_store_t *)store->internal;
+
+    pthread_rwlock_wrlock(&store->lock);
+    memory_store_preserve(store, 0, store->block_count);
+    store_t *snapshot = ms->snapshots;
+    ms->snapshots = NULL;
+    pthread_rwlock_unlock(&store->lock);
+
+    while (snapshot) {
+        memory_store_t *ss = (memory_store_t *)snapshot->internal;
+        store_t *next = ss->next_snapshot;
+        pthread_rwlock_wrlock(&snapshot->lock);
+        ss->source = NULL;
+        ss->next_snapshot = NULL;
+        pthread_rwlock_unlock(&snapshot->lock);
+        snapshot = next;
+    }
+}
 
-    if (block_offset < 0) {
-        block_offset = store->write_offset;
-        appending = true;
+// Unlinks a memory snapshot from its source and lets go of the source
+static void memory_snapshot_detach(store_t *snapshot) {
+    memory_store_t *ss = (memory_store_t *)snapshot->internal;
+    store_t *source = ss->source;
+    if (!source) {
+        return;
     }
 
-    // Update the block
-    block->hdr.block_id = (uint32_t)block_offset;
-    block->hdr.block_magic = BLOCK_MAGIC;
+    pthread_rwlock_wrlock(&source->lock);
+    store_t **link = &((memory_store_t *)source->internal)->snapshots;
+    while (*link && *link != snapshot) {
+        link = &((memory_store_t *)(*link)->internal)->next_snapshot;
+    }
+    if (*link) {
+        *link = ss->next_snapshot;
+    }
+    pthread_rwlock_unlock(&source->lock);
 
-    block->hdr.crc32 = 0;
-    block->hdr.crc32 = eyeq_crc32(EYEQ_CRC_INITIAL, (uint8_t *)block, block->hdr.block_length) ^ EYEQ_CRC_INITIAL;
+    ss->source = NULL;
+    store_release(source);
+}
 
-    int ret = 0;
+// Copies len bytes from src_offset in src_fd to dst_offset in dst_fd, sharing the extents
+// if the file system can. Bytes past the end of the source are left as holes.
+static int store_clone_range(int src_fd, off_t src_offset, int dst_fd, off_t dst_offset, size_t len) {
+    off_t end = lseek(src_fd, 0, SEEK_END);
+    if (end <= src_offset) {
+        return STORE_OK;
+    }
+    len = min(len, (size_t)(end - src_offset));
+
+    struct file_clone_range range = {
+        .src_fd = src_fd,
+        .src_offset = src_offset,
+        .src_length = len,
+        .dest_offset = dst_offset,
+    };
+    if (!ioctl(dst_fd, FICLONERANGE, &range)) {
+        return STORE_OK;
+    }
 
-    if (store->store_type == MEMORY_STORE) {
-        memory_store_write_block(store, block, block_offset);
-    } else if (store->store_type == FILE_STORE) {
-        ret = file_store_write_block(store, block, block_offset);
+    while (len > 0) {
+        ssize_t ret = copy_file_range(src_fd, &src_offset, dst_fd, &dst_offset, len, 0);
+        if (ret < 0) {
+            perror("Error copying store blocks");
+            return STORE_WRITE_ERROR;
+        }
+        if (ret == 0) {
+            break;
+        }
+        len -= ret;
     }
 
-    // If appending, increment write offset (wrapping around if necessary).
-    if (!ret && appending) {
-        store->write_offset++;
+    return STORE_OK;
+}
+
+static int memory_store_cow_snapshot(store_t *source, uint32_t start_block, uint32_t block_count, store_t **output) {
+    memory_store_t *ms = (memory_store_t *)source->internal;
+    if (ms->source) {
+        return STORE_NOT_SUPPORTED;
     }
 
-    return ret;
+    store_t *snapshot = new_snapshot_memory_store(NULL, block_count, source->block_size, ms->numa_node, ms->hugepages, true);
+    if (!snapshot) {
+        return STORE_OUT_OF_MEMORY;
+    }
+    memory_store_t *ss = (memory_store_t *)snapshot->internal;
+    ss->copied = calloc((block_count + 63) / 64, sizeof(uint64_t));
+    if (!ss->copied) {
+        free_store(snapshot);
+        return STORE_OUT_OF_MEMORY;
+    }
+
+    snapshot->write_offset = start_block + block_count;
+    snapshot->codec = source->codec;
+    snapshot->read_only = true;
+    ss->first_block = start_block;
+
+    // From here on the source copies the blocks before overwriting them
+    pthread_rwlock_wrlock(&source->lock);
+    uint64_t oldest = source->write_offset > source->block_count ? source->write_offset - source->block_count : 0;
+    if (start_block < oldest || (uint64_t)start_block + block_count > source->write_offset) {
+        pthread_rwlock_unlock(&source->lock);
+        free_store(snapshot);
+        return STORE_NOT_FOUND;
+    }
+    for (uint32_t id = start_block; id < start_block + block_count; id++) {
+        time_index_copy(snapshot->time_index, id % block_count, source->time_index, id % source->block_count);
+    }
+    ss->source = source;
+    ss->next_snapshot = ms->snapshots;
+    ms->snapshots = snapshot;
+    source->ref_count++;
+    pthread_rwlock_unlock(&source->lock);
+
+    *output = snapshot;
+
+    return STORE_OK;
+}
+
+static int store_clone_snapshot(store_t *source, const char *filepath, uint32_t start_block, uint32_t block_count,
+                                store_t **output) {
+    int source_fd;
+    off_t source_offset;
+    if (source->store_type == FILE_STORE) {
+        file_store_t *fs = (file_store_t *)source->internal;
+        source_fd = fs->fd;
+        source_offset = fs->data_offset;
+    } else {
+        source_fd = ((mmap_store_t *)source->internal)->fd;
+        source_offset = 0;
+    }
+
+    // Creating the snapshot would truncate the source
+    struct stat source_stat, target_stat;
+    if (!stat(filepath, &target_stat) && !fstat(source_fd, &source_stat) &&
+        source_stat.st_dev == target_stat.st_dev && source_stat.st_ino == target_stat.st_ino) {
+        return STORE_ALREADY_EXISTS;
+    }
+
+    store_t *snapshot = source->store_type == FILE_STORE ?
+        new_file_store(filepath, block_count, source->block_size, true) :
+        new_mmap_store(filepath, block_count, source->block_size, true);
+    if (!snapshot) {
+        return STORE_FILE_NOT_FOUND;
+    }
+
+    int snapshot_fd;
+    off_t snapshot_offset;
+    if (snapshot->store_type == FILE_STORE) {
+        file_store_t *fs = (file_store_t *)snapshot->internal;
+        snapshot_fd = fs->fd;
+        snapshot_offset = fs->data_offset;
+    } else {
+        snapshot_fd = ((mmap_store_t *)snapshot->internal)->fd;
+        snapshot_offset = 0;
+    }
+
+    pthread_rwlock_wrlock(&source->lock);
+
+    uint64_t oldest = source->write_offset > source->block_count ? source->write_offset - source->block_count : 0;
+    int ret = start_block >= oldest && (uint64_t)start_block + block_count <= source->write_offset ?
+              store_flush_queue(source) : STORE_NOT_FOUND;
+
+    // Runs that are contiguous in both rings
+    for (uint32_t i = 0; ret == STORE_OK && i < block_count;) {
+        uint32_t from = (start_block + i) % source->block_count;
+        uint32_t to = (start_block + i) % block_count;
+        uint32_t run = min(block_count - i, min(source->block_count - from, block_count - to));
+        ret = store_clone_range(source_fd, source_offset + (off_t)from * source->block_size,
+                                snapshot_fd, snapshot_offset + (off_t)to * source->block_size,
+                                (size_t)run * source->block_size);
+        i += run;
+    }
+
+    for (uint32_t id = start_block; ret == STORE_OK && id < start_block + block_count; id++) {
+        time_index_copy(snapshot->time_index, id % block_count, source->time_index, id % source->block_count);
+    }
+    int codec = source->codec;
+
+    pthread_rwlock_unlock(&source->lock);
+
+    snapshot->write_offset = start_block + block_count;
+    if (ret == STORE_OK && snapshot->store_type == FILE_STORE) {
+        ret = file_store_write_superblock(snapshot);
+    }
+    if (ret != STORE_OK) {
+        free_store(snapshot);
+        unlink(filepath);
+        return ret;
+    }
+
+    store_set_codec(snapshot, codec);
+    snapshot->read_only = true;
+    *output = snapshot;
+
+    return STORE_OK;
+}
+
+int store_snapshot(store_t *source, const char *filepath, uint32_t start_block, uint32_t block_count,
+                   store_t **snapshot) {
+    if (block_count == 0 || block_count > source->block_count) {
+        return STORE_NOT_FOUND;
+    }
+
+    if (source->store_type == MEMORY_STORE) {
+        return memory_store_cow_snapshot(source, start_block, block_count, snapshot);
+    } else if (source->store_type == FILE_STORE || source->store_type == MMAP_STORE) {
+        return filepath && filepath[0] ?
+            store_clone_snapshot(source, filepath, start_block, block_count, snapshot) : STORE_FILE_NOT_FOUND;
+    }
+
+    return STORE_NOT_SUPPORTED;
 }
 
 void free_store(store_t *store) {
@@ -158,16 +2707,42 @@ void free_store(store_t *store) {
         return;
     }
 
+    store_stop_scrubber(store);
+    store_stop_committer(store);
+
     // Check which type it is ...
     if (store->store_type == MEMORY_STORE) {
+        memory_store_detach_snapshots(store);
+        memory_snapshot_detach(store);
+        memory_store_t *ms = (memory_store_t *)store->internal;
+        munmap(ms->blocks, ms->length);
+        free(ms->copied);
         free(store->internal);
-    } else if (store->store_type == FILE_STORE) {
+    } else if (store->store_type == FILE_STORE || store->store_type == DIRECT_STORE) {
         file_store_t *fs = (file_store_t *)store->internal;
-        fclose(fs->file);
+        if (fs->data_offset && file_store_write_superblock(store) != STORE_OK) {
+            fprintf(stderr, "Error updating superblock of %s\n", fs->filepath);
+        }
+        free_uring(fs->ring);
+        close(fs->fd);
         free(store->internal);
+    } else if (store->store_type == MMAP_STORE) {
+        mmap_store_t *ms = (mmap_store_t *)store->internal;
+        munmap(ms->blocks, ms->length);
+        close(ms->fd);
+        free(store->internal);
+    } else if (store->store_type == TIERED_STORE) {
+        free_tiered_store((tiered_store_t *)store->internal);
+    } else if (store->store_type == STRIPED_STORE) {
+        striped_store_t *ss = (striped_store_t *)store->internal;
+        for (uint32_t i = 0; i < ss->stripe_count; i++) {
+            free_store(ss->stripes[i]);
+        }
+        free_uring(ss->ring);
+        free(ss);
     }
 
-    free(store);
+    release_store(store);
 }
 
 int add_store(const char *name, const char *path, store_list_t *list, store_t *store) {
@@ -175,78 +2750,69 @@ int add_store(const char *name, const char *path, store_list_t *list, store_t *s
         return STORE_ALREADY_EXISTS;
     }
 
-    struct store_dir_entry_s *entry = calloc(1, sizeof(struct store_dir_entry_s));
-    if (!entry) {
+    if (!directory_add(&list->dir, name, path, store)) {
         return STORE_OUT_OF_MEMORY;
     }
 
-    strncpy(entry->name, name, STORE_MAX_NAME);
-    strncpy(entry->path, path, STORE_MAX_PATH);
-    entry->store = store;
-
-    fprintf(stderr, "Creating store '%s/%s', type: %d of length %"PRIu32" (%"PRIu64" bytes)\n", path, name, store->store_type, store->block_count, (uint64_t)store->block_count * sizeof(block_t));
-
-    SLIST_INSERT_HEAD(list, entry, next);
+    fprintf(stderr, "Creating store '%s/%s', type: %d of length %"PRIu32" (%"PRIu64" bytes)\n", path, name, store->store_type, store->block_count, (uint64_t)store->block_count * store->block_size);
 
     return STORE_OK;
 }
 
-static struct store_dir_entry_s* find_store_entry(const char *name, const char *path, store_list_t *list) {
-    struct store_dir_entry_s *entry = SLIST_FIRST(list);
-
-    while (entry) {
-        if (!strncmp(entry->name, name, STORE_MAX_NAME) && !strncmp(entry->path, path, STORE_MAX_PATH))
-            return entry;
-        entry = SLIST_NEXT(entry, next);
-    }
-
-    return NULL;
-}
-
 int remove_store(const char *name, const char *path, store_list_t *list) {
-    struct store_dir_entry_s *entry = find_store_entry(name, path, list);
+    dir_entry_t *entry = directory_find(&list->dir, name, path);
     if (!entry) {
         return STORE_NOT_FOUND;
     }
 
-    if (entry->store->ref_count > 0) {
+    store_t *store = (store_t *)entry->item;
+    if (store->ref_count > 0) {
         return STORE_STILL_IN_USE;
     }
 
-    SLIST_REMOVE(list, entry, store_dir_entry_s, next);
-
-    free_store(entry->store);
-    free(entry);
+    directory_remove(&list->dir, entry);
+    free_store(store);
 
     return STORE_OK;
 }
 
 store_t* find_store(const char *name, const char *path, store_list_t *list) {
-    struct store_dir_entry_s *entry = find_store_entry(name, path, list);
+    dir_entry_t *entry = directory_find(&list->dir, name, path);
     if (!entry) {
         return NULL;
     }
 
-    return entry->store;
+    return (store_t *)entry->item;
 }
 
-void iterate_store_list(const char *path, store_list_t *list, iterate_stores_callback callback, void *context) {
-    struct store_dir_entry_s *entry = SLIST_FIRST(list);
+struct store_iterate_ctx {
+    iterate_stores_callback callback;
+    void *context;
+};
 
-    while (entry) {
-        // fprintf(stderr, "Iterate: %s/%s\n", entry->path, entry->name);
-        if (!path[0] || !strncmp(entry->path, path, STORE_MAX_PATH)) {
-            if (callback(context, entry->name, entry->path, entry->store))
-                break;
-        }
-        entry = SLIST_NEXT(entry, next);
-    }
+static bool store_iterate_callback(void *context, dir_entry_t *entry) {
+    struct store_iterate_ctx *ctx = (struct store_iterate_ctx *)context;
+    return ctx->callback(ctx->context, entry->name, entry->path, (store_t *)entry->item);
+}
+
+void iterate_store_list_after(const char *path, const char *after_path, const char *after_name, store_list_t *list,
+                              iterate_stores_callback callback, void *context) {
+    struct store_iterate_ctx ctx = { .callback = callback, .context = context };
+    directory_iterate(&list->dir, path, after_path, after_name, store_iterate_callback, &ctx);
+}
+
+void iterate_store_list(const char *path, store_list_t *list, iterate_stores_callback callback, void *context) {
+    iterate_store_list_after(path, "", "", list, callback, context);
 }
 
 /*
  * store file definition:
  *
- * "name;path;store_type;number_of_blocks;current_offset;store_path"
+ * "name;path;store_type;number_of_blocks;current_offset;store_path;codec;hot_blocks;verify_crc;scrub_rate;
+ *  durability;sync_interval_ms;sync_blocks;ingest_queue_blocks;hugepages;numa_node;block_size;read_only"
+ *
+ * The store_path of a striped store is a comma separated list of files, that of a memory
+ * store its snapshot file, if any. Copy-on-write snapshots of memory stores are not saved.
  */
 int load_store_list_from_file(const char *filepath, store_list_t *list) {
     FILE *f = fopen(filepath, "r");
@@ -254,15 +2820,15 @@ int load_store_list_from_file(const char *filepath, store_list_t *list) {
         return STORE_FILE_NOT_FOUND;
     }
 
-    char line[256];
+    char line[512];
     int lineno = 0;
 
     while (fgets(line, sizeof line, f)) {
         lineno++;
-        char *fields[6];
+        char *fields[18];
         char *p = line;
 
-        for (int n = 0; n < 6; n++) {
+        for (int n = 0; n < 18; n++) {
             fields[n] = p;
             p += strcspn(p, ";\n");
             if (*p != '\0') {
@@ -276,14 +2842,35 @@ int load_store_list_from_file(const char *filepath, store_list_t *list) {
         uint32_t store_blocks = strtoul(fields[3], NULL, 10);
         uint32_t store_write_offset = strtoul(fields[4], NULL, 10);
         char *store_filepath = fields[5];
+        int store_codec = strtol(fields[6], NULL, 10);
+        uint32_t store_hot_blocks = strtoul(fields[7], NULL, 10);
+        bool store_verify = strtol(fields[8], NULL, 10);
+        uint32_t store_scrub_rate = strtoul(fields[9], NULL, 10);
+        int store_durability = strtol(fields[10], NULL, 10);
+        uint32_t store_sync_interval = strtoul(fields[11], NULL, 10);
+        uint32_t store_sync_blocks = strtoul(fields[12], NULL, 10);
+        uint32_t store_queue_blocks = strtoul(fields[13], NULL, 10);
+        bool store_hugepages = strtol(fields[14], NULL, 10);
+        int store_numa_node = fields[15][0] ? strtol(fields[15], NULL, 10) : -1;
+        uint32_t store_block_size = strtoul(fields[16], NULL, 10);
+        bool store_read_only = strtol(fields[17], NULL, 10);
 
 //        printf("Ret: %s %s\n", store_name, store_path);
 
         store_t *store;
         if (store_type == MEMORY_STORE) {
-            store = new_memory_store(store_blocks);
+            store = new_snapshot_memory_store(store_filepath, store_blocks, store_block_size, store_numa_node,
+                                              store_hugepages, false);
         } else if (store_type == FILE_STORE) {
-            store = new_file_store(store_filepath, store_blocks, !store_write_offset);
+            store = new_file_store(store_filepath, store_blocks, store_block_size, false);
+        } else if (store_type == MMAP_STORE) {
+            store = new_mmap_store(store_filepath, store_blocks, store_block_size, false);
+        } else if (store_type == DIRECT_STORE) {
+            store = new_direct_store(store_filepath, store_blocks, store_block_size, false);
+        } else if (store_type == TIERED_STORE) {
+            store = new_tiered_store(store_filepath, store_blocks, store_block_size, store_hot_blocks, false);
+        } else if (store_type == STRIPED_STORE) {
+            store = new_striped_store(store_filepath, store_blocks, store_block_size, false);
         } else {
             fprintf(stderr, "Wrong store definition %s:%d\n", filepath, lineno);
             continue;
@@ -292,7 +2879,45 @@ int load_store_list_from_file(const char *filepath, store_list_t *list) {
             fprintf(stderr, "Error creating store %s:%d\n", filepath, lineno);
             continue;
         }
-        store->write_offset = store_write_offset;
+
+        if (store_set_codec(store, store_codec) != STORE_OK) {
+            fprintf(stderr, "Unknown codec %d in store %s:%d\n", store_codec, filepath, lineno);
+        }
+
+        // The superblock and the list can each be behind, start from the newest and find
+        // the real head from the block headers. A memory store snapshot has its own offset.
+        if (store_write_offset > store->write_offset && !(store_type == MEMORY_STORE && store->write_offset)) {
+            store->write_offset = store_write_offset;
+        }
+        uint32_t indexed_offset = store->write_offset;
+        if (store_type != MEMORY_STORE && store_find_head(store) != STORE_OK) {
+            fprintf(stderr, "Error finding write offset of store %s:%d\n", filepath, lineno);
+        }
+
+        // Index the blocks written since the time index was saved, or the whole store
+        // if there was no usable index.
+        bool rebuild = store->time_index->rebuild;
+        if (rebuild) {
+            fprintf(stderr, "Rebuilding time index of store %s:%d\n", filepath, lineno);
+            indexed_offset = store->write_offset > store->block_count ? store->write_offset - store->block_count : 0;
+            store->time_index->rebuild = false;
+        }
+        if ((store_type != MEMORY_STORE || rebuild) && store_rebuild_time_index(store, indexed_offset) != STORE_OK) {
+            fprintf(stderr, "Error rebuilding time index of store %s:%d\n", filepath, lineno);
+        }
+
+        store_set_verify(store, store_verify);
+        store->read_only = store_read_only;
+        if (store_scrub_rate && store_set_scrub_rate(store, store_scrub_rate) != STORE_OK) {
+            fprintf(stderr, "Could not start scrubbing store %s:%d\n", filepath, lineno);
+        }
+        if (store_durability &&
+            store_set_durability(store, store_durability, store_sync_interval, store_sync_blocks) != STORE_OK) {
+            fprintf(stderr, "Could not set durability of store %s:%d\n", filepath, lineno);
+        }
+        if (store_queue_blocks && store_set_ingest_queue(store, store_queue_blocks) != STORE_OK) {
+            fprintf(stderr, "Could not set ingest queue of store %s:%d\n", filepath, lineno);
+        }
 
         if (add_store(store_name, store_path, list, store) != STORE_OK) {
             fprintf(stderr, "Error adding store %s:%d - store already exists!\n", filepath, lineno);
@@ -311,14 +2936,38 @@ struct store_write_ctx {
 
 static bool __save_callback(void *context, const char *name, const char *path, store_t *store) {
     struct store_write_ctx *ctx = (struct store_write_ctx *)context;
+    const char *store_filepath;
+    uint32_t hot_blocks = 0;
+    bool hugepages = false;
+    int numa_node = -1;
+
     if (store->store_type == MEMORY_STORE) {
-        fprintf(ctx->f, "%s;%s;%d;%"PRIu32";%"PRIu32";\n", name, path, store->store_type, store->block_count, store->write_offset);
-    } else if (store->store_type == FILE_STORE) {
-        fprintf(ctx->f, "%s;%s;%d;%"PRIu32";%"PRIu32";%s\n", name, path, store->store_type, store->block_count,
-                store->write_offset, ((file_store_t *) store->internal)->filepath);
+        memory_store_t *ms = (memory_store_t *)store->internal;
+        if (ms->copied) {
+            return false;
+        }
+        store_filepath = ms->snapshot_path;
+        hugepages = ms->hugepages;
+        numa_node = ms->numa_node;
+    } else if (store->store_type == FILE_STORE || store->store_type == DIRECT_STORE) {
+        store_filepath = ((file_store_t *) store->internal)->filepath;
+    } else if (store->store_type == MMAP_STORE) {
+        store_filepath = ((mmap_store_t *) store->internal)->filepath;
+    } else if (store->store_type == TIERED_STORE) {
+        tiered_store_t *ts = (tiered_store_t *)store->internal;
+        store_filepath = ((file_store_t *) ts->cold->internal)->filepath;
+        hot_blocks = ts->hot_count;
+    } else if (store->store_type == STRIPED_STORE) {
+        store_filepath = ((striped_store_t *) store->internal)->filepaths;
     } else {
         return true;
     }
+
+    fprintf(ctx->f, "%s;%s;%d;%"PRIu32";%"PRIu32";%s;%d;%"PRIu32";%d;%"PRIu32";%d;%"PRIu32";%"PRIu32";%"PRIu32";%d;%d;%"PRIu32";%d\n",
+            name, path, store->store_type, store->block_count, store->write_offset, store_filepath, store->codec,
+            hot_blocks, store->verify_crc, store->scrub_rate, store->durability, store->sync_interval_ms,
+            store->sync_blocks, store_ingest_queue_blocks(store), hugepages, numa_node, store->block_size, store->read_only);
+
     return false;
 }
 
@@ -337,13 +2986,12 @@ int save_store_list_to_file(const char *filepath, store_list_t *list) {
 }
 
 void free_store_list(store_list_t *list) {
-    struct store_dir_entry_s *entry;
-    while ((entry = SLIST_FIRST(list)) != NULL) {
-        SLIST_REMOVE(list, entry, store_dir_entry_s, next);
+    for (uint32_t i = 0; i < list->dir.count; i++) {
+        dir_entry_t *entry = list->dir.sorted[i];
         fprintf(stderr, "Removing entry: %s/%s\n", entry->path, entry->name);
-        free_store(entry->store);
-        free(entry);
+        free_store((store_t *)entry->item);
     }
+    directory_clear(&list->dir);
 }
 
 void store_use(store_t *store) {
@@ -351,7 +2999,9 @@ void store_use(store_t *store) {
         return;
     }
 
+    pthread_rwlock_wrlock(&store->lock);
     store->ref_count++;
+    pthread_rwlock_unlock(&store->lock);
 }
 
 void store_release(store_t *store) {
@@ -359,9 +3009,11 @@ void store_release(store_t *store) {
         return;
     }
 
+    pthread_rwlock_wrlock(&store->lock);
     int ref_count = store->ref_count;
     if (ref_count > 0) {
         ref_count--;
     }
     store->ref_count = ref_count;
+    pthread_rwlock_unlock(&store->lock);
 }
@@ -1,17 +1,30 @@
+#include <errno.h>
+#include <string.h>
+#include <stddef.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <math.h>
+#include <stdlib.h>
+#include <sys/stat.h>
 
 #include "unity.h"
 #include "eyeq/shared.h"
 #include "eyeq/server.h"
 #include "eyeq/server/store.h"
+#include "codec.h"
+#include "stats.h"
+#include "../crc32.h"
 
 const char *test_store_filename = "/tmp/eyeq_sample_store.dat";
 const char *test_store_list_filename = "/tmp/eyeq_sample_list.txt";
+const char *test_store_index_filename = "/tmp/eyeq_sample_store.dat.tidx";
 
 void setUp(void) {
 }
 
 void tearDown(void) {
+    unlink(test_store_index_filename);
 }
 
 void test_crc32_array(void) {
@@ -27,6 +40,28 @@ void test_crc32_array(void) {
     TEST_ASSERT_EQUAL_UINT32(0xad2d8ee1, output);
 }
 
+// Every implementation matches the nibble table, for all alignments and tail lengths
+void test_crc32_implementations(void) {
+    static uint8_t data[4096 + 64];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 2654435761u >> 13);
+    }
+
+    const crc32_implementation_t *implementations;
+    int count = crc32_implementations(&implementations);
+    TEST_ASSERT_TRUE(count >= 2);
+
+    const int lengths[] = { 0, 1, 7, 15, 63, 64, 65, 127, 128, 200, 4096 };
+    for (int offset = 0; offset < 16; offset += 3) {
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+            uint32_t expected = implementations[0].function(EYEQ_CRC_INITIAL, data + offset, lengths[l]);
+            for (int i = 1; i < count; i++) {
+                TEST_ASSERT_EQUAL_HEX32(expected, implementations[i].function(EYEQ_CRC_INITIAL, data + offset, lengths[l]));
+            }
+        }
+    }
+}
+
 void test_block_size(void) {
     block_t block;
     TEST_ASSERT_EQUAL(BLOCK_LENGTH, sizeof(block));
@@ -44,9 +79,8 @@ void test_new_memory_store(void) {
     free_store(store);
 }
 
-
 void test_new_file_store(void) {
-    store_t *store = new_file_store(test_store_filename, 128, true);
+    store_t *store = new_file_store(test_store_filename, 128, BLOCK_LENGTH, true);
     TEST_ASSERT_NOT_NULL(store);
     verify_store_metadata(store);
     free_store(store);
@@ -60,12 +94,9 @@ static void store_read_write_test(store_t *store) {
     block_t block;
     int res = store_read_block(store, &block, 0);
 
-    if (store->store_type == MEMORY_STORE) {
-        TEST_ASSERT_EQUAL_INT(STORE_OK, res);
-        TEST_ASSERT_EQUAL_INT16_ARRAY(block.data.i16_samples, all_zero.data.i16_samples, BLOCK_I16_SAMPLES);
-    } else if (store->store_type == FILE_STORE) {
-        TEST_ASSERT_EQUAL_INT(STORE_READ_ERROR, res);
-    }
+    // Blocks that were never written read as zeros in every store type
+    TEST_ASSERT_EQUAL_INT(STORE_OK, res);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(block.data.i16_samples, all_zero.data.i16_samples, BLOCK_I16_SAMPLES);
 
     // Test writing to store
     for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
@@ -97,15 +128,915 @@ void test_memory_store_io(void) {
 
 // Read and write from a file backed store
 void test_file_store_io(void) {
-    store_t *store = new_file_store(test_store_filename, 128, true);
+    store_t *store = new_file_store(test_store_filename, 128, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    store_read_write_test(store);
+
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+// Read and write from a memory-mapped store
+void test_mmap_store_io(void) {
+    store_t *store = new_mmap_store(test_store_filename, 128, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    verify_store_metadata(store);
+
+    store_read_write_test(store);
+
+    // Mapped blocks point straight into the store
+    const block_t *mapped;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_map_block(store, &mapped, 0));
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_MAGIC, mapped->hdr.block_magic);
+    TEST_ASSERT_EQUAL_INT(1, mapped->data.i16_samples[1]);
+
+    free_store(store);
+
+    // Contents survive reopening the store without initializing it
+    store = new_mmap_store(test_store_filename, 128, BLOCK_LENGTH, false);
     TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_map_block(store, &mapped, 0));
+    TEST_ASSERT_EQUAL_INT(BLOCK_I16_SAMPLES - 1, mapped->data.i16_samples[BLOCK_I16_SAMPLES - 1]);
+
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+// Read and write through O_DIRECT, with both aligned and unaligned buffers
+void test_direct_store_io(void) {
+    store_t *store = new_direct_store(test_store_filename, 128, BLOCK_LENGTH, true);
+    if (!store && errno == EINVAL) {
+        TEST_IGNORE_MESSAGE("O_DIRECT is not supported on this file system");
+    }
+    TEST_ASSERT_NOT_NULL(store);
+    verify_store_metadata(store);
 
     store_read_write_test(store);
 
+    block_t *blocks = store_alloc_blocks(store, 2);
+    TEST_ASSERT_NOT_NULL(blocks);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)blocks % STORE_BLOCK_ALIGNMENT);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, blocks, 0, 2));
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_MAGIC, blocks[0].hdr.block_magic);
+    TEST_ASSERT_EQUAL_UINT32(0, blocks[1].hdr.block_magic);
+    free(blocks);
+
+    free_store(store);
+
+    // The existing file determines the size if no block count is given
+    store = new_direct_store(test_store_filename, 0, BLOCK_LENGTH, false);
+    TEST_ASSERT_NOT_NULL(store);
+    verify_store_metadata(store);
+
     free_store(store);
     unlink(test_store_filename);
 }
 
+static void write_test_blocks(store_t *store, int count) {
+    block_t block = { 0 };
+    block.hdr.block_length = BLOCK_LENGTH;
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+}
+
+// The write offset survives a restart, even without a clean shutdown
+void test_file_store_superblock(void) {
+    store_t *store = new_file_store(test_store_filename, 16, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    write_test_blocks(store, 3);
+
+    // Opening the file while the first store is still open looks like a crash:
+    // the superblock still says 0, the head is found from the block headers.
+    store_t *crashed = new_file_store(test_store_filename, 16, BLOCK_LENGTH, false);
+    TEST_ASSERT_NOT_NULL(crashed);
+    TEST_ASSERT_EQUAL_UINT32(0, crashed->write_offset);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_find_head(crashed));
+    TEST_ASSERT_EQUAL_UINT32(3, crashed->write_offset);
+    free_store(crashed);
+
+    // Wrap around the ring, the superblock is a few blocks behind
+    write_test_blocks(store, 15);
+    crashed = new_file_store(test_store_filename, 16, BLOCK_LENGTH, false);
+    TEST_ASSERT_NOT_NULL(crashed);
+    TEST_ASSERT_EQUAL_UINT32(16, crashed->write_offset);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_find_head(crashed));
+    TEST_ASSERT_EQUAL_UINT32(18, crashed->write_offset);
+    free_store(crashed);
+
+    // A clean shutdown stores the exact write offset
+    free_store(store);
+    store = new_file_store(test_store_filename, 0, BLOCK_LENGTH, false);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_UINT32(16, store->block_count);
+    TEST_ASSERT_EQUAL_UINT32(18, store->write_offset);
+    free_store(store);
+
+    // Loading from a store list with a write offset of 0 keeps the blocks
+    FILE *f = fopen(test_store_list_filename, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "samples;;%d;16;0;%s\n", FILE_STORE, test_store_filename);
+    fclose(f);
+
+    store_list_t list = { 0 };
+    TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+    store = find_store("samples", "", &list);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_UINT32(18, store->write_offset);
+
+    free_store_list(&list);
+    unlink(test_store_list_filename);
+    unlink(test_store_filename);
+}
+
+static void store_batched_io_test(store_t *store) {
+    static block_t blocks[5];
+
+    // Unwritten blocks read back as zeros, also past the end of a file store
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, blocks, 3, 5));
+    TEST_ASSERT_EQUAL_UINT32(0, blocks[4].hdr.block_magic);
+
+    for (int i = 0; i < 5; i++) {
+        blocks[i].hdr.block_length = BLOCK_LENGTH;
+        blocks[i].data.i16_samples[0] = i;
+    }
+
+    // Two appends, the second one wraps around the end of the store
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_blocks(store, blocks, -1, 5));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_blocks(store, blocks, -1, 5));
+    TEST_ASSERT_EQUAL_UINT32(10, store->write_offset);
+
+    memset(blocks, 0, sizeof(blocks));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, blocks, 5, 5));
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_UINT32(5 + i, blocks[i].hdr.block_id);
+        TEST_ASSERT_EQUAL_UINT32(BLOCK_MAGIC, blocks[i].hdr.block_magic);
+        TEST_ASSERT_EQUAL_INT(i, blocks[i].data.i16_samples[0]);
+    }
+
+    // The single block API sees the same data
+    block_t block;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 9));
+    TEST_ASSERT_EQUAL_UINT32(9, block.hdr.block_id);
+    TEST_ASSERT_EQUAL_INT(4, block.data.i16_samples[0]);
+}
+
+// Batched reads and writes across the end of the ring
+void test_store_batched_io(void) {
+    store_t *store = new_memory_store(8);
+    TEST_ASSERT_NOT_NULL(store);
+    store_batched_io_test(store);
+    free_store(store);
+
+    store = new_file_store(test_store_filename, 8, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    store_batched_io_test(store);
+    free_store(store);
+    unlink(test_store_filename);
+
+    store = new_mmap_store(test_store_filename, 8, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    store_batched_io_test(store);
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+// Batched reads and writes with several block I/Os in flight
+void test_file_store_uring_io(void) {
+    store_t *store = new_file_store(test_store_filename, 8, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    int res = store_set_queue_depth(store, 4);
+    if (res == STORE_NOT_SUPPORTED) {
+        free_store(store);
+        unlink(test_store_filename);
+        TEST_IGNORE_MESSAGE("io_uring is not available");
+    }
+    TEST_ASSERT_EQUAL_INT(STORE_OK, res);
+
+    store_batched_io_test(store);
+
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+struct concurrent_io_ctx {
+    store_t *store;
+    volatile bool done;
+    int torn_blocks;
+};
+
+static void* concurrent_reader(void *context) {
+    struct concurrent_io_ctx *ctx = context;
+    block_t block;
+
+    while (!ctx->done) {
+        for (uint32_t i = 0; i < ctx->store->block_count; i++) {
+            if (store_read_block(ctx->store, &block, i) != STORE_OK) {
+                continue;
+            }
+            // Every sample in a block carries its block id, a mix means a torn read
+            if (block.data.i16_samples[0] != block.data.i16_samples[BLOCK_I16_SAMPLES - 1]) {
+                ctx->torn_blocks++;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// Readers never see a block that is only partially written
+void test_file_store_concurrent_io(void) {
+    store_t *store = new_file_store(test_store_filename, 16, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    struct concurrent_io_ctx ctx = { .store = store };
+    pthread_t readers[2];
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&readers[i], NULL, concurrent_reader, &ctx));
+    }
+
+    static block_t block;
+    block.hdr.block_length = BLOCK_LENGTH;
+    for (int16_t n = 0; n < 1024; n++) {
+        for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
+            block.data.i16_samples[i] = n;
+        }
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+
+    ctx.done = true;
+    for (int i = 0; i < 2; i++) {
+        pthread_join(readers[i], NULL);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, ctx.torn_blocks);
+
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+// Block i is stamped 1000 + i seconds and a half
+static void write_timed_blocks(store_t *store, int count) {
+    block_t block = { 0 };
+    block.hdr.block_length = BLOCK_LENGTH;
+    block.hdr.timestamp_nsec = 500000000;
+    for (int i = 0; i < count; i++) {
+        block.hdr.timestamp_sec = 1000 + store->write_offset;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+}
+
+static void assert_find_time(store_t *store, uint64_t time_ns, uint32_t expected) {
+    uint32_t offset = UINT32_MAX;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_find_time(store, time_ns, &offset));
+    TEST_ASSERT_EQUAL_UINT32(expected, offset);
+}
+
+static void store_find_time_test(store_t *store) {
+    // Blocks 4 to 11 are left in the ring
+    assert_find_time(store, 1005500000000ULL, 5);
+    assert_find_time(store, 1005999999999ULL, 5);
+    assert_find_time(store, 1005499999999ULL, 4);
+    assert_find_time(store, 0, 4);
+    assert_find_time(store, 2000000000000ULL, 11);
+}
+
+void test_store_find_time(void) {
+    uint32_t offset;
+    store_t *store = new_memory_store(8);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_INT(STORE_NOT_FOUND, store_find_time(store, 0, &offset));
+    write_timed_blocks(store, 12);
+    store_find_time_test(store);
+    free_store(store);
+
+    store = new_file_store(test_store_filename, 8, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    write_timed_blocks(store, 12);
+    store_find_time_test(store);
+    free_store(store);
+
+    FILE *f = fopen(test_store_list_filename, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "samples;;%d;8;12;%s\n", FILE_STORE, test_store_filename);
+    fclose(f);
+
+    // The saved index is used after a restart, and rebuilt from the blocks if it is gone
+    for (int i = 0; i < 2; i++) {
+        store_list_t list = { 0 };
+        TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+        store = find_store("samples", "", &list);
+        TEST_ASSERT_NOT_NULL(store);
+        store_find_time_test(store);
+        free_store_list(&list);
+        unlink(test_store_index_filename);
+    }
+
+    unlink(test_store_list_filename);
+    unlink(test_store_filename);
+}
+
+// Block i comes from source 1 or 2 in turns of three blocks, at 437 MHz up to block 9
+static void write_tagged_blocks(store_t *store, int count) {
+    block_t block = { 0 };
+    block.hdr.block_length = BLOCK_LENGTH;
+    block.hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+    block.hdr.timestamp_nsec = 500000000;
+    for (int i = 0; i < count; i++) {
+        uint32_t id = store->write_offset;
+        block.hdr.timestamp_sec = 1000 + id;
+        block.hdr.source_id = id / 3 % 2 + 1;
+        block.hdr.sample_block_header.center_frequency = id < 10 ? 437e6 : 145e6;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+}
+
+static void assert_query(store_t *store, const store_query_t *query, uint32_t from, uint32_t max_runs,
+                         const uint32_t *expected, uint32_t expected_count, uint32_t expected_next) {
+    store_run_t runs[8];
+    uint32_t count, next;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_query_blocks(store, query, from, runs, max_runs, &count, &next));
+    TEST_ASSERT_EQUAL_UINT32(expected_count, count);
+    for (uint32_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(expected[2 * i], runs[i].start_block);
+        TEST_ASSERT_EQUAL_UINT32(expected[2 * i + 1], runs[i].block_count);
+    }
+    TEST_ASSERT_EQUAL_UINT32(expected_next, next);
+}
+
+static void store_query_blocks_test(store_t *store) {
+    // Blocks 4 to 19 are left in the ring
+    store_query_t query = { .match_source_id = true, .source_id = 2 };
+    assert_query(store, &query, 0, 8, (uint32_t[]){ 4, 2, 9, 3, 15, 3 }, 3, 20);
+
+    // In pages of one run
+    assert_query(store, &query, 0, 1, (uint32_t[]){ 4, 2 }, 1, 9);
+    assert_query(store, &query, 9, 1, (uint32_t[]){ 9, 3 }, 1, 15);
+    assert_query(store, &query, 15, 1, (uint32_t[]){ 15, 3 }, 1, 20);
+
+    query.match_frequency = true;
+    query.min_frequency = 436e6;
+    query.max_frequency = 438e6;
+    assert_query(store, &query, 0, 8, (uint32_t[]){ 4, 2, 9, 1 }, 2, 20);
+
+    // Blocks covering 1010 s up to 1013 s are 9 to 12
+    query = (store_query_t){ .match_source_id = true, .source_id = 1,
+                             .start_time_ns = 1010000000000ULL, .end_time_ns = 1013000000000ULL };
+    assert_query(store, &query, 0, 8, (uint32_t[]){ 12, 1 }, 1, 20);
+
+    query = (store_query_t){ .match_block_type = true, .block_type = BLOCK_TYPE_I8_SAMPLES };
+    assert_query(store, &query, 0, 8, NULL, 0, 20);
+}
+
+void test_store_query_blocks(void) {
+    store_t *store = new_memory_store(16);
+    TEST_ASSERT_NOT_NULL(store);
+    write_tagged_blocks(store, 20);
+    store_query_blocks_test(store);
+    free_store(store);
+
+    store = new_file_store(test_store_filename, 16, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    write_tagged_blocks(store, 20);
+    store_query_blocks_test(store);
+    free_store(store);
+
+    FILE *f = fopen(test_store_list_filename, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "samples;;%d;16;20;%s\n", FILE_STORE, test_store_filename);
+    fclose(f);
+
+    // From the saved index, and from the blocks once it is gone
+    for (int i = 0; i < 2; i++) {
+        store_list_t list = { 0 };
+        TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+        store = find_store("samples", "", &list);
+        TEST_ASSERT_NOT_NULL(store);
+        store_query_blocks_test(store);
+        free_store_list(&list);
+        unlink(test_store_index_filename);
+    }
+
+    unlink(test_store_list_filename);
+    unlink(test_store_filename);
+}
+
+// Every 16 bit kernel matches the scalar one, for real and complex samples and any tail
+void test_block_stats_implementations(void) {
+    static int16_t samples[4096 + 31];
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+        samples[i] = (int16_t)(i * 2654435761u >> 13);
+    }
+    samples[100] = INT16_MIN;
+    samples[101] = INT16_MIN;
+    samples[200] = INT16_MAX;
+
+    const stats_implementation_t *implementations;
+    int count = stats_implementations(&implementations);
+    TEST_ASSERT_TRUE(count >= 1);
+
+    const size_t lengths[] = { 0, 2, 16, 30, 4096, 4096 + 30 };
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        for (int complex = 0; complex < 2; complex++) {
+            block_stats_t expected, stats;
+            implementations[0].function(samples, lengths[l], complex, &expected);
+            for (int i = 1; i < count; i++) {
+                implementations[i].function(samples, lengths[l], complex, &stats);
+                TEST_ASSERT_FLOAT_WITHIN(1e-6, expected.mean_power, stats.mean_power);
+                TEST_ASSERT_FLOAT_WITHIN(1e-6, expected.peak_magnitude, stats.peak_magnitude);
+                TEST_ASSERT_FLOAT_WITHIN(1e-6, expected.dc_i, stats.dc_i);
+                TEST_ASSERT_FLOAT_WITHIN(1e-6, expected.dc_q, stats.dc_q);
+                TEST_ASSERT_EQUAL_UINT32(expected.clip_count, stats.clip_count);
+            }
+        }
+    }
+}
+
+// Blocks alternate between a quiet and a half scale carrier with a DC offset on I
+void test_store_block_stats(void) {
+    store_t *store = new_memory_store(16);
+    TEST_ASSERT_NOT_NULL(store);
+
+    static block_t block;
+    block.hdr.block_length = BLOCK_LENGTH;
+    block.hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+    block.hdr.sample_block_header.num_channels = 2;
+    for (int b = 0; b < 20; b++) {
+        int16_t amplitude = b % 2 ? 16384 : 16;
+        for (size_t i = 0; i < BLOCK_I16_SAMPLES; i += 2) {
+            block.data.i16_samples[i] = (i / 2 % 2 ? amplitude : -amplitude) + 64;
+            block.data.i16_samples[i + 1] = 0;
+        }
+        block.data.i16_samples[0] = b == 19 ? INT16_MAX : block.data.i16_samples[0];
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+
+    // Blocks 4 to 19 are left in the ring
+    block_stats_t stats[8];
+    uint32_t from = 0, count;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_block_stats(store, &from, 1, stats, 8, &count));
+    TEST_ASSERT_EQUAL_UINT32(4, from);
+    TEST_ASSERT_EQUAL_UINT32(8, count);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 0.25, stats[1].mean_power);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, (16384.0 + 64) / 32768, stats[1].peak_magnitude);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5, 64.0 / 32768, stats[1].dc_i);
+    TEST_ASSERT_TRUE(stats[0].mean_power < 1e-4);
+    TEST_ASSERT_EQUAL_UINT32(0, stats[1].clip_count);
+
+    // Two blocks per entry up to the write offset
+    from = 12;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_block_stats(store, &from, 2, stats, 8, &count));
+    TEST_ASSERT_EQUAL_UINT32(4, count);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 0.125, stats[0].mean_power);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, (16384.0 + 64) / 32768, stats[0].peak_magnitude);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[3].clip_count);
+    from = 20;
+    TEST_ASSERT_EQUAL_INT(STORE_NOT_FOUND, store_block_stats(store, &from, 1, stats, 8, &count));
+
+    // Blocks above -10 dBFS
+    store_query_t query = { .match_power = true, .min_power = 0.1, .max_power = 1 };
+    store_run_t runs[16];
+    uint32_t next;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_query_blocks(store, &query, 0, runs, 16, &count, &next));
+    TEST_ASSERT_EQUAL_UINT32(8, count);
+    TEST_ASSERT_EQUAL_UINT32(5, runs[0].start_block);
+    TEST_ASSERT_EQUAL_UINT32(1, runs[0].block_count);
+
+    free_store(store);
+}
+
+// A slow two channel sine using about 10 of the 16 bits, or full range noise
+static void fill_i16_block(block_t *block, bool noise) {
+    memset(block, 0, sizeof(block_t));
+    block->hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+    block->hdr.block_length = BLOCK_LENGTH;
+    block->hdr.sample_block_header.num_channels = 2;
+    for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
+        block->data.i16_samples[i] = noise ? (int16_t)rand() : (int16_t)(500 * sin(i / 2 * 0.01 + (i & 1)));
+    }
+}
+
+void test_block_codec(void) {
+    static block_t input, packed, output;
+
+    fill_i16_block(&input, false);
+    TEST_ASSERT_TRUE(codec_compress_block(BLOCK_CODEC_DELTA, &input, &packed, BLOCK_LENGTH));
+    TEST_ASSERT_LESS_THAN(BLOCK_LENGTH / 2, packed.hdr.block_length);
+    TEST_ASSERT_TRUE(codec_decompress_block(&packed, &output, BLOCK_LENGTH));
+    TEST_ASSERT_EQUAL_MEMORY(&input, &output, BLOCK_LENGTH);
+
+    // Partial frame at the end of an 8 bit block
+    memset(&input, 0, sizeof(input));
+    input.hdr.block_type = BLOCK_TYPE_I8_SAMPLES;
+    input.hdr.block_length = BLOCK_HEADER_LENGTH + 1001;
+    for (int i = 0; i < 1001; i++) {
+        input.data.i8_samples[i] = (int8_t)(i % 7 - 3);
+    }
+    TEST_ASSERT_TRUE(codec_compress_block(BLOCK_CODEC_DELTA, &input, &packed, BLOCK_LENGTH));
+    TEST_ASSERT_TRUE(codec_decompress_block(&packed, &output, BLOCK_LENGTH));
+    TEST_ASSERT_EQUAL_MEMORY(&input, &output, input.hdr.block_length);
+
+    // Noise does not compress, and corrupt data is detected
+    fill_i16_block(&input, true);
+    TEST_ASSERT_FALSE(codec_compress_block(BLOCK_CODEC_DELTA, &input, &packed, BLOCK_LENGTH));
+    fill_i16_block(&input, false);
+    TEST_ASSERT_TRUE(codec_compress_block(BLOCK_CODEC_DELTA, &input, &packed, BLOCK_LENGTH));
+    packed.data.bytes[0] = 200;
+    TEST_ASSERT_FALSE(codec_decompress_block(&packed, &output, BLOCK_LENGTH));
+}
+
+// Every unpacker gives the same samples as the scalar one, for any width, frame length and
+// number of channels
+void test_codec_unpack_implementations(void) {
+    // A frame of 64 residuals of up to 17 bits, and room for the 8 byte loads after it
+    uint8_t packed[64 * 17 / 8 + 8];
+    for (size_t i = 0; i < sizeof(packed); i++) {
+        packed[i] = rand();
+    }
+
+    const codec_unpack_implementation_t *implementations;
+    int count = codec_unpack_implementations(&implementations);
+    const int32_t start[8] = { 1, -2, 3, -4, 5, -6, 7, -8 };
+    const uint32_t lengths[] = { 64, 21, 3 };
+
+    for (int size = 1; size <= 2; size++) {
+        for (uint32_t width = 0; width <= (uint32_t)size * 8 + 1; width++) {
+            for (uint32_t channels = 1; channels <= 8; channels++) {
+                for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+                    int16_t expected[64], samples[64];
+                    int32_t expected_previous[8], previous[8];
+                    uint32_t expected_channel = 0;
+                    memcpy(expected_previous, start, sizeof(start));
+                    implementations[0].function(packed, width, lengths[l], size, channels, &expected_channel,
+                                                expected_previous, expected);
+
+                    for (int i = 1; i < count; i++) {
+                        uint32_t channel = 0;
+                        memcpy(previous, start, sizeof(start));
+                        implementations[i].function(packed, width, lengths[l], size, channels, &channel, previous,
+                                                    samples);
+                        TEST_ASSERT_EQUAL_MEMORY(expected, samples, lengths[l] * size);
+                        TEST_ASSERT_EQUAL_MEMORY(expected_previous, previous, channels * sizeof(int32_t));
+                        TEST_ASSERT_EQUAL_UINT32(expected_channel, channel);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void store_compression_test(store_t *store) {
+    static block_t blocks[4], output[4];
+
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_codec(store, BLOCK_CODEC_DELTA));
+    for (int i = 0; i < 4; i++) {
+        fill_i16_block(&blocks[i], i == 2);
+    }
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_blocks(store, blocks, -1, 4));
+
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, output, 0, 4));
+    TEST_ASSERT_EQUAL_MEMORY(blocks, output, sizeof(blocks));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, output, 1));
+    TEST_ASSERT_EQUAL_MEMORY(&blocks[1], output, sizeof(block_t));
+
+    // Compressed blocks cannot be used in place
+    const block_t *mapped;
+    TEST_ASSERT_EQUAL_INT(STORE_NOT_MAPPED, store_map_block(store, &mapped, 0));
+}
+
+void test_store_compression(void) {
+    store_t *store = new_memory_store(4);
+    TEST_ASSERT_NOT_NULL(store);
+    store_compression_test(store);
+    free_store(store);
+
+    store = new_file_store(test_store_filename, 4, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    store_compression_test(store);
+    free_store(store);
+
+    // The file only takes the pages of the compressed blocks (plus the superblock)
+    struct stat sb;
+    TEST_ASSERT_EQUAL_INT(0, stat(test_store_filename, &sb));
+    TEST_ASSERT_LESS_THAN(5 * sizeof(block_t), (size_t)sb.st_blocks * 512);
+    unlink(test_store_filename);
+}
+
+#define LARGE_BLOCK_SIZE (256 * 1024)
+
+// Blocks over 64 KiB, compressed and checked
+static void large_block_test(store_t *store) {
+    TEST_ASSERT_EQUAL_UINT32(LARGE_BLOCK_SIZE, store->block_size);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_codec(store, BLOCK_CODEC_DELTA));
+    store_set_verify(store, true);
+
+    block_t *blocks = store_alloc_blocks(store, 4);
+    block_t *output = store_alloc_blocks(store, 4);
+    TEST_ASSERT_NOT_NULL(blocks);
+    TEST_ASSERT_NOT_NULL(output);
+
+    uint32_t samples = block_payload_size(LARGE_BLOCK_SIZE) / sizeof(int16_t);
+    for (uint32_t b = 0; b < 4; b++) {
+        block_t *block = store_block(store, blocks, b);
+        block->hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+        block_set_length(block, LARGE_BLOCK_SIZE - b * 1000);
+        int16_t *payload = block_payload(block);
+        for (uint32_t i = 0; i < samples; i++) {
+            payload[i] = b == 2 ? (int16_t)rand() : (int16_t)(500 * sin(i * 0.001 + b));
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_blocks(store, blocks, -1, 4));
+
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, output, 0, 4));
+    for (uint32_t b = 0; b < 4; b++) {
+        block_t *block = store_block(store, output, b);
+        TEST_ASSERT_EQUAL_UINT32(LARGE_BLOCK_SIZE - b * 1000, block_get_length(block));
+        TEST_ASSERT_EQUAL_UINT32(b, block->hdr.block_id);
+        TEST_ASSERT_EQUAL_MEMORY(block_payload(store_block(store, blocks, b)), block_payload(block),
+                                 block_get_length(block) - BLOCK_HEADER_LENGTH);
+    }
+
+    // Blocks cannot be longer than the block size
+    block_set_length(blocks, LARGE_BLOCK_SIZE + 1);
+    TEST_ASSERT_EQUAL_INT(STORE_WRITE_ERROR, store_write_blocks(store, blocks, -1, 1));
+
+    free(blocks);
+    free(output);
+}
+
+void test_large_blocks(void) {
+    TEST_ASSERT_FALSE(store_valid_block_size(BLOCK_LENGTH + 1));
+    TEST_ASSERT_FALSE(store_valid_block_size(BLOCK_MAX_LENGTH * 2));
+    TEST_ASSERT_NULL(new_file_store(test_store_filename, 4, 3 * BLOCK_LENGTH, true));
+
+    store_t *store = new_snapshot_memory_store(NULL, 8, LARGE_BLOCK_SIZE, -1, false, true);
+    TEST_ASSERT_NOT_NULL(store);
+    large_block_test(store);
+    free_store(store);
+
+    store = new_mmap_store(test_store_filename, 8, LARGE_BLOCK_SIZE, true);
+    TEST_ASSERT_NOT_NULL(store);
+    large_block_test(store);
+    free_store(store);
+
+    store = new_file_store(test_store_filename, 8, LARGE_BLOCK_SIZE, true);
+    TEST_ASSERT_NOT_NULL(store);
+    large_block_test(store);
+    free_store(store);
+
+    // The block size of an existing file comes from its superblock
+    store = new_file_store(test_store_filename, 8, 0, false);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_UINT32(LARGE_BLOCK_SIZE, store->block_size);
+    block_t *block = store_alloc_blocks(store, 1);
+    TEST_ASSERT_NOT_NULL(block);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_codec(store, BLOCK_CODEC_DELTA));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, block, 3));
+    TEST_ASSERT_EQUAL_UINT32(LARGE_BLOCK_SIZE - 3000, block_get_length(block));
+    TEST_ASSERT_EQUAL_INT((int16_t)(500 * sin(1000 * 0.001 + 3)), ((int16_t *)block_payload(block))[1000]);
+    free(block);
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+// Block i carries i in its first sample byte
+static void write_numbered_blocks(store_t *store, int count) {
+    block_t block = { 0 };
+    block.hdr.block_length = BLOCK_LENGTH;
+    for (int i = 0; i < count; i++) {
+        block.data.bytes[0] = (uint8_t)store->write_offset;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+}
+
+static void assert_numbered_blocks(store_t *store, uint32_t from, uint32_t to) {
+    static block_t blocks[32];
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, blocks, from, to - from));
+    for (uint32_t i = from; i < to; i++) {
+        TEST_ASSERT_EQUAL_UINT32(i, blocks[i - from].hdr.block_id);
+        TEST_ASSERT_EQUAL_INT((uint8_t)i, blocks[i - from].data.bytes[0]);
+    }
+}
+
+// Pages are committed as blocks are written
+void test_memory_store_placement(void) {
+    store_t *store = new_memory_store_on_node(512, -1, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    uint64_t reserved, resident;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_memory_usage(store, &reserved, &resident));
+    TEST_ASSERT_TRUE(reserved >= 512 * sizeof(block_t));
+    TEST_ASSERT_EQUAL_UINT64(0, resident);
+
+    write_numbered_blocks(store, 16);
+    assert_numbered_blocks(store, 0, 16);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_memory_usage(store, &reserved, &resident));
+    TEST_ASSERT_TRUE(resident >= 16 * sizeof(block_t));
+    TEST_ASSERT_TRUE(resident <= reserved);
+    free_store(store);
+
+    // Nodes that do not exist
+    TEST_ASSERT_NULL(new_memory_store_on_node(16, 1000, false));
+    TEST_ASSERT_NULL(new_memory_store_on_node(16, 5000, false));
+}
+
+void test_memory_store_snapshot(void) {
+    const char *filepath = "/tmp/eyeq_snapshot.dat";
+    store_t *store = new_snapshot_memory_store(filepath, 64, BLOCK_LENGTH, -1, false, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    block_t block = { 0 };
+    block.hdr.block_length = BLOCK_LENGTH;
+    for (int i = 0; i < 20; i++) {
+        block.data.bytes[0] = (uint8_t)i;
+        block.hdr.timestamp_sec = 100 + i;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_sync(store));
+
+    // Blocks written after the snapshot are lost, the list does not override it
+    write_numbered_blocks(store, 3);
+    store_list_t list = { 0 };
+    TEST_ASSERT_EQUAL_INT(STORE_OK, add_store("samples", "", &list, store));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, save_store_list_to_file(test_store_list_filename, &list));
+    free_store_list(&list);
+
+    for (int reload = 0; reload < 2; reload++) {
+        TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+        store = find_store("samples", "", &list);
+        TEST_ASSERT_NOT_NULL(store);
+        TEST_ASSERT_EQUAL_UINT32(20 + reload, store->write_offset);
+        assert_numbered_blocks(store, 0, 20 + reload);
+
+        uint32_t offset;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_find_time(store, 110ULL * 1000000000, &offset));
+        TEST_ASSERT_EQUAL_UINT32(10, offset);
+
+        // A new snapshot replaces the mapped one
+        if (!reload) {
+            write_numbered_blocks(store, 1);
+            TEST_ASSERT_EQUAL_INT(STORE_OK, store_sync(store));
+        }
+        TEST_ASSERT_EQUAL_INT(STORE_OK, save_store_list_to_file(test_store_list_filename, &list));
+        free_store_list(&list);
+    }
+
+    // Once the ring wrapped around, in more than one chunk
+    store = new_snapshot_memory_store(filepath, 300, BLOCK_LENGTH, -1, false, true);
+    TEST_ASSERT_NOT_NULL(store);
+    write_numbered_blocks(store, 310);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_sync(store));
+    free_store(store);
+    store = new_snapshot_memory_store(filepath, 300, BLOCK_LENGTH, -1, false, false);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_UINT32(310, store->write_offset);
+    assert_numbered_blocks(store, 280, 310);
+    assert_numbered_blocks(store, 10, 40);
+    free_store(store);
+
+    unlink(test_store_list_filename);
+    unlink(filepath);
+}
+
+void test_tiered_store(void) {
+    store_t *store = new_tiered_store(test_store_filename, 16, BLOCK_LENGTH, 4, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    // Recent blocks come from memory, older ones from the file, also around the ring end
+    write_numbered_blocks(store, 10);
+    assert_numbered_blocks(store, 0, 10);
+    write_numbered_blocks(store, 15);
+    assert_numbered_blocks(store, 9, 25);
+
+    // Rewriting a block that is on disk
+    block_t block;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 12));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, 12));
+    assert_numbered_blocks(store, 9, 25);
+    free_store(store);
+
+    // Everything reached the file when the store was closed
+    FILE *f = fopen(test_store_list_filename, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "samples;;%d;16;0;%s;0;4\n", TIERED_STORE, test_store_filename);
+    fclose(f);
+
+    store_list_t list = { 0 };
+    TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+    store = find_store("samples", "", &list);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_UINT32(25, store->write_offset);
+    assert_numbered_blocks(store, 9, 25);
+    write_numbered_blocks(store, 2);
+    assert_numbered_blocks(store, 11, 27);
+
+    free_store_list(&list);
+    unlink(test_store_list_filename);
+    unlink(test_store_filename);
+}
+
+// Runs longer than one io_uring I/O, also ending past the end of the file
+void test_file_store_uring_chunks(void) {
+    store_t *store = new_file_store(test_store_filename, 40, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    if (store_set_queue_depth(store, 2) == STORE_NOT_SUPPORTED) {
+        free_store(store);
+        unlink(test_store_filename);
+        TEST_IGNORE_MESSAGE("io_uring is not available");
+    }
+
+    write_numbered_blocks(store, 30);
+    assert_numbered_blocks(store, 0, 30);
+
+    static block_t blocks[20];
+    memset(blocks, 0xff, sizeof(blocks));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_blocks(store, blocks, 20, 20));
+    TEST_ASSERT_EQUAL_UINT32(29, blocks[9].hdr.block_id);
+    for (int i = 10; i < 20; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, blocks[i].hdr.block_magic);
+        TEST_ASSERT_EQUAL_UINT8(0, blocks[i].data.bytes[SAMPLE_DATA_PER_BLOCK - 1]);
+    }
+
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+void test_striped_store(void) {
+    const char *filepaths = "/tmp/eyeq_stripe0.dat,/tmp/eyeq_stripe1.dat";
+    store_t *store = new_striped_store(filepaths, 15, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    // Through io_uring and with plain preads and pwrites, also around the ring end
+    write_numbered_blocks(store, 10);
+    assert_numbered_blocks(store, 0, 10);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_queue_depth(store, 0));
+    write_numbered_blocks(store, 10);
+    assert_numbered_blocks(store, 5, 20);
+    free_store(store);
+
+    FILE *f = fopen(test_store_list_filename, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "samples;;%d;15;0;%s;0;0\n", STRIPED_STORE, filepaths);
+    fclose(f);
+
+    store_list_t list = { 0 };
+    TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+    store = find_store("samples", "", &list);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_UINT32(20, store->write_offset);
+    assert_numbered_blocks(store, 5, 20);
+
+    free_store_list(&list);
+    unlink(test_store_list_filename);
+    unlink("/tmp/eyeq_stripe0.dat");
+    unlink("/tmp/eyeq_stripe0.dat.tidx");
+    unlink("/tmp/eyeq_stripe1.dat");
+}
+
+// Snapshots keep their blocks while the source wraps around over them
+void test_store_snapshot(void) {
+    const char *filepath = "/tmp/eyeq_snapshot_copy.dat";
+    for (int type = 0; type < 3; type++) {
+        store_t *store = type == 0 ? new_memory_store(16) :
+                         type == 1 ? new_file_store(test_store_filename, 16, BLOCK_LENGTH, true) :
+                                     new_mmap_store(test_store_filename, 16, BLOCK_LENGTH, true);
+        TEST_ASSERT_NOT_NULL(store);
+        write_numbered_blocks(store, 20);
+
+        store_t *snapshot;
+        TEST_ASSERT_EQUAL_INT(STORE_NOT_FOUND, store_snapshot(store, filepath, 2, 8, &snapshot));
+        TEST_ASSERT_EQUAL_INT(STORE_NOT_FOUND, store_snapshot(store, filepath, 16, 8, &snapshot));
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_snapshot(store, filepath, 8, 8, &snapshot));
+        TEST_ASSERT_EQUAL_UINT32(8, snapshot->block_count);
+        TEST_ASSERT_EQUAL_UINT32(16, snapshot->write_offset);
+        TEST_ASSERT_EQUAL_INT(type == 0, store->ref_count);
+
+        block_t block = { 0 };
+        TEST_ASSERT_EQUAL_INT(STORE_READ_ONLY, store_write_block(snapshot, &block, -1));
+
+        write_numbered_blocks(store, 6);
+        assert_numbered_blocks(snapshot, 8, 16);
+        write_numbered_blocks(store, 10);
+        assert_numbered_blocks(store, 20, 36);
+        assert_numbered_blocks(snapshot, 8, 16);
+
+        // Memory snapshots get the rest of their blocks when the source goes first
+        if (type == 0) {
+            free_store(store);
+            assert_numbered_blocks(snapshot, 8, 16);
+            free_store(snapshot);
+        } else {
+            free_store(snapshot);
+            free_store(store);
+        }
+        unlink(filepath);
+        unlink("/tmp/eyeq_snapshot_copy.dat.tidx");
+        unlink(test_store_filename);
+    }
+}
+
 static bool iteration_test_callback(void *context, const char *name, const char *path, store_t *store) {
     TEST_ASSERT_EQUAL_STRING("samples", name);
     return false;
@@ -151,17 +1082,214 @@ void test_store_list(void) {
     free_store_list(&other_list);
 }
 
+// Flips a byte of a block in a file store, behind the store's back
+static void corrupt_file_block(uint32_t offset, size_t at) {
+    int fd = open(test_store_filename, O_RDWR);
+    TEST_ASSERT_TRUE(fd >= 0);
+    uint8_t byte;
+    off_t position = (off_t)(offset + 1) * sizeof(block_t) + at;
+    TEST_ASSERT_EQUAL_INT(1, pread(fd, &byte, 1, position));
+    byte ^= 0x10;
+    TEST_ASSERT_EQUAL_INT(1, pwrite(fd, &byte, 1, position));
+    close(fd);
+}
+
+void test_store_verify_crc(void) {
+    store_t *store = new_file_store(test_store_filename, 64, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    write_numbered_blocks(store, 32);
+    corrupt_file_block(5, BLOCK_HEADER_LENGTH + 100);
+
+    // Only noticed when verifying
+    block_t block;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 5));
+    store_set_verify(store, true);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 4));
+    TEST_ASSERT_EQUAL_INT(STORE_BAD_CRC, store_read_block(store, &block, 5));
+    TEST_ASSERT_TRUE(store_is_bad_block(store, 5));
+    TEST_ASSERT_EQUAL_UINT32(1, store->bad_block_count);
+
+    // A damaged magic does not pass for a block that was never written, which does
+    corrupt_file_block(7, offsetof(block_t, hdr.block_magic));
+    TEST_ASSERT_EQUAL_INT(STORE_BAD_CRC, store_read_block(store, &block, 7));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 40));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 6));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, 7));
+    TEST_ASSERT_EQUAL_UINT32(1, store->bad_block_count);
+
+    // Rewriting the block clears it
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 6));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, 5));
+    TEST_ASSERT_FALSE(store_is_bad_block(store, 5));
+    TEST_ASSERT_EQUAL_UINT32(0, store->bad_block_count);
+
+    // The scrubber finds corrupt blocks by itself
+    store_set_verify(store, false);
+    corrupt_file_block(20, BLOCK_HEADER_LENGTH + 100);
+    store_t *memory_store = new_memory_store(1);
+    TEST_ASSERT_EQUAL_INT(STORE_NOT_SUPPORTED, store_set_scrub_rate(memory_store, 100));
+    free_store(memory_store);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_scrub_rate(store, 1000));
+    for (int i = 0; i < 200 && !store_is_bad_block(store, 20); i++) {
+        usleep(10000);
+    }
+    TEST_ASSERT_TRUE(store_is_bad_block(store, 20));
+    TEST_ASSERT_EQUAL_UINT32(1, __atomic_load_n(&store->bad_block_count, __ATOMIC_RELAXED));
+
+    free_store(store);
+    unlink(test_store_filename);
+}
+
+void test_store_durability(void) {
+    store_t *memory_store = new_memory_store(1);
+    TEST_ASSERT_EQUAL_INT(STORE_NOT_SUPPORTED, store_set_durability(memory_store, STORE_DURABILITY_SYNC, 0, 0));
+    TEST_ASSERT_EQUAL_INT(STORE_NOT_SUPPORTED, store_set_ingest_queue(memory_store, 8));
+    free_store(memory_store);
+
+    store_t *store = new_file_store(test_store_filename, 64, BLOCK_LENGTH, true);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_durability(store, STORE_DURABILITY_PERIODIC, 10000, 0));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_ingest_queue(store, 8));
+    TEST_ASSERT_EQUAL_UINT32(8, store_ingest_queue_blocks(store));
+
+    // Queued blocks are read from the queue, the queue overflows into the file
+    write_numbered_blocks(store, 5);
+    assert_numbered_blocks(store, 0, 5);
+    write_numbered_blocks(store, 5);
+    assert_numbered_blocks(store, 0, 10);
+
+    // Writes at an offset go after the queued appends
+    block_t block;
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_read_block(store, &block, 7));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, 7));
+    write_numbered_blocks(store, 2);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_sync(store));
+    assert_numbered_blocks(store, 0, 12);
+
+    // Synchronous writes bypass the queue
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_durability(store, STORE_DURABILITY_SYNC, 0, 0));
+    write_numbered_blocks(store, 2);
+    assert_numbered_blocks(store, 0, 14);
+
+    // The last queued blocks are written when the store is freed, and the settings are
+    // kept in the store list
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_set_durability(store, STORE_DURABILITY_PERIODIC, 10000, 1000));
+    write_numbered_blocks(store, 3);
+
+    store_list_t list = { 0 };
+    TEST_ASSERT_EQUAL_INT(STORE_OK, add_store("samples", "", &list, store));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, save_store_list_to_file(test_store_list_filename, &list));
+    free_store_list(&list);
+
+    TEST_ASSERT_EQUAL_INT(STORE_OK, load_store_list_from_file(test_store_list_filename, &list));
+    store = find_store("samples", "", &list);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_INT(STORE_DURABILITY_PERIODIC, store->durability);
+    TEST_ASSERT_EQUAL_UINT32(10000, store->sync_interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(1000, store->sync_blocks);
+    TEST_ASSERT_EQUAL_UINT32(8, store_ingest_queue_blocks(store));
+    TEST_ASSERT_EQUAL_UINT32(17, store->write_offset);
+    assert_numbered_blocks(store, 0, 17);
+
+    // A committer that cannot start leaves the store with its old one, and appends go on
+    TEST_ASSERT_EQUAL_INT(STORE_OUT_OF_MEMORY, store_set_ingest_queue(store, UINT32_MAX));
+    TEST_ASSERT_EQUAL_INT(STORE_DURABILITY_PERIODIC, store->durability);
+    TEST_ASSERT_EQUAL_UINT32(8, store_ingest_queue_blocks(store));
+    write_numbered_blocks(store, 2);
+    assert_numbered_blocks(store, 0, 19);
+
+    free_store_list(&list);
+    unlink(test_store_list_filename);
+    unlink(test_store_filename);
+}
+
+struct page_ctx {
+    char path[STORE_MAX_PATH+1];
+    char name[STORE_MAX_NAME+1];
+    int count;
+    int page_size;
+};
+
+static bool page_test_callback(void *context, const char *name, const char *path, store_t *store) {
+    struct page_ctx *ctx = (struct page_ctx *)context;
+    TEST_ASSERT_EQUAL_INT(0, strncmp(path, "pass", 4));
+    TEST_ASSERT_TRUE(strcmp(path, "passes") != 0);
+    strcpy(ctx->path, path);
+    strcpy(ctx->name, name);
+    return ++ctx->count % ctx->page_size == 0;
+}
+
+// Lookups, path prefixes and paginated listing with many stores
+void test_store_list_pages(void) {
+    store_list_t list = { 0 };
+    char name[STORE_MAX_NAME+1];
+    char path[STORE_MAX_PATH+1];
+
+    for (int i = 0; i < 300; i++) {
+        snprintf(name, sizeof(name), "pass%d", i);
+        snprintf(path, sizeof(path), i % 3 ? "pass/%d" : "pass", i % 7);
+        TEST_ASSERT_EQUAL_INT(STORE_OK, add_store(name, path, &list, new_memory_store(1)));
+    }
+    TEST_ASSERT_EQUAL_INT(STORE_OK, add_store("other", "passes", &list, new_memory_store(1)));
+    TEST_ASSERT_EQUAL_INT(STORE_ALREADY_EXISTS, add_store("pass3", "pass", &list, NULL));
+
+    TEST_ASSERT_NOT_NULL(find_store("pass3", "pass", &list));
+    TEST_ASSERT_NULL(find_store("pass3", "pass/3", &list));
+    TEST_ASSERT_EQUAL_INT(STORE_OK, remove_store("pass4", "pass/4", &list));
+    TEST_ASSERT_NULL(find_store("pass4", "pass/4", &list));
+
+    // Pages of 64 continue where the previous one stopped, and "passes" is not in "pass"
+    struct page_ctx ctx = { .page_size = 64 };
+    int pages = 0;
+    do {
+        int count = ctx.count;
+        iterate_store_list_after("pass", ctx.path, ctx.name, &list, page_test_callback, &ctx);
+        pages++;
+        if (ctx.count - count < ctx.page_size) {
+            break;
+        }
+    } while (true);
+    TEST_ASSERT_EQUAL_INT(299, ctx.count);
+    TEST_ASSERT_EQUAL_INT(5, pages);
+
+    free_store_list(&list);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_crc32_array);
+    RUN_TEST(test_crc32_implementations);
     RUN_TEST(test_block_size);
     RUN_TEST(test_new_memory_store);
     RUN_TEST(test_memory_store_io);
     RUN_TEST(test_new_file_store);
     RUN_TEST(test_file_store_io);
+    RUN_TEST(test_mmap_store_io);
+    RUN_TEST(test_direct_store_io);
+    RUN_TEST(test_store_batched_io);
+    RUN_TEST(test_file_store_uring_io);
+    RUN_TEST(test_file_store_uring_chunks);
+    RUN_TEST(test_file_store_superblock);
+    RUN_TEST(test_file_store_concurrent_io);
+    RUN_TEST(test_store_find_time);
+    RUN_TEST(test_store_query_blocks);
+    RUN_TEST(test_block_stats_implementations);
+    RUN_TEST(test_store_block_stats);
+    RUN_TEST(test_block_codec);
+    RUN_TEST(test_codec_unpack_implementations);
+    RUN_TEST(test_store_compression);
+    RUN_TEST(test_large_blocks);
+    RUN_TEST(test_memory_store_placement);
+    RUN_TEST(test_memory_store_snapshot);
+    RUN_TEST(test_tiered_store);
+    RUN_TEST(test_striped_store);
+    RUN_TEST(test_store_snapshot);
+    RUN_TEST(test_store_verify_crc);
+    RUN_TEST(test_store_durability);
 
     // Store list
     RUN_TEST(test_store_list);
+    RUN_TEST(test_store_list_pages);
 
     return UNITY_END();
 }
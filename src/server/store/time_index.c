@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <eyeq/server/store.h>
+
+#include "time_index.h"
+#include "stats.h"
+
+#define TIME_INDEX_MAGIC 0x54514559 // "EYQT"
+#define TIME_INDEX_VERSION 3
+#define TIME_INDEX_SUFFIX ".tidx"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+} time_index_header_t;
+
+size_t time_index_data_length(uint32_t count) {
+    return (size_t)count * (sizeof(uint64_t) + sizeof(uint32_t) + sizeof(float) + sizeof(block_stats_t) +
+                            2 * sizeof(uint16_t));
+}
+
+// Columns of the widest type first, so each is aligned
+static void time_index_columns(time_index_t *index, void *data) {
+    index->times = (uint64_t *)data;
+    index->sample_rates = (uint32_t *)(index->times + index->count);
+    index->center_frequencies = (float *)(index->sample_rates + index->count);
+    index->stats = (block_stats_t *)(index->center_frequencies + index->count);
+    index->source_ids = (uint16_t *)(index->stats + index->count);
+    index->block_types = index->source_ids + index->count;
+}
+
+static bool map_time_index(time_index_t *index, const char *filepath, bool initialize) {
+    char path[STORE_MAX_PATH + sizeof(TIME_INDEX_SUFFIX)];
+    snprintf(path, sizeof(path), "%s%s", filepath, TIME_INDEX_SUFFIX);
+
+    int fd = open(path, O_RDWR | O_CREAT | (initialize ? O_TRUNC : 0), 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    size_t length = sizeof(time_index_header_t) + time_index_data_length(index->count);
+
+    struct stat sb;
+    if (fstat(fd, &sb)) {
+        close(fd);
+        return false;
+    }
+    bool fresh = (size_t)sb.st_size != length;
+    if (fresh && ftruncate(fd, length)) {
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+
+    time_index_header_t *hdr = (time_index_header_t *)map;
+    if (fresh || hdr->magic != TIME_INDEX_MAGIC || hdr->version != TIME_INDEX_VERSION || hdr->count != index->count) {
+        memset(map, 0, length);
+        hdr->magic = TIME_INDEX_MAGIC;
+        hdr->version = TIME_INDEX_VERSION;
+        hdr->count = index->count;
+        index->rebuild = !initialize;
+    }
+
+    index->fd = fd;
+    index->map = map;
+    index->length = length;
+    time_index_columns(index, hdr + 1);
+
+    return true;
+}
+
+time_index_t* new_time_index(const char *filepath, uint32_t count, bool initialize) {
+    time_index_t *index = calloc(1, sizeof(time_index_t));
+    if (!index) {
+        return NULL;
+    }
+
+    index->count = count;
+    index->fd = -1;
+
+    if (filepath && map_time_index(index, filepath, initialize)) {
+        return index;
+    }
+
+    if (filepath) {
+        fprintf(stderr, "Could not open time index of %s, keeping it in memory.\n", filepath);
+        index->rebuild = !initialize;
+    }
+
+    void *data = calloc(1, time_index_data_length(count));
+    if (!data) {
+        free(index);
+        return NULL;
+    }
+    time_index_columns(index, data);
+
+    return index;
+}
+
+void free_time_index(time_index_t *index) {
+    if (!index) {
+        return;
+    }
+
+    if (index->map) {
+        munmap(index->map, index->length);
+        close(index->fd);
+    } else {
+        free(index->times);
+    }
+    free(index);
+}
+
+void time_index_set(time_index_t *index, uint32_t position, const block_t *block) {
+    if (!block) {
+        index->times[position] = 0;
+        index->sample_rates[position] = 0;
+        index->center_frequencies[position] = 0;
+        memset(&index->stats[position], 0, sizeof(block_stats_t));
+        index->source_ids[position] = 0;
+        index->block_types[position] = 0;
+        return;
+    }
+
+    index->times[position] = (uint64_t)block->hdr.timestamp_sec * 1000000000 + block->hdr.timestamp_nsec;
+    index->sample_rates[position] = block->hdr.sample_block_header.sample_rate;
+    index->center_frequencies[position] = block->hdr.sample_block_header.center_frequency;
+    block_compute_stats(block, &index->stats[position]);
+    index->source_ids[position] = block->hdr.source_id;
+    index->block_types[position] = block->hdr.block_type;
+}
+
+void time_index_copy(time_index_t *to, uint32_t to_position, const time_index_t *from, uint32_t from_position) {
+    to->times[to_position] = from->times[from_position];
+    to->sample_rates[to_position] = from->sample_rates[from_position];
+    to->center_frequencies[to_position] = from->center_frequencies[from_position];
+    to->stats[to_position] = from->stats[from_position];
+    to->source_ids[to_position] = from->source_ids[from_position];
+    to->block_types[to_position] = from->block_types[from_position];
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <eyeq/block.h>
+#include <eyeq/server/store.h>
+
+// Block header fields and sample summaries, one column per field with an entry per position
+// in the store ring. Times are in nanoseconds, so a time can be mapped to a block with a
+// binary search, and blocks can be looked up by source, type, frequency or power without
+// reading them. File backed stores keep it in a <store file>.tidx file next to the store.
+typedef struct time_index_s {
+    uint64_t *times;
+    uint32_t *sample_rates;
+    float *center_frequencies;
+    block_stats_t *stats;
+    uint16_t *source_ids;
+    uint16_t *block_types;
+    uint32_t count;
+
+    // Mapped index file, or -1 if the index only lives in memory
+    int fd;
+    void *map;
+    size_t length;
+
+    // Set when the index did not exist or did not match the store, and has to be rebuilt
+    // from the block headers.
+    bool rebuild;
+} time_index_t;
+
+// Opens (or creates) the index of a store with count blocks. If filepath is NULL or the
+// index file cannot be used, the index is kept in memory only.
+time_index_t* new_time_index(const char *filepath, uint32_t count, bool initialize);
+void free_time_index(time_index_t *index);
+
+// Bytes taken by the columns of an index of count blocks. They are contiguous from times on.
+size_t time_index_data_length(uint32_t count);
+
+// Indexes the header and samples of block at position, or clears the position if block is NULL
+void time_index_set(time_index_t *index, uint32_t position, const block_t *block);
+void time_index_copy(time_index_t *to, uint32_t to_position, const time_index_t *from, uint32_t from_position);
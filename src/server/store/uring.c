@@ -0,0 +1,250 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include <eyeq/server/store.h>
+
+#include "uring.h"
+#include "../util.h"
+
+static int io_uring_setup(uint32_t entries, struct io_uring_params *p) {
+    return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int io_uring_enter(int fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags) {
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+uring_t* new_uring(uint32_t depth) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+
+    int fd = io_uring_setup(depth, &p);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    uring_t *ring = calloc(1, sizeof(uring_t));
+    if (!ring) {
+        close(fd);
+        return NULL;
+    }
+
+    ring->fd = fd;
+    ring->depth = p.sq_entries;
+    ring->sq_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+    ring->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+
+    // Newer kernels map both rings with a single mmap
+    bool single_mmap = p.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        ring->sq_size = ring->cq_size = max(ring->sq_size, ring->cq_size);
+    }
+
+    ring->sq_ptr = mmap(NULL, ring->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ptr == MAP_FAILED) {
+        close(fd);
+        free(ring);
+        return NULL;
+    }
+
+    ring->cq_ptr = single_mmap ? ring->sq_ptr :
+        mmap(NULL, ring->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ring->cq_ptr == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        if (ring->sqes != MAP_FAILED) {
+            munmap(ring->sqes, ring->sqes_size);
+        }
+        if (!single_mmap && ring->cq_ptr != MAP_FAILED) {
+            munmap(ring->cq_ptr, ring->cq_size);
+        }
+        munmap(ring->sq_ptr, ring->sq_size);
+        close(fd);
+        free(ring);
+        return NULL;
+    }
+
+    uint8_t *sq = ring->sq_ptr;
+    ring->sq_head = (uint32_t *)(sq + p.sq_off.head);
+    ring->sq_tail = (uint32_t *)(sq + p.sq_off.tail);
+    ring->sq_mask = (uint32_t *)(sq + p.sq_off.ring_mask);
+    ring->sq_array = (uint32_t *)(sq + p.sq_off.array);
+
+    uint8_t *cq = ring->cq_ptr;
+    ring->cq_head = (uint32_t *)(cq + p.cq_off.head);
+    ring->cq_tail = (uint32_t *)(cq + p.cq_off.tail);
+    ring->cq_mask = (uint32_t *)(cq + p.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+    pthread_mutex_init(&ring->lock, NULL);
+
+    return ring;
+}
+
+void free_uring(uring_t *ring) {
+    if (!ring) {
+        return;
+    }
+
+    munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ptr != ring->sq_ptr) {
+        munmap(ring->cq_ptr, ring->cq_size);
+    }
+    munmap(ring->sq_ptr, ring->sq_size);
+    close(ring->fd);
+    pthread_mutex_destroy(&ring->lock);
+    free(ring);
+}
+
+// Finishes an I/O that completed short, synchronously. Reads stop at the end of the file
+// and leave the rest of the buffers zeroed.
+static bool finish_short_io(const uring_io_t *io, bool write, size_t done) {
+    off_t position = io->position;
+    bool eof = false;
+
+    for (int i = 0; i < io->iovcnt; i++) {
+        uint8_t *ptr = io->iov[i].iov_base;
+        size_t length = io->iov[i].iov_len;
+        size_t skip = min(done, length);
+        done -= skip;
+
+        for (size_t at = skip; at < length;) {
+            ssize_t ret = eof ? 0 : write ? pwrite(io->fd, ptr + at, length - at, position + at)
+                                          : pread(io->fd, ptr + at, length - at, position + at);
+            if (ret < 0 || (write && ret == 0)) {
+                return false;
+            }
+            if (ret == 0) {
+                memset(ptr + at, 0, length - at);
+                eof = true;
+                break;
+            }
+            at += ret;
+        }
+        position += length;
+    }
+
+    return true;
+}
+
+static size_t io_length(const uring_io_t *io) {
+    size_t length = 0;
+    for (int i = 0; i < io->iovcnt; i++) {
+        length += io->iov[i].iov_len;
+    }
+    return length;
+}
+
+int uring_run(uring_t *ring, bool write, const uring_io_t *ios, uint32_t count) {
+    uint32_t submitted = 0;
+    uint32_t completed = 0;
+    uint32_t unsubmitted = 0;
+    bool failed = false;
+
+    pthread_mutex_lock(&ring->lock);
+
+    while (completed < submitted || (!failed && submitted < count)) {
+        // Queue I/Os until the ring is full
+        uint32_t tail = *ring->sq_tail;
+        uint32_t mask = *ring->sq_mask;
+        while (!failed && submitted < count && submitted - completed < ring->depth) {
+            const uring_io_t *io = &ios[submitted];
+            uint32_t index = tail & mask;
+            struct io_uring_sqe *sqe = &ring->sqes[index];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = write ? IORING_OP_WRITEV : IORING_OP_READV;
+            sqe->fd = io->fd;
+            sqe->addr = (uintptr_t)io->iov;
+            sqe->len = io->iovcnt;
+            sqe->off = io->position;
+            sqe->user_data = submitted;
+            ring->sq_array[index] = index;
+            tail++;
+            submitted++;
+            unsubmitted++;
+        }
+        __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+
+        int ret = io_uring_enter(ring->fd, unsubmitted, 1, IORING_ENTER_GETEVENTS);
+        if (ret < 0) {
+            if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                continue;
+            }
+            perror("io_uring_enter");
+            if (failed && !unsubmitted) {
+                // Cannot even wait for the I/Os in flight anymore
+                break;
+            }
+            // The kernel took none of the queued I/Os, take them back and only wait for
+            // the ones already in flight.
+            failed = true;
+            __atomic_store_n(ring->sq_tail, tail - unsubmitted, __ATOMIC_RELEASE);
+            submitted -= unsubmitted;
+            unsubmitted = 0;
+            continue;
+        }
+        unsubmitted -= ret;
+
+        // Reap completions
+        uint32_t head = *ring->cq_head;
+        while (head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+            struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+            const uring_io_t *io = &ios[cqe->user_data];
+            if (cqe->res < 0) {
+                failed = true;
+            } else if ((size_t)cqe->res < io_length(io) && !finish_short_io(io, write, cqe->res)) {
+                failed = true;
+            }
+            head++;
+            completed++;
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    pthread_mutex_unlock(&ring->lock);
+
+    if (failed) {
+        return write ? STORE_WRITE_ERROR : STORE_READ_ERROR;
+    }
+
+    return STORE_OK;
+}
+
+// A run of consecutive blocks of one file, in I/Os of up to URING_CHUNK_LENGTH bytes
+static int uring_run_chunks(uring_t *ring, bool write, int fd, uint8_t *buffer, uint32_t block_size, off_t position,
+                            uint32_t count) {
+    uint32_t chunk_blocks = max(URING_CHUNK_LENGTH / block_size, 1u);
+    uint32_t chunks = (count + chunk_blocks - 1) / chunk_blocks;
+
+    uring_io_t *ios = malloc(chunks * (sizeof(uring_io_t) + sizeof(struct iovec)));
+    if (!ios) {
+        return STORE_OUT_OF_MEMORY;
+    }
+    struct iovec *iov = (struct iovec *)(ios + chunks);
+
+    for (uint32_t i = 0; i < chunks; i++) {
+        uint32_t first = i * chunk_blocks;
+        size_t offset = (size_t)first * block_size;
+        iov[i] = (struct iovec){ buffer + offset, (size_t)min(chunk_blocks, count - first) * block_size };
+        ios[i] = (uring_io_t){ .fd = fd, .position = position + (off_t)offset, .iov = &iov[i], .iovcnt = 1 };
+    }
+
+    int ret = uring_run(ring, write, ios, chunks);
+    free(ios);
+
+    return ret;
+}
+
+int uring_read_blocks(uring_t *ring, int fd, block_t *output, uint32_t block_size, off_t position, uint32_t count) {
+    return uring_run_chunks(ring, false, fd, (uint8_t *)output, block_size, position, count);
+}
+
+int uring_write_blocks(uring_t *ring, int fd, const block_t *input, uint32_t block_size, off_t position, uint32_t count) {
+    return uring_run_chunks(ring, true, fd, (uint8_t *)input, block_size, position, count);
+}
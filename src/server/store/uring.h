@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <eyeq/block.h>
+
+// Minimal io_uring wrapper used by the file backed stores, so independent runs of blocks
+// can be read or written with several I/Os in flight at once.
+typedef struct {
+    int fd;
+    uint32_t depth;
+
+    // Submission queue
+    uint32_t *sq_head;
+    uint32_t *sq_tail;
+    uint32_t *sq_mask;
+    uint32_t *sq_array;
+    struct io_uring_sqe *sqes;
+
+    // Completion queue
+    uint32_t *cq_head;
+    uint32_t *cq_tail;
+    uint32_t *cq_mask;
+    struct io_uring_cqe *cqes;
+
+    void *sq_ptr;
+    size_t sq_size;
+    void *cq_ptr;
+    size_t cq_size;
+    size_t sqes_size;
+
+    // One run at a time uses the ring
+    pthread_mutex_t lock;
+} uring_t;
+
+// Returns NULL if the kernel does not support io_uring.
+uring_t* new_uring(uint32_t depth);
+void free_uring(uring_t *ring);
+
+// Largest I/O a run of consecutive blocks is split into. Long runs still get several I/Os
+// in flight, short ones cost a single request like a pread.
+#define URING_CHUNK_LENGTH (256 * 1024)
+
+// Reads or writes count blocks of block_size bytes at position, in I/Os of up to
+// URING_CHUNK_LENGTH bytes. Reads past the end of the file return zeros.
+int uring_read_blocks(uring_t *ring, int fd, block_t *output, uint32_t block_size, off_t position, uint32_t count);
+int uring_write_blocks(uring_t *ring, int fd, const block_t *input, uint32_t block_size, off_t position, uint32_t count);
+
+// One I/O: iovcnt buffers read or written one after the other at position of fd
+typedef struct {
+    int fd;
+    off_t position;
+    struct iovec *iov;
+    int iovcnt;
+} uring_io_t;
+
+// Reads or writes count independent I/Os, possibly in different files, keeping up to depth
+// of them in flight.
+int uring_run(uring_t *ring, bool write, const uring_io_t *ios, uint32_t count);
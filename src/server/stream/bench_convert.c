@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <eyeq/block.h>
+
+#include "convert.h"
+
+// Converts the samples of store blocks of every type to float with every kernel the CPU
+// supports, and with the per-sample loop the store reader used before them.
+//
+// usage: eyeq-convert-bench [block_count]
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// The type is switched on for every sample
+static void convert_loop(uint16_t block_type, const void *payload, float *output, int count, float scale) {
+    for (int i = 0; i < count; i++) {
+        switch (block_type) {
+        case BLOCK_TYPE_I8_SAMPLES:
+            output[i] = ((const int8_t *)payload)[i] * scale;
+            break;
+        case BLOCK_TYPE_I16_SAMPLES:
+            output[i] = ((const int16_t *)payload)[i] * scale;
+            break;
+        case BLOCK_TYPE_I32_SAMPLES:
+            output[i] = ((const int32_t *)payload)[i] * scale;
+            break;
+        case BLOCK_TYPE_F32_SAMPLES:
+            output[i] = ((const float *)payload)[i] * scale;
+            break;
+        case BLOCK_TYPE_F64_SAMPLES:
+            output[i] = ((const double *)payload)[i] * scale;
+            break;
+        default:
+            output[i] = 0;
+            break;
+        }
+    }
+}
+
+// Keeps the converted samples live
+static volatile float sink;
+
+static void report(const char *name, uint32_t block_count, double elapsed, int count) {
+    printf("  %-8s %10.0f blocks/s %8.1f Msamples/s\n", name, block_count / elapsed,
+           (double)block_count * count / elapsed / 1e6);
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t block_count = argc > 1 ? strtoul(argv[1], NULL, 10) : 16384;
+
+    static const char *type_names[] = { NULL, "i8", "i16", "i32", "f32", "f64" };
+
+    uint8_t *payload = malloc(SAMPLE_DATA_PER_BLOCK);
+    float *output = malloc(SAMPLE_DATA_PER_BLOCK * sizeof(float));
+    if (!payload || !output) {
+        return 1;
+    }
+
+    const convert_implementation_t *implementations;
+    int count = convert_implementations(&implementations);
+
+    for (uint16_t type = BLOCK_TYPE_I8_SAMPLES; type <= BLOCK_TYPE_F64_SAMPLES; type++) {
+        int samples = SAMPLE_DATA_PER_BLOCK / convert_sample_size(type);
+
+        // Random values in range for every type
+        srand(1);
+        for (int i = 0; i < samples; i++) {
+            int value = (rand() % 256) - 128;
+            switch (type) {
+            case BLOCK_TYPE_I8_SAMPLES:  ((int8_t *)payload)[i] = value; break;
+            case BLOCK_TYPE_I16_SAMPLES: ((int16_t *)payload)[i] = value * 256; break;
+            case BLOCK_TYPE_I32_SAMPLES: ((int32_t *)payload)[i] = value * 65536; break;
+            case BLOCK_TYPE_F32_SAMPLES: ((float *)payload)[i] = value / 128.0f; break;
+            case BLOCK_TYPE_F64_SAMPLES: ((double *)payload)[i] = value / 128.0; break;
+            }
+        }
+
+        printf("%u blocks of %d %s samples\n", block_count, samples, type_names[type]);
+
+        double start = now();
+        for (uint32_t b = 0; b < block_count; b++) {
+            convert_loop(type, payload, output, samples, 0.5f);
+        }
+        sink = output[samples - 1];
+        report("loop", block_count, now() - start, samples);
+
+        for (int i = 0; i < count; i++) {
+            start = now();
+            for (uint32_t b = 0; b < block_count; b++) {
+                implementations[i].convert[type](payload, output, samples, 0.5f);
+            }
+            sink = output[samples - 1];
+            report(implementations[i].name, block_count, now() - start, samples);
+        }
+    }
+
+    free(payload);
+    free(output);
+
+    return 0;
+}
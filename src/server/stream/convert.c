@@ -0,0 +1,336 @@
+#include <pthread.h>
+
+#include "convert.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CONVERT_X86
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define CONVERT_NEON
+#endif
+
+// Samples are converted to float before they are scaled, so every kernel rounds the same way
+#define CONVERT_SCALAR(name, type)                                                         \
+static void name(const void *input, float *output, size_t count, float scale) {            \
+    const type *x = input;                                                                 \
+    for (size_t n = 0; n < count; n++) {                                                   \
+        output[n] = (float)x[n] * scale;                                                   \
+    }                                                                                      \
+}
+
+CONVERT_SCALAR(convert_scalar_i8, int8_t)
+CONVERT_SCALAR(convert_scalar_i16, int16_t)
+CONVERT_SCALAR(convert_scalar_i32, int32_t)
+CONVERT_SCALAR(convert_scalar_f32, float)
+CONVERT_SCALAR(convert_scalar_f64, double)
+
+#ifdef CONVERT_X86
+// Sign extends 8 16 bit samples with unpacks and shifts, SSE2 has no pmovsx
+__attribute__((target("sse2")))
+static inline void convert_sse2_store_i16(float *output, __m128i x, __m128 scale) {
+    __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+    __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+    _mm_storeu_ps(output, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+    _mm_storeu_ps(output + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+}
+
+__attribute__((target("sse2")))
+static void convert_sse2_i8(const void *input, float *output, size_t count, float scale) {
+    const int8_t *x = input;
+    const __m128 s = _mm_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(x + n));
+        convert_sse2_store_i16(output + n, _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8), s);
+        convert_sse2_store_i16(output + n + 8, _mm_srai_epi16(_mm_unpackhi_epi8(v, v), 8), s);
+    }
+    convert_scalar_i8(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("sse2")))
+static void convert_sse2_i16(const void *input, float *output, size_t count, float scale) {
+    const int16_t *x = input;
+    const __m128 s = _mm_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        convert_sse2_store_i16(output + n, _mm_loadu_si128((const __m128i *)(x + n)), s);
+    }
+    convert_scalar_i16(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("sse2")))
+static void convert_sse2_i32(const void *input, float *output, size_t count, float scale) {
+    const int32_t *x = input;
+    const __m128 s = _mm_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        __m128 v = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(x + n)));
+        _mm_storeu_ps(output + n, _mm_mul_ps(v, s));
+    }
+    convert_scalar_i32(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("sse2")))
+static void convert_sse2_f32(const void *input, float *output, size_t count, float scale) {
+    const float *x = input;
+    const __m128 s = _mm_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        _mm_storeu_ps(output + n, _mm_mul_ps(_mm_loadu_ps(x + n), s));
+    }
+    convert_scalar_f32(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("sse2")))
+static void convert_sse2_f64(const void *input, float *output, size_t count, float scale) {
+    const double *x = input;
+    const __m128 s = _mm_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        __m128 low = _mm_cvtpd_ps(_mm_loadu_pd(x + n));
+        __m128 high = _mm_cvtpd_ps(_mm_loadu_pd(x + n + 2));
+        _mm_storeu_ps(output + n, _mm_mul_ps(_mm_movelh_ps(low, high), s));
+    }
+    convert_scalar_f64(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx2")))
+static void convert_avx2_i8(const void *input, float *output, size_t count, float scale) {
+    const int8_t *x = input;
+    const __m256 s = _mm256_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(x + n));
+        __m256i low = _mm256_cvtepi8_epi32(v);
+        __m256i high = _mm256_cvtepi8_epi32(_mm_unpackhi_epi64(v, v));
+        _mm256_storeu_ps(output + n, _mm256_mul_ps(_mm256_cvtepi32_ps(low), s));
+        _mm256_storeu_ps(output + n + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(high), s));
+    }
+    convert_scalar_i8(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx2")))
+static void convert_avx2_i16(const void *input, float *output, size_t count, float scale) {
+    const int16_t *x = input;
+    const __m256 s = _mm256_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m256i low = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(x + n)));
+        __m256i high = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(x + n + 8)));
+        _mm256_storeu_ps(output + n, _mm256_mul_ps(_mm256_cvtepi32_ps(low), s));
+        _mm256_storeu_ps(output + n + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(high), s));
+    }
+    convert_scalar_i16(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx2")))
+static void convert_avx2_i32(const void *input, float *output, size_t count, float scale) {
+    const int32_t *x = input;
+    const __m256 s = _mm256_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        __m256 v = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(x + n)));
+        _mm256_storeu_ps(output + n, _mm256_mul_ps(v, s));
+    }
+    convert_scalar_i32(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx2")))
+static void convert_avx2_f32(const void *input, float *output, size_t count, float scale) {
+    const float *x = input;
+    const __m256 s = _mm256_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        _mm256_storeu_ps(output + n, _mm256_mul_ps(_mm256_loadu_ps(x + n), s));
+    }
+    convert_scalar_f32(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx2")))
+static void convert_avx2_f64(const void *input, float *output, size_t count, float scale) {
+    const double *x = input;
+    const __m256 s = _mm256_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        __m128 low = _mm256_cvtpd_ps(_mm256_loadu_pd(x + n));
+        __m128 high = _mm256_cvtpd_ps(_mm256_loadu_pd(x + n + 4));
+        __m256 v = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+        _mm256_storeu_ps(output + n, _mm256_mul_ps(v, s));
+    }
+    convert_scalar_f64(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx512f")))
+static void convert_avx512_i8(const void *input, float *output, size_t count, float scale) {
+    const int8_t *x = input;
+    const __m512 s = _mm512_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m512i v = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(x + n)));
+        _mm512_storeu_ps(output + n, _mm512_mul_ps(_mm512_cvtepi32_ps(v), s));
+    }
+    convert_scalar_i8(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx512f")))
+static void convert_avx512_i16(const void *input, float *output, size_t count, float scale) {
+    const int16_t *x = input;
+    const __m512 s = _mm512_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m512i v = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(x + n)));
+        _mm512_storeu_ps(output + n, _mm512_mul_ps(_mm512_cvtepi32_ps(v), s));
+    }
+    convert_scalar_i16(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx512f")))
+static void convert_avx512_i32(const void *input, float *output, size_t count, float scale) {
+    const int32_t *x = input;
+    const __m512 s = _mm512_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m512 v = _mm512_cvtepi32_ps(_mm512_loadu_si512(x + n));
+        _mm512_storeu_ps(output + n, _mm512_mul_ps(v, s));
+    }
+    convert_scalar_i32(x + n, output + n, count - n, scale);
+}
+
+__attribute__((target("avx512f")))
+static void convert_avx512_f32(const void *input, float *output, size_t count, float scale) {
+    const float *x = input;
+    const __m512 s = _mm512_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        _mm512_storeu_ps(output + n, _mm512_mul_ps(_mm512_loadu_ps(x + n), s));
+    }
+    convert_scalar_f32(x + n, output + n, count - n, scale);
+}
+
+// Without AVX512DQ the two halves are scaled and stored separately
+__attribute__((target("avx512f")))
+static void convert_avx512_f64(const void *input, float *output, size_t count, float scale) {
+    const double *x = input;
+    const __m256 s = _mm256_set1_ps(scale);
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        __m256 low = _mm512_cvtpd_ps(_mm512_loadu_pd(x + n));
+        __m256 high = _mm512_cvtpd_ps(_mm512_loadu_pd(x + n + 8));
+        _mm256_storeu_ps(output + n, _mm256_mul_ps(low, s));
+        _mm256_storeu_ps(output + n + 8, _mm256_mul_ps(high, s));
+    }
+    convert_scalar_f64(x + n, output + n, count - n, scale);
+}
+#endif
+
+#ifdef CONVERT_NEON
+static inline void convert_neon_store_i16(float *output, int16x8_t x, float scale) {
+    vst1q_f32(output, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), scale));
+    vst1q_f32(output + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_high_s16(x)), scale));
+}
+
+static void convert_neon_i8(const void *input, float *output, size_t count, float scale) {
+    const int8_t *x = input;
+    size_t n = 0;
+    for (; n + 16 <= count; n += 16) {
+        int8x16_t v = vld1q_s8(x + n);
+        convert_neon_store_i16(output + n, vmovl_s8(vget_low_s8(v)), scale);
+        convert_neon_store_i16(output + n + 8, vmovl_high_s8(v), scale);
+    }
+    convert_scalar_i8(x + n, output + n, count - n, scale);
+}
+
+static void convert_neon_i16(const void *input, float *output, size_t count, float scale) {
+    const int16_t *x = input;
+    size_t n = 0;
+    for (; n + 8 <= count; n += 8) {
+        convert_neon_store_i16(output + n, vld1q_s16(x + n), scale);
+    }
+    convert_scalar_i16(x + n, output + n, count - n, scale);
+}
+
+static void convert_neon_i32(const void *input, float *output, size_t count, float scale) {
+    const int32_t *x = input;
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        vst1q_f32(output + n, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(x + n)), scale));
+    }
+    convert_scalar_i32(x + n, output + n, count - n, scale);
+}
+
+static void convert_neon_f32(const void *input, float *output, size_t count, float scale) {
+    const float *x = input;
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        vst1q_f32(output + n, vmulq_n_f32(vld1q_f32(x + n), scale));
+    }
+    convert_scalar_f32(x + n, output + n, count - n, scale);
+}
+
+static void convert_neon_f64(const void *input, float *output, size_t count, float scale) {
+    const double *x = input;
+    size_t n = 0;
+    for (; n + 4 <= count; n += 4) {
+        float32x2_t low = vcvt_f32_f64(vld1q_f64(x + n));
+        float32x4_t v = vcvt_high_f32_f64(low, vld1q_f64(x + n + 2));
+        vst1q_f32(output + n, vmulq_n_f32(v, scale));
+    }
+    convert_scalar_f64(x + n, output + n, count - n, scale);
+}
+#endif
+
+#define CONVERT_IMPLEMENTATION(name, prefix) \
+    (convert_implementation_t){ name, { NULL, prefix##_i8, prefix##_i16, prefix##_i32, prefix##_f32, prefix##_f64 } }
+
+static convert_implementation_t convert_supported[4];
+static int convert_supported_count;
+static pthread_once_t convert_once = PTHREAD_ONCE_INIT;
+
+static void convert_init(void) {
+    convert_supported[convert_supported_count++] = CONVERT_IMPLEMENTATION("scalar", convert_scalar);
+#ifdef CONVERT_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) {
+        convert_supported[convert_supported_count++] = CONVERT_IMPLEMENTATION("sse2", convert_sse2);
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        convert_supported[convert_supported_count++] = CONVERT_IMPLEMENTATION("avx2", convert_avx2);
+    }
+    if (__builtin_cpu_supports("avx512f")) {
+        convert_supported[convert_supported_count++] = CONVERT_IMPLEMENTATION("avx512", convert_avx512);
+    }
+#endif
+#ifdef CONVERT_NEON
+    // Advanced SIMD is part of every ARMv8-A CPU
+    convert_supported[convert_supported_count++] = CONVERT_IMPLEMENTATION("neon", convert_neon);
+#endif
+}
+
+int convert_implementations(const convert_implementation_t **implementations) {
+    pthread_once(&convert_once, convert_init);
+    *implementations = convert_supported;
+    return convert_supported_count;
+}
+
+convert_function convert_samples_function(uint16_t block_type) {
+    if (block_type > BLOCK_TYPE_F64_SAMPLES) {
+        return NULL;
+    }
+    pthread_once(&convert_once, convert_init);
+    return convert_supported[convert_supported_count - 1].convert[block_type];
+}
+
+int convert_sample_size(uint16_t block_type) {
+    switch (block_type) {
+    case BLOCK_TYPE_I16_SAMPLES:
+        return 2;
+    case BLOCK_TYPE_I32_SAMPLES:
+    case BLOCK_TYPE_F32_SAMPLES:
+        return 4;
+    case BLOCK_TYPE_F64_SAMPLES:
+        return 8;
+    default:
+        return 1;
+    }
+}
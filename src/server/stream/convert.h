@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <eyeq/block.h>
+
+// Converts count samples to float and multiplies them by scale
+typedef void (*convert_function)(const void *input, float *output, size_t count, float scale);
+
+typedef struct {
+    const char *name;
+    // Indexed by block type, NULL for BLOCK_TYPE_BYTES
+    convert_function convert[BLOCK_TYPE_F64_SAMPLES + 1];
+} convert_implementation_t;
+
+// Returns the conversion kernels this CPU supports, slowest first. All of them give the same
+// result, convert_samples_function uses the last one.
+int convert_implementations(const convert_implementation_t **implementations);
+
+// Returns the fastest kernel for the samples of block_type, or NULL if it has no samples
+convert_function convert_samples_function(uint16_t block_type);
+
+// Size in bytes of one sample of block_type, 1 for types without samples
+int convert_sample_size(uint16_t block_type);
@@ -0,0 +1,276 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "fft.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FFT_AVX2
+#endif
+
+#define FFT_MAX_LOG2 20
+
+struct fft_plan {
+    int n;
+    // exp(-2 pi j k / (2 * half)) for k < half, for every butterfly stage. The stage with
+    // butterflies half points apart starts at half - 1, so each is contiguous.
+    float *twiddles_re;
+    float *twiddles_im;
+};
+
+static fft_plan_t *fft_plans[FFT_MAX_LOG2 + 1];
+static pthread_mutex_t fft_plans_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool fft_use_avx2;
+static pthread_once_t fft_once = PTHREAD_ONCE_INIT;
+
+static void fft_init(void) {
+#ifdef FFT_AVX2
+    __builtin_cpu_init();
+    fft_use_avx2 = __builtin_cpu_supports("avx2");
+#endif
+}
+
+static fft_plan_t *fft_new_plan(int n) {
+    fft_plan_t *plan = (fft_plan_t *)calloc(1, sizeof(fft_plan_t));
+    if (!plan) {
+        return NULL;
+    }
+
+    plan->n = n;
+    plan->twiddles_re = (float *)malloc(n * sizeof(float));
+    plan->twiddles_im = (float *)malloc(n * sizeof(float));
+    if (!plan->twiddles_re || !plan->twiddles_im) {
+        free(plan->twiddles_re);
+        free(plan->twiddles_im);
+        free(plan);
+        return NULL;
+    }
+
+    for (int half = 1; half < n; half *= 2) {
+        for (int k = 0; k < half; k++) {
+            double angle = -M_PI * k / half;
+            plan->twiddles_re[half - 1 + k] = cos(angle);
+            plan->twiddles_im[half - 1 + k] = sin(angle);
+        }
+    }
+
+    return plan;
+}
+
+const fft_plan_t *fft_plan(int n) {
+    if (n < 1 || n > FFT_MAX_SIZE || (n & (n - 1))) {
+        return NULL;
+    }
+
+    pthread_once(&fft_once, fft_init);
+
+    int log2n = __builtin_ctz(n);
+    pthread_mutex_lock(&fft_plans_lock);
+    if (!fft_plans[log2n]) {
+        fft_plans[log2n] = fft_new_plan(n);
+    }
+    const fft_plan_t *plan = fft_plans[log2n];
+    pthread_mutex_unlock(&fft_plans_lock);
+
+    return plan;
+}
+
+int fft_size(const fft_plan_t *plan) {
+    return plan->n;
+}
+
+/*
+ * One stage of butterflies, a = x[k] and b = x[k + half] for k < half in every group of
+ * 2 * half points. Decimation in frequency (forward) sets a + b and (a - b) * w, decimation
+ * in time (inverse) a + b * w' and a - b * w' with the conjugated twiddle w'.
+ */
+typedef void (*fft_stage_function)(float *re, float *im, int n, int half, const float *wr, const float *wi);
+
+static void fft_dif_scalar(float *re, float *im, int n, int half, const float *wr, const float *wi) {
+    for (int start = 0; start < n; start += 2 * half) {
+        float *ar = re + start, *ai = im + start, *br = ar + half, *bi = ai + half;
+        for (int k = 0; k < half; k++) {
+            float dr = ar[k] - br[k], di = ai[k] - bi[k];
+            ar[k] += br[k];
+            ai[k] += bi[k];
+            br[k] = dr * wr[k] - di * wi[k];
+            bi[k] = dr * wi[k] + di * wr[k];
+        }
+    }
+}
+
+static void fft_dit_scalar(float *re, float *im, int n, int half, const float *wr, const float *wi) {
+    for (int start = 0; start < n; start += 2 * half) {
+        float *ar = re + start, *ai = im + start, *br = ar + half, *bi = ai + half;
+        for (int k = 0; k < half; k++) {
+            float tr = br[k] * wr[k] + bi[k] * wi[k];
+            float ti = bi[k] * wr[k] - br[k] * wi[k];
+            br[k] = ar[k] - tr;
+            bi[k] = ai[k] - ti;
+            ar[k] += tr;
+            ai[k] += ti;
+        }
+    }
+}
+
+// The twiddle of the last stage of the forward and the first of the inverse transform is 1
+static void fft_stage_1(float *re, float *im, int n, int half, const float *wr, const float *wi) {
+    for (int k = 0; k < n; k += 2) {
+        float dr = re[k] - re[k + 1], di = im[k] - im[k + 1];
+        re[k] += re[k + 1];
+        im[k] += im[k + 1];
+        re[k + 1] = dr;
+        im[k + 1] = di;
+    }
+}
+
+#ifdef FFT_AVX2
+// Eight butterflies at a time, for groups of at least eight
+__attribute__((target("avx2")))
+static void fft_dif_avx2(float *re, float *im, int n, int half, const float *wr, const float *wi) {
+    for (int start = 0; start < n; start += 2 * half) {
+        float *ar = re + start, *ai = im + start, *br = ar + half, *bi = ai + half;
+        for (int k = 0; k < half; k += 8) {
+            __m256 xr = _mm256_loadu_ps(ar + k), xi = _mm256_loadu_ps(ai + k);
+            __m256 yr = _mm256_loadu_ps(br + k), yi = _mm256_loadu_ps(bi + k);
+            __m256 twr = _mm256_loadu_ps(wr + k), twi = _mm256_loadu_ps(wi + k);
+            __m256 dr = _mm256_sub_ps(xr, yr), di = _mm256_sub_ps(xi, yi);
+            _mm256_storeu_ps(ar + k, _mm256_add_ps(xr, yr));
+            _mm256_storeu_ps(ai + k, _mm256_add_ps(xi, yi));
+            _mm256_storeu_ps(br + k, _mm256_sub_ps(_mm256_mul_ps(dr, twr), _mm256_mul_ps(di, twi)));
+            _mm256_storeu_ps(bi + k, _mm256_add_ps(_mm256_mul_ps(dr, twi), _mm256_mul_ps(di, twr)));
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static void fft_dit_avx2(float *re, float *im, int n, int half, const float *wr, const float *wi) {
+    for (int start = 0; start < n; start += 2 * half) {
+        float *ar = re + start, *ai = im + start, *br = ar + half, *bi = ai + half;
+        for (int k = 0; k < half; k += 8) {
+            __m256 xr = _mm256_loadu_ps(ar + k), xi = _mm256_loadu_ps(ai + k);
+            __m256 yr = _mm256_loadu_ps(br + k), yi = _mm256_loadu_ps(bi + k);
+            __m256 twr = _mm256_loadu_ps(wr + k), twi = _mm256_loadu_ps(wi + k);
+            __m256 tr = _mm256_add_ps(_mm256_mul_ps(yr, twr), _mm256_mul_ps(yi, twi));
+            __m256 ti = _mm256_sub_ps(_mm256_mul_ps(yi, twr), _mm256_mul_ps(yr, twi));
+            _mm256_storeu_ps(br + k, _mm256_sub_ps(xr, tr));
+            _mm256_storeu_ps(bi + k, _mm256_sub_ps(xi, ti));
+            _mm256_storeu_ps(ar + k, _mm256_add_ps(xr, tr));
+            _mm256_storeu_ps(ai + k, _mm256_add_ps(xi, ti));
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static inline void fft_avx2_cmul(__m256 *xr, __m256 *xi, __m256 wr, __m256 wi) {
+    __m256 r = _mm256_sub_ps(_mm256_mul_ps(*xr, wr), _mm256_mul_ps(*xi, wi));
+    *xi = _mm256_add_ps(_mm256_mul_ps(*xr, wi), _mm256_mul_ps(*xi, wr));
+    *xr = r;
+}
+
+/*
+ * The stages with half of 4, 2 and 1 in one pass, eight points at a time in registers. The
+ * b points come from swapping the halves, pairs or neighbours of a register, and the results
+ * are blended back; the twiddles of the a points are 1.
+ */
+#define FFT_SQRT1_2 0.70710678118654752f
+
+__attribute__((target("avx2")))
+static void fft_dif_avx2_last(float *re, float *im, int n) {
+    const float h = FFT_SQRT1_2;
+    const __m256 w4r = _mm256_setr_ps(1, 1, 1, 1, 1, h, 0, -h);
+    const __m256 w4i = _mm256_setr_ps(0, 0, 0, 0, 0, -h, -1, -h);
+    const __m256 w2r = _mm256_setr_ps(1, 1, 1, 0, 1, 1, 1, 0);
+    const __m256 w2i = _mm256_setr_ps(0, 0, 0, -1, 0, 0, 0, -1);
+    for (int k = 0; k < n; k += 8) {
+        __m256 xr = _mm256_loadu_ps(re + k), xi = _mm256_loadu_ps(im + k);
+        __m256 sr = _mm256_permute2f128_ps(xr, xr, 1), si = _mm256_permute2f128_ps(xi, xi, 1);
+        xr = _mm256_blend_ps(_mm256_add_ps(xr, sr), _mm256_sub_ps(sr, xr), 0xf0);
+        xi = _mm256_blend_ps(_mm256_add_ps(xi, si), _mm256_sub_ps(si, xi), 0xf0);
+        fft_avx2_cmul(&xr, &xi, w4r, w4i);
+
+        sr = _mm256_permute_ps(xr, 0x4e), si = _mm256_permute_ps(xi, 0x4e);
+        xr = _mm256_blend_ps(_mm256_add_ps(xr, sr), _mm256_sub_ps(sr, xr), 0xcc);
+        xi = _mm256_blend_ps(_mm256_add_ps(xi, si), _mm256_sub_ps(si, xi), 0xcc);
+        fft_avx2_cmul(&xr, &xi, w2r, w2i);
+
+        sr = _mm256_permute_ps(xr, 0xb1), si = _mm256_permute_ps(xi, 0xb1);
+        xr = _mm256_blend_ps(_mm256_add_ps(xr, sr), _mm256_sub_ps(sr, xr), 0xaa);
+        xi = _mm256_blend_ps(_mm256_add_ps(xi, si), _mm256_sub_ps(si, xi), 0xaa);
+        _mm256_storeu_ps(re + k, xr);
+        _mm256_storeu_ps(im + k, xi);
+    }
+}
+
+__attribute__((target("avx2")))
+static void fft_dit_avx2_first(float *re, float *im, int n) {
+    const float h = FFT_SQRT1_2;
+    const __m256 w2r = _mm256_setr_ps(1, 1, 1, 0, 1, 1, 1, 0);
+    const __m256 w2i = _mm256_setr_ps(0, 0, 0, 1, 0, 0, 0, 1);
+    const __m256 w4r = _mm256_setr_ps(1, 1, 1, 1, 1, h, 0, -h);
+    const __m256 w4i = _mm256_setr_ps(0, 0, 0, 0, 0, h, 1, h);
+    for (int k = 0; k < n; k += 8) {
+        __m256 xr = _mm256_loadu_ps(re + k), xi = _mm256_loadu_ps(im + k);
+        __m256 sr = _mm256_permute_ps(xr, 0xb1), si = _mm256_permute_ps(xi, 0xb1);
+        xr = _mm256_blend_ps(_mm256_add_ps(xr, sr), _mm256_sub_ps(sr, xr), 0xaa);
+        xi = _mm256_blend_ps(_mm256_add_ps(xi, si), _mm256_sub_ps(si, xi), 0xaa);
+
+        fft_avx2_cmul(&xr, &xi, w2r, w2i);
+        sr = _mm256_permute_ps(xr, 0x4e), si = _mm256_permute_ps(xi, 0x4e);
+        xr = _mm256_blend_ps(_mm256_add_ps(xr, sr), _mm256_sub_ps(sr, xr), 0xcc);
+        xi = _mm256_blend_ps(_mm256_add_ps(xi, si), _mm256_sub_ps(si, xi), 0xcc);
+
+        fft_avx2_cmul(&xr, &xi, w4r, w4i);
+        sr = _mm256_permute2f128_ps(xr, xr, 1), si = _mm256_permute2f128_ps(xi, xi, 1);
+        xr = _mm256_blend_ps(_mm256_add_ps(xr, sr), _mm256_sub_ps(sr, xr), 0xf0);
+        xi = _mm256_blend_ps(_mm256_add_ps(xi, si), _mm256_sub_ps(si, xi), 0xf0);
+        _mm256_storeu_ps(re + k, xr);
+        _mm256_storeu_ps(im + k, xi);
+    }
+}
+#endif
+
+static void fft_stage(const fft_plan_t *plan, float *re, float *im, int half, bool inverse) {
+    fft_stage_function stage = inverse ? fft_dit_scalar : fft_dif_scalar;
+    if (half == 1) {
+        stage = fft_stage_1;
+    }
+#ifdef FFT_AVX2
+    if (fft_use_avx2 && half >= 8) {
+        stage = inverse ? fft_dit_avx2 : fft_dif_avx2;
+    }
+#endif
+    stage(re, im, plan->n, half, &plan->twiddles_re[half - 1], &plan->twiddles_im[half - 1]);
+}
+
+void fft_forward(const fft_plan_t *plan, float *re, float *im) {
+    int half = plan->n / 2;
+    for (; half >= 8; half /= 2) {
+        fft_stage(plan, re, im, half, false);
+    }
+#ifdef FFT_AVX2
+    if (fft_use_avx2 && plan->n >= 8) {
+        fft_dif_avx2_last(re, im, plan->n);
+        return;
+    }
+#endif
+    for (; half >= 1; half /= 2) {
+        fft_stage(plan, re, im, half, false);
+    }
+}
+
+void fft_inverse(const fft_plan_t *plan, float *re, float *im) {
+    int half = 1;
+#ifdef FFT_AVX2
+    if (fft_use_avx2 && plan->n >= 8) {
+        fft_dit_avx2_first(re, im, plan->n);
+        half = 8;
+    }
+#endif
+    for (; half < plan->n; half *= 2) {
+        fft_stage(plan, re, im, half, true);
+    }
+}
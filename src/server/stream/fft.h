@@ -0,0 +1,21 @@
+#pragma once
+
+typedef struct fft_plan fft_plan_t;
+
+// Largest transform, in complex points
+#define FFT_MAX_SIZE (1 << 20)
+
+// Returns the plan for transforms of n complex points, n a power of two up to FFT_MAX_SIZE,
+// or NULL. Plans are made once and shared by every stream, and never freed.
+const fft_plan_t *fft_plan(int n);
+
+int fft_size(const fft_plan_t *plan);
+
+/*
+ * In-place transforms of n points, with the real and imaginary parts in separate arrays.
+ * The forward transform leaves its output in bit reversed order, which the inverse takes as
+ * input, so neither has to reorder: this suits convolution, where spectra are only
+ * multiplied point by point. The inverse is not scaled by 1/n.
+ */
+void fft_forward(const fft_plan_t *plan, float *re, float *im);
+void fft_inverse(const fft_plan_t *plan, float *re, float *im);
@@ -0,0 +1,334 @@
+#include <pthread.h>
+
+#include "fir.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FIR_AVX2
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define FIR_NEON
+#endif
+
+static void fir_scalar_real(const float *input, int stride, const float *taps, int ntaps,
+                            float *output, int count) {
+    for (int f = 0; f < count; f++) {
+        const float *x = input + f;
+        float sum = 0;
+        for (int i = 0; i < ntaps; i++) {
+            sum += x[stride * i] * taps[i];
+        }
+        output[f] = sum;
+    }
+}
+
+static void fir_scalar_complex(const float *input, const float *taps_re, const float *taps_im,
+                               int ntaps, float *output, int count) {
+    for (int f = 0; f + 2 <= count; f += 2) {
+        const float *x = input + f;
+        float re = 0, im = 0;
+        for (int i = 0; i < ntaps; i++) {
+            re += x[2 * i] * taps_re[i] - x[2 * i + 1] * taps_im[i];
+            im += x[2 * i] * taps_im[i] + x[2 * i + 1] * taps_re[i];
+        }
+        output[f] = re;
+        output[f + 1] = im;
+    }
+}
+
+static void fir_scalar_dot(const float *input, const float *taps, int n, float sums[2]) {
+    float even = 0, odd = 0;
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        even += input[i] * taps[i];
+        odd += input[i + 1] * taps[i + 1];
+    }
+    if (i < n) {
+        even += input[i] * taps[i];
+    }
+    sums[0] = even;
+    sums[1] = odd;
+}
+
+static void fir_scalar_complex_dot(const float *input, const float *taps, int ntaps, float output[2]) {
+    float re = 0, im = 0;
+    for (int i = 0; i < 2 * ntaps; i += 2) {
+        re += input[i] * taps[i] - input[i + 1] * taps[i + 1];
+        im += input[i] * taps[i + 1] + input[i + 1] * taps[i];
+    }
+    output[0] = re;
+    output[1] = im;
+}
+
+/*
+ * Outputs are computed 32 floats at a time, in four accumulators that each tap is broadcast
+ * into, so every tap is loaded once per 32 outputs and the input windows of neighbouring
+ * outputs share their loads. For complex taps the input is also swapped to (im, re) pairs
+ * and multiplied by (-im, im) of the tap. Products are rounded and summed in tap order like
+ * the scalar kernel, without fused multiply-adds, so both give the same result: the outputs
+ * of long filters can be far smaller than the products summed into them.
+ */
+#ifdef FIR_AVX2
+__attribute__((target("avx2")))
+static void fir_avx2_real(const float *input, int stride, const float *taps, int ntaps,
+                          float *output, int count) {
+    int f = 0;
+    for (; f + 32 <= count; f += 32) {
+        __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+        __m256 a2 = _mm256_setzero_ps(), a3 = _mm256_setzero_ps();
+        const float *x = input + f;
+        for (int i = 0; i < ntaps; i++, x += stride) {
+            __m256 t = _mm256_broadcast_ss(&taps[i]);
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(x), t));
+            a1 = _mm256_add_ps(a1, _mm256_mul_ps(_mm256_loadu_ps(x + 8), t));
+            a2 = _mm256_add_ps(a2, _mm256_mul_ps(_mm256_loadu_ps(x + 16), t));
+            a3 = _mm256_add_ps(a3, _mm256_mul_ps(_mm256_loadu_ps(x + 24), t));
+        }
+        _mm256_storeu_ps(output + f, a0);
+        _mm256_storeu_ps(output + f + 8, a1);
+        _mm256_storeu_ps(output + f + 16, a2);
+        _mm256_storeu_ps(output + f + 24, a3);
+    }
+    for (; f + 8 <= count; f += 8) {
+        __m256 a = _mm256_setzero_ps();
+        const float *x = input + f;
+        for (int i = 0; i < ntaps; i++, x += stride) {
+            a = _mm256_add_ps(a, _mm256_mul_ps(_mm256_loadu_ps(x), _mm256_broadcast_ss(&taps[i])));
+        }
+        _mm256_storeu_ps(output + f, a);
+    }
+    fir_scalar_real(input + f, stride, taps, ntaps, output + f, count - f);
+}
+
+// x * (re + j im) added to acc, for the four complex samples in x
+__attribute__((target("avx2")))
+static inline __m256 fir_avx2_cmac(__m256 acc, __m256 x, __m256 re, __m256 im) {
+    __m256 product = _mm256_add_ps(_mm256_mul_ps(x, re), _mm256_mul_ps(_mm256_permute_ps(x, 0xb1), im));
+    return _mm256_add_ps(acc, product);
+}
+
+__attribute__((target("avx2")))
+static void fir_avx2_complex(const float *input, const float *taps_re, const float *taps_im,
+                             int ntaps, float *output, int count) {
+    const __m256 sign = _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+    int f = 0;
+    for (; f + 32 <= count; f += 32) {
+        __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+        __m256 a2 = _mm256_setzero_ps(), a3 = _mm256_setzero_ps();
+        const float *x = input + f;
+        for (int i = 0; i < ntaps; i++, x += 2) {
+            __m256 re = _mm256_broadcast_ss(&taps_re[i]);
+            __m256 im = _mm256_xor_ps(_mm256_broadcast_ss(&taps_im[i]), sign);
+            a0 = fir_avx2_cmac(a0, _mm256_loadu_ps(x), re, im);
+            a1 = fir_avx2_cmac(a1, _mm256_loadu_ps(x + 8), re, im);
+            a2 = fir_avx2_cmac(a2, _mm256_loadu_ps(x + 16), re, im);
+            a3 = fir_avx2_cmac(a3, _mm256_loadu_ps(x + 24), re, im);
+        }
+        _mm256_storeu_ps(output + f, a0);
+        _mm256_storeu_ps(output + f + 8, a1);
+        _mm256_storeu_ps(output + f + 16, a2);
+        _mm256_storeu_ps(output + f + 24, a3);
+    }
+    for (; f + 8 <= count; f += 8) {
+        __m256 a = _mm256_setzero_ps();
+        const float *x = input + f;
+        for (int i = 0; i < ntaps; i++, x += 2) {
+            __m256 im = _mm256_xor_ps(_mm256_broadcast_ss(&taps_im[i]), sign);
+            a = fir_avx2_cmac(a, _mm256_loadu_ps(x), _mm256_broadcast_ss(&taps_re[i]), im);
+        }
+        _mm256_storeu_ps(output + f, a);
+    }
+    fir_scalar_complex(input + f, taps_re, taps_im, ntaps, output + f, count - f);
+}
+
+// Adds the even and the odd lanes of a into sums
+__attribute__((target("avx2")))
+static inline void fir_avx2_add_lanes(__m256 a, float sums[2]) {
+    __m128 h = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+    sums[0] += _mm_cvtss_f32(h);
+    sums[1] += _mm_cvtss_f32(_mm_shuffle_ps(h, h, 1));
+}
+
+__attribute__((target("avx2")))
+static void fir_avx2_dot(const float *input, const float *taps, int n, float sums[2]) {
+    __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+    __m256 a2 = _mm256_setzero_ps(), a3 = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(input + i), _mm256_loadu_ps(taps + i)));
+        a1 = _mm256_add_ps(a1, _mm256_mul_ps(_mm256_loadu_ps(input + i + 8), _mm256_loadu_ps(taps + i + 8)));
+        a2 = _mm256_add_ps(a2, _mm256_mul_ps(_mm256_loadu_ps(input + i + 16), _mm256_loadu_ps(taps + i + 16)));
+        a3 = _mm256_add_ps(a3, _mm256_mul_ps(_mm256_loadu_ps(input + i + 24), _mm256_loadu_ps(taps + i + 24)));
+    }
+    for (; i + 8 <= n; i += 8) {
+        a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(input + i), _mm256_loadu_ps(taps + i)));
+    }
+    // The tail is summed here rather than by the scalar kernel: calling non-AVX code with the
+    // upper halves of the registers in use costs more than short dot products themselves
+    sums[0] = sums[1] = 0;
+    for (; i < n; i++) {
+        sums[i & 1] += input[i] * taps[i];
+    }
+    fir_avx2_add_lanes(_mm256_add_ps(_mm256_add_ps(a0, a1), _mm256_add_ps(a2, a3)), sums);
+}
+
+// The products with the input as is give the real part, even lanes minus odd ones, and with
+// the input swapped to (im, re) pairs the imaginary part, even lanes plus odd ones
+__attribute__((target("avx2")))
+static void fir_avx2_complex_dot(const float *input, const float *taps, int ntaps, float output[2]) {
+    __m256 a0 = _mm256_setzero_ps(), a1 = _mm256_setzero_ps();
+    __m256 b0 = _mm256_setzero_ps(), b1 = _mm256_setzero_ps();
+    int i = 0, n = 2 * ntaps;
+    for (; i + 16 <= n; i += 16) {
+        __m256 x0 = _mm256_loadu_ps(input + i), t0 = _mm256_loadu_ps(taps + i);
+        __m256 x1 = _mm256_loadu_ps(input + i + 8), t1 = _mm256_loadu_ps(taps + i + 8);
+        a0 = _mm256_add_ps(a0, _mm256_mul_ps(x0, t0));
+        a1 = _mm256_add_ps(a1, _mm256_mul_ps(x1, t1));
+        b0 = _mm256_add_ps(b0, _mm256_mul_ps(_mm256_permute_ps(x0, 0xb1), t0));
+        b1 = _mm256_add_ps(b1, _mm256_mul_ps(_mm256_permute_ps(x1, 0xb1), t1));
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(input + i), t = _mm256_loadu_ps(taps + i);
+        a0 = _mm256_add_ps(a0, _mm256_mul_ps(x, t));
+        b0 = _mm256_add_ps(b0, _mm256_mul_ps(_mm256_permute_ps(x, 0xb1), t));
+    }
+    float re[2] = { 0, 0 }, im[2] = { 0, 0 };
+    for (; i < n; i += 2) {
+        re[0] += input[i] * taps[i];
+        re[1] += input[i + 1] * taps[i + 1];
+        im[0] += input[i + 1] * taps[i];
+        im[1] += input[i] * taps[i + 1];
+    }
+    fir_avx2_add_lanes(_mm256_add_ps(a0, a1), re);
+    fir_avx2_add_lanes(_mm256_add_ps(b0, b1), im);
+    output[0] = re[0] - re[1];
+    output[1] = im[0] + im[1];
+}
+#endif
+
+#ifdef FIR_NEON
+static void fir_neon_real(const float *input, int stride, const float *taps, int ntaps,
+                          float *output, int count) {
+    int f = 0;
+    for (; f + 16 <= count; f += 16) {
+        float32x4_t a0 = vdupq_n_f32(0), a1 = vdupq_n_f32(0);
+        float32x4_t a2 = vdupq_n_f32(0), a3 = vdupq_n_f32(0);
+        const float *x = input + f;
+        for (int i = 0; i < ntaps; i++, x += stride) {
+            a0 = vaddq_f32(a0, vmulq_n_f32(vld1q_f32(x), taps[i]));
+            a1 = vaddq_f32(a1, vmulq_n_f32(vld1q_f32(x + 4), taps[i]));
+            a2 = vaddq_f32(a2, vmulq_n_f32(vld1q_f32(x + 8), taps[i]));
+            a3 = vaddq_f32(a3, vmulq_n_f32(vld1q_f32(x + 12), taps[i]));
+        }
+        vst1q_f32(output + f, a0);
+        vst1q_f32(output + f + 4, a1);
+        vst1q_f32(output + f + 8, a2);
+        vst1q_f32(output + f + 12, a3);
+    }
+    fir_scalar_real(input + f, stride, taps, ntaps, output + f, count - f);
+}
+
+static inline float32x4_t fir_neon_cmac(float32x4_t acc, float32x4_t x, float re, float32x4_t im) {
+    float32x4_t product = vaddq_f32(vmulq_n_f32(x, re), vmulq_f32(vrev64q_f32(x), im));
+    return vaddq_f32(acc, product);
+}
+
+static void fir_neon_complex(const float *input, const float *taps_re, const float *taps_im,
+                             int ntaps, float *output, int count) {
+    static const float sign[4] = { -1.0f, 1.0f, -1.0f, 1.0f };
+    const float32x4_t s = vld1q_f32(sign);
+    int f = 0;
+    for (; f + 16 <= count; f += 16) {
+        float32x4_t a0 = vdupq_n_f32(0), a1 = vdupq_n_f32(0);
+        float32x4_t a2 = vdupq_n_f32(0), a3 = vdupq_n_f32(0);
+        const float *x = input + f;
+        for (int i = 0; i < ntaps; i++, x += 2) {
+            float32x4_t im = vmulq_n_f32(s, taps_im[i]);
+            a0 = fir_neon_cmac(a0, vld1q_f32(x), taps_re[i], im);
+            a1 = fir_neon_cmac(a1, vld1q_f32(x + 4), taps_re[i], im);
+            a2 = fir_neon_cmac(a2, vld1q_f32(x + 8), taps_re[i], im);
+            a3 = fir_neon_cmac(a3, vld1q_f32(x + 12), taps_re[i], im);
+        }
+        vst1q_f32(output + f, a0);
+        vst1q_f32(output + f + 4, a1);
+        vst1q_f32(output + f + 8, a2);
+        vst1q_f32(output + f + 12, a3);
+    }
+    fir_scalar_complex(input + f, taps_re, taps_im, ntaps, output + f, count - f);
+}
+
+static inline void fir_neon_add_lanes(float32x4_t a, float sums[2]) {
+    float32x2_t h = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+    sums[0] += vget_lane_f32(h, 0);
+    sums[1] += vget_lane_f32(h, 1);
+}
+
+static void fir_neon_dot(const float *input, const float *taps, int n, float sums[2]) {
+    float32x4_t a0 = vdupq_n_f32(0), a1 = vdupq_n_f32(0);
+    float32x4_t a2 = vdupq_n_f32(0), a3 = vdupq_n_f32(0);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        a0 = vaddq_f32(a0, vmulq_f32(vld1q_f32(input + i), vld1q_f32(taps + i)));
+        a1 = vaddq_f32(a1, vmulq_f32(vld1q_f32(input + i + 4), vld1q_f32(taps + i + 4)));
+        a2 = vaddq_f32(a2, vmulq_f32(vld1q_f32(input + i + 8), vld1q_f32(taps + i + 8)));
+        a3 = vaddq_f32(a3, vmulq_f32(vld1q_f32(input + i + 12), vld1q_f32(taps + i + 12)));
+    }
+    fir_scalar_dot(input + i, taps + i, n - i, sums);
+    fir_neon_add_lanes(vaddq_f32(vaddq_f32(a0, a1), vaddq_f32(a2, a3)), sums);
+}
+
+static void fir_neon_complex_dot(const float *input, const float *taps, int ntaps, float output[2]) {
+    float32x4_t a0 = vdupq_n_f32(0), a1 = vdupq_n_f32(0);
+    float32x4_t b0 = vdupq_n_f32(0), b1 = vdupq_n_f32(0);
+    int i = 0, n = 2 * ntaps;
+    for (; i + 8 <= n; i += 8) {
+        float32x4_t x0 = vld1q_f32(input + i), t0 = vld1q_f32(taps + i);
+        float32x4_t x1 = vld1q_f32(input + i + 4), t1 = vld1q_f32(taps + i + 4);
+        a0 = vaddq_f32(a0, vmulq_f32(x0, t0));
+        a1 = vaddq_f32(a1, vmulq_f32(x1, t1));
+        b0 = vaddq_f32(b0, vmulq_f32(vrev64q_f32(x0), t0));
+        b1 = vaddq_f32(b1, vmulq_f32(vrev64q_f32(x1), t1));
+    }
+    fir_scalar_complex_dot(input + i, taps + i, (n - i) / 2, output);
+    float re[2] = { 0, 0 }, im[2] = { 0, 0 };
+    fir_neon_add_lanes(vaddq_f32(a0, a1), re);
+    fir_neon_add_lanes(vaddq_f32(b0, b1), im);
+    output[0] += re[0] - re[1];
+    output[1] += im[0] + im[1];
+}
+#endif
+
+static fir_implementation_t fir_supported[2];
+static int fir_supported_count;
+static pthread_once_t fir_once = PTHREAD_ONCE_INIT;
+
+static void fir_init(void) {
+    fir_supported[fir_supported_count++] = (fir_implementation_t){
+        "scalar", fir_scalar_real, fir_scalar_complex, fir_scalar_dot, fir_scalar_complex_dot
+    };
+#ifdef FIR_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        fir_supported[fir_supported_count++] = (fir_implementation_t){
+            "avx2", fir_avx2_real, fir_avx2_complex, fir_avx2_dot, fir_avx2_complex_dot
+        };
+    }
+#endif
+#ifdef FIR_NEON
+    fir_supported[fir_supported_count++] = (fir_implementation_t){
+        "neon", fir_neon_real, fir_neon_complex, fir_neon_dot, fir_neon_complex_dot
+    };
+#endif
+}
+
+int fir_implementations(const fir_implementation_t **implementations) {
+    pthread_once(&fir_once, fir_init);
+    *implementations = fir_supported;
+    return fir_supported_count;
+}
+
+const fir_implementation_t *fir_best_implementation(void) {
+    pthread_once(&fir_once, fir_init);
+    return &fir_supported[fir_supported_count - 1];
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+/*
+ * FIR kernels computing count output floats at once. Taps are reversed, so output float f is
+ * the dot product of the taps with the input window starting at float f.
+ */
+
+// Real taps: output[f] = sum input[f + stride * i] * taps[i]. A stride of 2 filters
+// interleaved I/Q samples, with half the multiplies of complex taps.
+typedef void (*fir_real_function)(const float *input, int stride, const float *taps, int ntaps,
+                                  float *output, int count);
+
+// Complex taps split into real and imaginary parts, over interleaved I/Q input and output.
+// count is in floats and even.
+typedef void (*fir_complex_function)(const float *input, const float *taps_re, const float *taps_im,
+                                     int ntaps, float *output, int count);
+
+/*
+ * Single outputs, for polyphase filters that skip the outputs they drop. Sums the products of
+ * the n floats of input and taps, those of even and odd floats separately: the real and
+ * imaginary parts for I/Q input and real taps stored twice each.
+ */
+typedef void (*fir_dot_function)(const float *input, const float *taps, int n, float sums[2]);
+
+// The complex product of ntaps interleaved I/Q input samples and complex taps
+typedef void (*fir_complex_dot_function)(const float *input, const float *taps, int ntaps, float output[2]);
+
+typedef struct {
+    const char *name;
+    fir_real_function real_taps;
+    fir_complex_function complex_taps;
+    fir_dot_function real_dot;
+    fir_complex_dot_function complex_dot;
+} fir_implementation_t;
+
+// Returns the FIR kernels this CPU supports, slowest first. fir_best_implementation returns
+// the last one.
+int fir_implementations(const fir_implementation_t **implementations);
+
+const fir_implementation_t *fir_best_implementation(void);
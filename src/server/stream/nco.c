@@ -0,0 +1,133 @@
+#include <math.h>
+#include <pthread.h>
+
+#include "nco.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NCO_AVX2
+#endif
+
+// The top bits of a phase index the table, the rest are a rotation below one table step
+#define NCO_TABLE_BITS 10
+#define NCO_FRACTION_BITS (32 - NCO_TABLE_BITS)
+#define NCO_FRACTION_MASK ((1u << NCO_FRACTION_BITS) - 1)
+// Radians per unit of phase
+#define NCO_RADIANS (2 * M_PI / 4294967296.0)
+
+static float nco_cos[1 << NCO_TABLE_BITS];
+static float nco_sin[1 << NCO_TABLE_BITS];
+
+uint32_t nco_phase(double cycles) {
+    double fraction = cycles - floor(cycles);
+    return (uint32_t)(uint64_t)llround(fraction * 4294967296.0);
+}
+
+/*
+ * exp(2 pi j phase): the table entry rotated by the rest of the phase. That angle is below
+ * 2 pi / 1024, where two terms of the series of its cosine and sine are exact to float
+ * precision.
+ */
+static inline void nco_phasor(uint32_t phase, float *re, float *im) {
+    uint32_t i = phase >> NCO_FRACTION_BITS;
+    float x = (float)(phase & NCO_FRACTION_MASK) * (float)NCO_RADIANS;
+    float x2 = x * x;
+    float c = 1 - x2 * 0.5f;
+    float s = x - x * x2 * (1.0f / 6);
+    *re = nco_cos[i] * c - nco_sin[i] * s;
+    *im = nco_cos[i] * s + nco_sin[i] * c;
+}
+
+static void nco_scalar(uint32_t phase, uint32_t step, float *samples, int count) {
+    for (int i = 0; i + 2 <= count; i += 2, phase += step) {
+        float re, im;
+        nco_phasor(phase, &re, &im);
+        float xr = samples[i], xi = samples[i + 1];
+        samples[i] = xr * re - xi * im;
+        samples[i + 1] = xr * im + xi * re;
+    }
+}
+
+#ifdef NCO_AVX2
+// x * r for the four interleaved complex samples of each
+__attribute__((target("avx2")))
+static inline __m256 nco_avx2_cmul(__m256 x, __m256 r) {
+    return _mm256_addsub_ps(_mm256_mul_ps(x, _mm256_moveldup_ps(r)),
+                            _mm256_mul_ps(_mm256_permute_ps(x, 0xb1), _mm256_movehdup_ps(r)));
+}
+
+// Eight phases at a time, their table entries gathered
+__attribute__((target("avx2")))
+static void nco_avx2(uint32_t phase, uint32_t step, float *samples, int count) {
+    __m256i phases = _mm256_add_epi32(_mm256_set1_epi32(phase),
+        _mm256_mullo_epi32(_mm256_set1_epi32(step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+    const __m256i advance = _mm256_set1_epi32(step * 8);
+    const __m256i mask = _mm256_set1_epi32(NCO_FRACTION_MASK);
+    const __m256 radians = _mm256_set1_ps((float)NCO_RADIANS);
+    const __m256 one = _mm256_set1_ps(1.0f), half = _mm256_set1_ps(0.5f), sixth = _mm256_set1_ps(1.0f / 6);
+
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i index = _mm256_srli_epi32(phases, NCO_FRACTION_BITS);
+        __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(phases, mask)), radians);
+        __m256 x2 = _mm256_mul_ps(x, x);
+        __m256 c = _mm256_sub_ps(one, _mm256_mul_ps(x2, half));
+        __m256 s = _mm256_sub_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, x2), sixth));
+        __m256 tc = _mm256_i32gather_ps(nco_cos, index, 4);
+        __m256 ts = _mm256_i32gather_ps(nco_sin, index, 4);
+        __m256 re = _mm256_sub_ps(_mm256_mul_ps(tc, c), _mm256_mul_ps(ts, s));
+        __m256 im = _mm256_add_ps(_mm256_mul_ps(tc, s), _mm256_mul_ps(ts, c));
+
+        // (re, im) pairs of samples 0-3 and 4-7
+        __m256 lo = _mm256_unpacklo_ps(re, im), hi = _mm256_unpackhi_ps(re, im);
+        __m256 r0 = _mm256_permute2f128_ps(lo, hi, 0x20);
+        __m256 r1 = _mm256_permute2f128_ps(lo, hi, 0x31);
+        _mm256_storeu_ps(samples + i, nco_avx2_cmul(_mm256_loadu_ps(samples + i), r0));
+        _mm256_storeu_ps(samples + i + 8, nco_avx2_cmul(_mm256_loadu_ps(samples + i + 8), r1));
+
+        phases = _mm256_add_epi32(phases, advance);
+    }
+
+    // The tail here rather than in nco_scalar, which would run with the vector registers
+    // in use
+    phase += step * (uint32_t)(i / 2);
+    for (; i + 2 <= count; i += 2, phase += step) {
+        float re, im;
+        nco_phasor(phase, &re, &im);
+        float xr = samples[i], xi = samples[i + 1];
+        samples[i] = xr * re - xi * im;
+        samples[i + 1] = xr * im + xi * re;
+    }
+}
+#endif
+
+static nco_implementation_t nco_supported[2];
+static int nco_supported_count;
+static pthread_once_t nco_once = PTHREAD_ONCE_INIT;
+
+static void nco_init(void) {
+    for (int i = 0; i < (1 << NCO_TABLE_BITS); i++) {
+        double angle = 2 * M_PI * i / (1 << NCO_TABLE_BITS);
+        nco_cos[i] = cos(angle);
+        nco_sin[i] = sin(angle);
+    }
+
+    nco_supported[nco_supported_count++] = (nco_implementation_t){ "scalar", nco_scalar };
+#ifdef NCO_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        nco_supported[nco_supported_count++] = (nco_implementation_t){ "avx2", nco_avx2 };
+    }
+#endif
+}
+
+int nco_implementations(const nco_implementation_t **implementations) {
+    pthread_once(&nco_once, nco_init);
+    *implementations = nco_supported;
+    return nco_supported_count;
+}
+
+nco_function nco_best_function(void) {
+    pthread_once(&nco_once, nco_init);
+    return nco_supported[nco_supported_count - 1].mix;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Numerically controlled oscillator. Phases are 32 bit fixed point fractions of a cycle,
+ * which wrap around exactly, so the phase of any sample is start + n * step however far
+ * the stream has come.
+ */
+
+// Fixed point phase of a number of cycles, or of a frequency in cycles per sample
+uint32_t nco_phase(double cycles);
+
+// Multiplies count floats of interleaved I/Q samples in place by exp(2 pi j phase), the
+// phase advancing by step every sample
+typedef void (*nco_function)(uint32_t phase, uint32_t step, float *samples, int count);
+
+typedef struct {
+    const char *name;
+    nco_function mix;
+} nco_implementation_t;
+
+// Returns the oscillators this CPU supports, slowest first. nco_best_function returns the
+// last one.
+int nco_implementations(const nco_implementation_t **implementations);
+
+nco_function nco_best_function(void);
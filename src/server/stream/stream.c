@@ -7,12 +7,21 @@
 #include <eyeq/server/store.h>
 #include <eyeq/server/stream.h>
 #include "../util.h"
+#include "../directory.h"
+#include "convert.h"
+#include "fir.h"
+#include "fft.h"
+#include "nco.h"
 
 #include <complex.h>
 typedef float complex complex_t;
 
 #define BUFFER_SIZE 2048
-#define READER_BUFFER_SIZE 32768
+// Filters with at least this many real taps are applied by FFT convolution instead of the
+// direct form. Complex taps cost twice as much in the direct form and count double.
+#define FFT_FIR_MIN_TAPS 96
+// Read ahead this many blocks of BLOCK_LENGTH bytes, fewer of larger blocks
+#define READER_READAHEAD_BLOCKS 16
 
 void read_samples_from_stream(stream_t *stream, float *output, int count) {
     int read = 0;
@@ -40,10 +49,18 @@ struct store_reader_stream {
 
     uint32_t current_block;
 
-    int buffer_offset;
-    int buffer_count;
+    // Block being read, mapped from the store or in the read-ahead buffer. Its samples are
+    // converted as they are read, so blocks of any size need no buffer of their own.
+    const block_t *block;
+    convert_function convert;
+    float scale;
+    int sample_offset;
+    int sample_count;
 
-    float buffer[READER_BUFFER_SIZE];
+    // Blocks read ahead from stores that cannot be mapped
+    block_t *readahead;
+    uint32_t readahead_start;
+    uint32_t readahead_count;
 
     store_t *store;
 };
@@ -57,6 +74,16 @@ struct sine_stream {
     float scale;
 };
 
+// Multiplies the parent by exp(2 pi j (phase + frequency * n)) at sample n
+struct frequency_translate_stream {
+    struct stream_base base;
+
+    stream_t *parent;
+    nco_function mix;
+    uint32_t phase;
+    uint32_t step;
+};
+
 struct stream_combiner {
     struct stream_base base;
 
@@ -77,11 +104,79 @@ struct fir_stream {
 
     stream_t *parent;
     bool is_complex;
+    // Complex streams whose taps are all real filter I and Q as two real streams
+    bool real_taps;
+    const fir_implementation_t *kernels;
     int64_t offset;
+    // Floats in the input window of one output
     int ntaps;
     int overlap;
     int data_offset;
     float buffer[BUFFER_SIZE];
+    // Reversed taps, complex ones as all the real parts followed by all the imaginary parts
+    float taps[];
+};
+
+/*
+ * Overlap-save convolution: every transform of n points takes the last ntaps - 1 input
+ * samples again followed by step new ones, and its last step points are outputs.
+ */
+struct fft_fir_stream {
+    struct stream_base base;
+
+    stream_t *parent;
+    bool is_complex;
+    bool parent_eos;
+    const fft_plan_t *plan;
+    int ntaps;
+    int step;
+
+    // Transform of the taps, scaled by 1/n for the inverse transform
+    float *spectrum_re;
+    float *spectrum_im;
+    // Input of the next transform, history first
+    float *input_re;
+    float *input_im;
+    // Transform, its outputs from ntaps - 1 on
+    float *work_re;
+    float *work_im;
+    // Samples read from the parent as they come, step of them
+    float *samples;
+
+    // Output floats of the current transform, and how many have been read
+    int output_count;
+    int output_offset;
+};
+
+/*
+ * Resampling by interpolation / decimation: the input upsampled by interpolation - 1 zeros
+ * after every sample, filtered, and every decimation-th output kept. Only the kept outputs
+ * are computed, each with the phase of the taps that meets the non-zero input samples.
+ */
+struct polyphase_fir_stream {
+    struct stream_base base;
+
+    stream_t *parent;
+    bool is_complex;
+    bool real_taps;
+    bool parent_eos;
+    const fir_implementation_t *kernels;
+    int interpolation;
+    int decimation;
+    // Taps of every phase, and floats per tap
+    int phase_taps;
+    int tap_width;
+
+    // Phase of the next output, and the buffer sample its input window ends at
+    int phase;
+    int position;
+    // Samples in the buffer, and room for them
+    int filled;
+    int capacity;
+    float *buffer;
+
+    // Reversed taps of every phase: real ones for real streams, for complex streams
+    // (re, re) pairs if the taps are real and (re, im) pairs if not
     float taps[];
 };
 
@@ -169,6 +264,11 @@ static void complex_multiply_stream_seek(stream_t *stream, uint32_t offset) {
     ss->base.eos = (!ss->parent1 || ss->parent1->eos || !ss->parent2 || ss->parent2->eos);
 }
 
+static bool complex_multiply_stream_find_time(stream_t *stream, uint64_t time_ns, uint32_t *offset) {
+    struct stream_combiner *ss = (struct stream_combiner *)stream;
+    return ss->parent1 && ss->parent1->find_time && ss->parent1->find_time(ss->parent1, time_ns, offset);
+}
+
 stream_t* new_complex_multiply_stream(stream_t *parent1, stream_t *parent2) {
     struct stream_combiner *ss = (struct stream_combiner *)calloc(1, sizeof(struct stream_combiner));
     if (!ss) {
@@ -178,24 +278,65 @@ stream_t* new_complex_multiply_stream(stream_t *parent1, stream_t *parent2) {
     ss->parent2 = parent2;
     ss->base.read = cc_mul;
     ss->base.seek = complex_multiply_stream_seek;
+    ss->base.find_time = complex_multiply_stream_find_time;
     ss->base.cleanup = complex_multiply_stream_cleanup;
 
     return (stream_t *)ss;
 }
 
-stream_t *new_frequency_translate_stream(stream_t *parent, double frequency) {
-    stream_t *sine_stream = new_complex_sine_stream(0.0, frequency, 1.0);
-    if (!sine_stream) {
+static int frequency_translate_stream_read(stream_t *stream, float *output, int count) {
+    struct frequency_translate_stream *fs = (struct frequency_translate_stream *)stream;
+
+    int read = fs->parent->read(fs->parent, output, count - count % 2);
+    if (read > 0) {
+        // The phase follows the sample offset, so it is the same after seeking back
+        uint32_t phase = fs->phase + fs->step * (uint32_t)(fs->base.offset / 2);
+        fs->mix(phase, fs->step, output, read);
+        fs->base.offset += read;
+    }
+    fs->base.eos = fs->parent->eos;
+
+    return read;
+}
+
+static void frequency_translate_stream_seek(stream_t *stream, uint32_t offset) {
+    struct frequency_translate_stream *fs = (struct frequency_translate_stream *)stream;
+    if (fs->parent->seek) {
+        fs->parent->seek(fs->parent, offset);
+    }
+    fs->base.offset = fs->parent->offset;
+    fs->base.eos = fs->parent->eos;
+}
+
+static bool frequency_translate_stream_find_time(stream_t *stream, uint64_t time_ns, uint32_t *offset) {
+    struct frequency_translate_stream *fs = (struct frequency_translate_stream *)stream;
+    return fs->parent->find_time && fs->parent->find_time(fs->parent, time_ns, offset);
+}
+
+static void frequency_translate_stream_cleanup(stream_t *stream) {
+    struct frequency_translate_stream *fs = (struct frequency_translate_stream *)stream;
+    free_stream(fs->parent);
+}
+
+stream_t *new_frequency_translate_stream(stream_t *parent, double frequency, double phase) {
+    if (!parent) {
         return NULL;
     }
 
-    stream_t *ss = new_complex_multiply_stream(parent, sine_stream);
-    if (!ss) {
-        free_stream(sine_stream);
+    struct frequency_translate_stream *fs = (struct frequency_translate_stream *)calloc(1, sizeof(struct frequency_translate_stream));
+    if (!fs) {
         return NULL;
     }
+    fs->parent = parent;
+    fs->mix = nco_best_function();
+    fs->phase = nco_phase(phase / (2 * M_PI));
+    fs->step = nco_phase(frequency);
+    fs->base.read = frequency_translate_stream_read;
+    fs->base.seek = frequency_translate_stream_seek;
+    fs->base.find_time = frequency_translate_stream_find_time;
+    fs->base.cleanup = frequency_translate_stream_cleanup;
 
-    return ss;
+    return (stream_t *)fs;
 }
 
 void free_stream(stream_t *stream) {
@@ -284,46 +425,6 @@ void fir_stream_shift_and_read(struct fir_stream *fs) {
     fs->offset = 0;
 }
 
-/*
-
-def fir_filter(self):
-    """Produce one output sample by filtering the current position in the input stream."""
-    if self.offset + len(self.taps) * 2 > len(self.buffer):
-        self.shift_and_read()
-    input_data = self.buffer[self.offset:self.offset+len(self.taps)*2].view(np.complex64)
-    self.offset += 2
-    return np.sum(np.multiply(input_data, self.taps))
-
-*/
-void fir_stream_fir_filter(struct fir_stream *fs, float *output) {
-    if (fs->offset + fs->ntaps > BUFFER_SIZE) {
-        fir_stream_shift_and_read(fs);
-    }
-
-    *output = 0;
-    for (int i = 0; i < fs->ntaps; i++) {
-        *output += fs->buffer[fs->offset+i] * fs->taps[fs->ntaps - i - 1];
-    }
-    fs->offset++;
-}
-
-void fir_stream_fir_filter_complex(struct fir_stream *fs, float *output) {
-    if (fs->offset + fs->ntaps > BUFFER_SIZE) {
-        fir_stream_shift_and_read(fs);
-    }
-
-    complex_t c_out = 0;
-    complex_t *d_in = ((complex_t *)&fs->buffer[fs->offset]);
-    complex_t *taps = ((complex_t *)fs->taps);
-    int last_tap = fs->ntaps / 2 - 1;
-    for (int i = 0; i < fs->ntaps / 2; i++) {
-        c_out += d_in[i] * taps[last_tap-i];
-    }
-    fs->offset += 2;
-    *((complex_t *)output) = c_out;
-}
-
-
 /*
 def read(self, n):
     """Read filtered data"""
@@ -339,14 +440,26 @@ static int fir_stream_read(stream_t *stream, float *output, int count) {
         return 0;
     }
 
-    if (fs->is_complex) {
-        for (int i = 0; i < count; i += 2) {
-            fir_stream_fir_filter_complex(fs, &output[i]);
+    int step = fs->is_complex ? 2 : 1;
+    int taps = fs->ntaps / step;
+    count -= count % step;
+
+    int read = 0;
+    while (read < count) {
+        if (fs->offset + fs->ntaps > BUFFER_SIZE) {
+            fir_stream_shift_and_read(fs);
         }
-    } else {
-        for (int i = 0; i < count; i++) {
-            fir_stream_fir_filter(fs, &output[i]);
+
+        // All the outputs whose input window is in the buffer are computed at once
+        int n = min(count - read, BUFFER_SIZE - fs->ntaps - fs->offset + step);
+        const float *input = &fs->buffer[fs->offset];
+        if (!fs->is_complex || fs->real_taps) {
+            fs->kernels->real_taps(input, step, fs->taps, taps, &output[read], n);
+        } else {
+            fs->kernels->complex_taps(input, fs->taps, &fs->taps[taps], taps, &output[read], n);
         }
+        fs->offset += n;
+        read += n;
     }
 
     fs->base.offset += count;
@@ -367,6 +480,11 @@ static void fir_stream_seek(stream_t *stream, uint32_t offset) {
     fs->base.eos = (fs->parent && fs->parent->eos);
 }
 
+static bool fir_stream_find_time(stream_t *stream, uint64_t time_ns, uint32_t *offset) {
+    struct fir_stream *fs = (struct fir_stream *)stream;
+    return fs->parent && fs->parent->find_time && fs->parent->find_time(fs->parent, time_ns, offset);
+}
+
 static void fir_stream_cleanup(stream_t *stream) {
     struct fir_stream *fs = (struct fir_stream *)stream;
     if (fs->parent) {
@@ -374,7 +492,344 @@ static void fir_stream_cleanup(stream_t *stream) {
     }
 }
 
+static void fft_fir_stream_transform(struct fft_fir_stream *fs) {
+    int n = fft_size(fs->plan);
+    int width = fs->is_complex ? 2 : 1;
+    int history = fs->ntaps - 1;
+
+    memmove(fs->input_re, &fs->input_re[fs->step], history * sizeof(float));
+    memmove(fs->input_im, &fs->input_im[fs->step], history * sizeof(float));
+
+    int wanted = fs->step * width;
+    int read = 0;
+    while (read < wanted) {
+        int r = fs->parent->read(fs->parent, &fs->samples[read], wanted - read);
+        if (r <= 0) {
+            fs->parent_eos = true;
+            break;
+        }
+        read += r;
+    }
+    bzero(&fs->samples[read], (wanted - read) * sizeof(float));
+
+    float *re = &fs->input_re[history];
+    float *im = &fs->input_im[history];
+    for (int i = 0; i < fs->step; i++) {
+        re[i] = fs->samples[width * i];
+        im[i] = fs->is_complex ? fs->samples[width * i + 1] : 0;
+    }
+
+    memcpy(fs->work_re, fs->input_re, n * sizeof(float));
+    memcpy(fs->work_im, fs->input_im, n * sizeof(float));
+    fft_forward(fs->plan, fs->work_re, fs->work_im);
+    for (int k = 0; k < n; k++) {
+        float xr = fs->work_re[k], xi = fs->work_im[k];
+        fs->work_re[k] = xr * fs->spectrum_re[k] - xi * fs->spectrum_im[k];
+        fs->work_im[k] = xr * fs->spectrum_im[k] + xi * fs->spectrum_re[k];
+    }
+    fft_inverse(fs->plan, fs->work_re, fs->work_im);
+
+    // Only the outputs of the samples that were read
+    fs->output_count = read - read % width;
+    fs->output_offset = 0;
+}
+
+static int fft_fir_stream_read(stream_t *stream, float *output, int count) {
+    struct fft_fir_stream *fs = (struct fft_fir_stream *)stream;
+
+    if (fs->base.eos) {
+        return 0;
+    }
+
+    int history = fs->ntaps - 1;
+    int read = 0;
+    while (read < count) {
+        if (fs->output_offset == fs->output_count) {
+            if (fs->parent_eos) {
+                fs->base.eos = true;
+                break;
+            }
+            fft_fir_stream_transform(fs);
+            continue;
+        }
+
+        int n = min(count - read, fs->output_count - fs->output_offset);
+        if (fs->is_complex) {
+            const float *re = &fs->work_re[history + fs->output_offset / 2];
+            const float *im = &fs->work_im[history + fs->output_offset / 2];
+            n -= n % 2;
+            if (n == 0) {
+                break;
+            }
+            for (int i = 0; i < n / 2; i++) {
+                output[read + 2 * i] = re[i];
+                output[read + 2 * i + 1] = im[i];
+            }
+        } else {
+            memcpy(&output[read], &fs->work_re[history + fs->output_offset], n * sizeof(float));
+        }
+        fs->output_offset += n;
+        read += n;
+    }
+
+    fs->base.offset += read;
+
+    return read;
+}
+
+static void fft_fir_stream_seek(stream_t *stream, uint32_t offset) {
+    struct fft_fir_stream *fs = (struct fft_fir_stream *)stream;
+    if (fs->parent && fs->parent->seek) {
+        fs->parent->seek(fs->parent, offset);
+        fs->base.offset = fs->parent->offset;
+    }
+
+    // Start again from silence, like the direct form
+    int n = fft_size(fs->plan);
+    bzero(fs->input_re, n * sizeof(float));
+    bzero(fs->input_im, n * sizeof(float));
+    fs->output_count = 0;
+    fs->output_offset = 0;
+    fs->parent_eos = (fs->parent && fs->parent->eos);
+    fs->base.eos = fs->parent_eos;
+}
+
+static bool fft_fir_stream_find_time(stream_t *stream, uint64_t time_ns, uint32_t *offset) {
+    struct fft_fir_stream *fs = (struct fft_fir_stream *)stream;
+    return fs->parent && fs->parent->find_time && fs->parent->find_time(fs->parent, time_ns, offset);
+}
+
+static void fft_fir_stream_cleanup(stream_t *stream) {
+    struct fft_fir_stream *fs = (struct fft_fir_stream *)stream;
+    if (fs->parent) {
+        free_stream(fs->parent);
+    }
+    free(fs->spectrum_re);
+}
+
+stream_t* new_fft_fir_stream(stream_t *data, float *taps, int tap_count, bool is_complex) {
+    int width = is_complex ? 2 : 1;
+    int ntaps = tap_count / width;
+    if (ntaps < 1) {
+        return NULL;
+    }
+
+    // Transforms of four times the taps or more, so most of every transform is output
+    int n = 1;
+    while (n < 4 * ntaps) {
+        n *= 2;
+    }
+    const fft_plan_t *plan = fft_plan(n);
+    if (!plan) {
+        return NULL;
+    }
+
+    struct fft_fir_stream *fs = (struct fft_fir_stream *)calloc(1, sizeof(struct fft_fir_stream));
+    if (!fs) {
+        return NULL;
+    }
+
+    int step = n - ntaps + 1;
+    fs->spectrum_re = (float *)calloc(6 * n + width * step, sizeof(float));
+    if (!fs->spectrum_re) {
+        free(fs);
+        return NULL;
+    }
+    fs->spectrum_im = fs->spectrum_re + n;
+    fs->input_re = fs->spectrum_im + n;
+    fs->input_im = fs->input_re + n;
+    fs->work_re = fs->input_im + n;
+    fs->work_im = fs->work_re + n;
+    fs->samples = fs->work_im + n;
+
+    fs->parent = data;
+    fs->is_complex = is_complex;
+    fs->plan = plan;
+    fs->ntaps = ntaps;
+    fs->step = step;
+    fs->base.read = fft_fir_stream_read;
+    fs->base.seek = fft_fir_stream_seek;
+    fs->base.find_time = fft_fir_stream_find_time;
+    fs->base.cleanup = fft_fir_stream_cleanup;
+
+    for (int i = 0; i < ntaps; i++) {
+        fs->spectrum_re[i] = taps[width * i] / n;
+        fs->spectrum_im[i] = is_complex ? taps[width * i + 1] / n : 0;
+    }
+    fft_forward(plan, fs->spectrum_re, fs->spectrum_im);
+
+    return (stream_t *)fs;
+}
+
+static void polyphase_fir_stream_fill(struct polyphase_fir_stream *ps) {
+    int width = ps->is_complex ? 2 : 1;
+
+    // Drop the samples before the input window of the next output
+    int drop = min(ps->position - (ps->phase_taps - 1), ps->filled);
+    memmove(ps->buffer, &ps->buffer[drop * width], (ps->filled - drop) * width * sizeof(float));
+    ps->filled -= drop;
+    ps->position -= drop;
+
+    while (ps->filled < ps->capacity) {
+        int r = ps->parent->read(ps->parent, &ps->buffer[ps->filled * width], (ps->capacity - ps->filled) * width);
+        if (r <= 0) {
+            ps->parent_eos = true;
+            break;
+        }
+        ps->filled += r / width;
+    }
+}
+
+static int polyphase_fir_stream_read(stream_t *stream, float *output, int count) {
+    struct polyphase_fir_stream *ps = (struct polyphase_fir_stream *)stream;
+
+    if (ps->base.eos) {
+        return 0;
+    }
+
+    int width = ps->is_complex ? 2 : 1;
+    int history = ps->phase_taps - 1;
+    count -= count % width;
+
+    int read = 0;
+    while (read < count) {
+        if (ps->position >= ps->filled) {
+            if (ps->parent_eos) {
+                ps->base.eos = true;
+                break;
+            }
+            polyphase_fir_stream_fill(ps);
+            continue;
+        }
+
+        const float *input = &ps->buffer[(ps->position - history) * width];
+        const float *taps = &ps->taps[ps->phase * ps->phase_taps * ps->tap_width];
+        if (!ps->is_complex) {
+            float sums[2];
+            ps->kernels->real_dot(input, taps, ps->phase_taps, sums);
+            output[read] = sums[0] + sums[1];
+        } else if (ps->real_taps) {
+            ps->kernels->real_dot(input, taps, 2 * ps->phase_taps, &output[read]);
+        } else {
+            ps->kernels->complex_dot(input, taps, ps->phase_taps, &output[read]);
+        }
+        read += width;
+
+        ps->phase += ps->decimation;
+        ps->position += ps->phase / ps->interpolation;
+        ps->phase %= ps->interpolation;
+    }
+
+    ps->base.offset += read;
+
+    return read;
+}
+
+static void polyphase_fir_stream_seek(stream_t *stream, uint32_t offset) {
+    struct polyphase_fir_stream *ps = (struct polyphase_fir_stream *)stream;
+    int width = ps->is_complex ? 2 : 1;
+    if (ps->parent && ps->parent->seek) {
+        ps->parent->seek(ps->parent, offset);
+        ps->base.offset = ps->parent->offset / width * ps->interpolation / ps->decimation * width;
+    }
+
+    // Start again from silence, like the direct form
+    bzero(ps->buffer, (ps->phase_taps - 1) * width * sizeof(float));
+    ps->filled = ps->phase_taps - 1;
+    ps->position = ps->phase_taps - 1;
+    ps->phase = 0;
+    ps->parent_eos = (ps->parent && ps->parent->eos);
+    ps->base.eos = ps->parent_eos;
+}
+
+static bool polyphase_fir_stream_find_time(stream_t *stream, uint64_t time_ns, uint32_t *offset) {
+    struct polyphase_fir_stream *ps = (struct polyphase_fir_stream *)stream;
+    return ps->parent && ps->parent->find_time && ps->parent->find_time(ps->parent, time_ns, offset);
+}
+
+static void polyphase_fir_stream_cleanup(stream_t *stream) {
+    struct polyphase_fir_stream *ps = (struct polyphase_fir_stream *)stream;
+    if (ps->parent) {
+        free_stream(ps->parent);
+    }
+}
+
+stream_t* new_polyphase_fir_stream(stream_t *data, float *taps, int tap_count, bool is_complex,
+                                   int interpolation, int decimation) {
+    int width = is_complex ? 2 : 1;
+    int ntaps = tap_count / width;
+    if (ntaps < 1 || interpolation < 1 || decimation < 1) {
+        return NULL;
+    }
+
+    // Phase p has taps p, p + interpolation, p + 2 * interpolation, ...
+    int phase_taps = (ntaps + interpolation - 1) / interpolation;
+    int capacity = phase_taps - 1 + BUFFER_SIZE;
+    size_t tap_floats = (size_t)interpolation * phase_taps * width;
+
+    struct polyphase_fir_stream *ps = (struct polyphase_fir_stream *)calloc(1,
+        sizeof(struct polyphase_fir_stream) + sizeof(float) * (tap_floats + (size_t)capacity * width));
+    if (!ps) {
+        return NULL;
+    }
+
+    ps->parent = data;
+    ps->is_complex = is_complex;
+    ps->kernels = fir_best_implementation();
+    ps->interpolation = interpolation;
+    ps->decimation = decimation;
+    ps->phase_taps = phase_taps;
+    ps->tap_width = width;
+    ps->capacity = capacity;
+    ps->buffer = &ps->taps[tap_floats];
+    ps->filled = phase_taps - 1;
+    ps->position = phase_taps - 1;
+    ps->base.read = polyphase_fir_stream_read;
+    ps->base.seek = polyphase_fir_stream_seek;
+    ps->base.find_time = polyphase_fir_stream_find_time;
+    ps->base.cleanup = polyphase_fir_stream_cleanup;
+
+    ps->real_taps = true;
+    for (int k = 0; is_complex && k < ntaps; k++) {
+        ps->real_taps = ps->real_taps && taps[2 * k + 1] == 0;
+    }
+
+    for (int p = 0; p < interpolation; p++) {
+        for (int t = 0; t < phase_taps; t++) {
+            int k = p + (phase_taps - 1 - t) * interpolation;
+            if (k >= ntaps) {
+                continue;
+            }
+            float *tap = &ps->taps[((size_t)p * phase_taps + t) * width];
+            tap[0] = taps[width * k];
+            if (is_complex) {
+                tap[1] = ps->real_taps ? taps[2 * k] : taps[2 * k + 1];
+            }
+        }
+    }
+
+    return (stream_t *)ps;
+}
+
 stream_t* new_fir_stream(stream_t *data, float *taps, int tap_count, bool is_complex) {
+    // A complex tap is a pair of floats
+    if (is_complex) {
+        tap_count -= tap_count % 2;
+    }
+
+    int cost = tap_count;
+    if (is_complex) {
+        cost = tap_count / 2;
+        for (int i = 1; i < tap_count && cost < tap_count; i += 2) {
+            if (taps[i] != 0) {
+                cost = tap_count;
+            }
+        }
+    }
+    if (cost >= FFT_FIR_MIN_TAPS) {
+        return new_fft_fir_stream(data, taps, tap_count, is_complex);
+    }
+
     struct fir_stream *fs = (struct fir_stream *)calloc(1, sizeof(struct fir_stream) + sizeof(float) * tap_count);
     if (!fs) {
         return NULL;
@@ -383,104 +838,131 @@ stream_t* new_fir_stream(stream_t *data, float *taps, int tap_count, bool is_com
     fs->offset = BUFFER_SIZE;
     fs->parent = data;
     fs->is_complex = is_complex;
+    fs->kernels = fir_best_implementation();
     fs->ntaps = tap_count;
     fs->overlap = is_complex ? tap_count - 2 : tap_count - 1;
     fs->base.read = fir_stream_read;
     fs->base.seek = fir_stream_seek;
+    fs->base.find_time = fir_stream_find_time;
     fs->base.cleanup = fir_stream_cleanup;
-    memcpy(&fs->taps[0], taps, tap_count * sizeof(float));
 
-    return (stream_t *)fs;
-}
-
-
-static struct stream_dir_entry_s* find_stream_entry(const char *name, const char *path, stream_list_t *list) {
-    struct stream_dir_entry_s *entry = SLIST_FIRST(list);
-
-    while (entry) {
-        if (!strncmp(entry->name, name, STORE_MAX_NAME) && !strncmp(entry->path, path, STORE_MAX_PATH))
-            return entry;
-        entry = SLIST_NEXT(entry, next);
+    if (is_complex) {
+        int n = tap_count / 2;
+        fs->real_taps = true;
+        for (int i = 0; i < n; i++) {
+            fs->taps[i] = taps[2 * (n - 1 - i)];
+            fs->taps[n + i] = taps[2 * (n - 1 - i) + 1];
+            fs->real_taps = fs->real_taps && fs->taps[n + i] == 0;
+        }
+    } else {
+        for (int i = 0; i < tap_count; i++) {
+            fs->taps[i] = taps[tap_count - 1 - i];
+        }
     }
 
-    return NULL;
+    return (stream_t *)fs;
 }
 
+
 stream_t* find_stream(const char *name, const char *path, stream_list_t *list) {
-    struct stream_dir_entry_s *entry = find_stream_entry(name, path, list);
+    dir_entry_t *entry = directory_find(&list->dir, name, path);
     if (!entry) {
         return NULL;
     }
 
-    return entry->stream;
+    return (stream_t *)entry->item;
 }
 
-
-
-
 int add_stream(const char *name, const char *path, stream_list_t *list, stream_t *stream) {
     if (find_stream(name, path, list)) {
         return STREAM_ALREADY_EXISTS;
     }
 
-    struct stream_dir_entry_s *entry = calloc(1, sizeof(struct stream_dir_entry_s));
-    if (!entry) {
+    if (!directory_add(&list->dir, name, path, stream)) {
         return STREAM_OUT_OF_MEMORY;
     }
 
-    strncpy(entry->name, name, STORE_MAX_NAME);
-    strncpy(entry->path, path, STORE_MAX_PATH);
-    entry->stream = stream;
-
     fprintf(stderr, "Creating stream '%s/%s'\n", path, name);
 
-    SLIST_INSERT_HEAD(list, entry, next);
-
     return STREAM_OK;
 }
 
 int remove_stream(const char *name, const char *path, stream_list_t *list) {
-    struct stream_dir_entry_s *entry = find_stream_entry(name, path, list);
+    dir_entry_t *entry = directory_find(&list->dir, name, path);
     if (!entry) {
         return STREAM_NOT_FOUND;
     }
 
-    SLIST_REMOVE(list, entry, stream_dir_entry_s, next);
-
-    free_stream(entry->stream);
-    free(entry);
+    stream_t *stream = (stream_t *)entry->item;
+    directory_remove(&list->dir, entry);
+    free_stream(stream);
 
     return STREAM_OK;
 }
 
+struct stream_iterate_ctx {
+    iterate_streams_callback callback;
+    void *context;
+};
+
+static bool stream_iterate_callback(void *context, dir_entry_t *entry) {
+    struct stream_iterate_ctx *ctx = (struct stream_iterate_ctx *)context;
+    return ctx->callback(ctx->context, entry->name, entry->path, (stream_t *)entry->item);
+}
+
+void iterate_stream_list_after(const char *path, const char *after_path, const char *after_name, stream_list_t *list,
+                               iterate_streams_callback callback, void *context) {
+    struct stream_iterate_ctx ctx = { .callback = callback, .context = context };
+    directory_iterate(&list->dir, path, after_path, after_name, stream_iterate_callback, &ctx);
+}
+
 void iterate_stream_list(const char *path, stream_list_t *list, iterate_streams_callback callback, void *context) {
-    struct stream_dir_entry_s *entry = SLIST_FIRST(list);
+    iterate_stream_list_after(path, "", "", list, callback, context);
+}
 
-    while (entry) {
-        // fprintf(stderr, "Iterate: %s/%s\n", entry->path, entry->name);
-        if (!path[0] || !strncmp(entry->path, path, STORE_MAX_PATH)) {
-            if (callback(context, entry->name, entry->path, entry->stream))
-                break;
-        }
-        entry = SLIST_NEXT(entry, next);
+void free_stream_list(stream_list_t *list) {
+    for (uint32_t i = 0; i < list->dir.count; i++) {
+        free_stream((stream_t *)list->dir.sorted[i]->item);
     }
+    directory_clear(&list->dir);
 }
 
 static void store_reader_clear_buffer(struct store_reader_stream *sr) {
     sr->base.eos = true;
-    bzero(sr->buffer, sizeof(float) * BUFFER_SIZE);
-    sr->buffer_count = 0;
-    sr->buffer_offset = 0;
+    sr->block = NULL;
+    sr->sample_count = 0;
+    sr->sample_offset = 0;
 }
 
-#define BLOCK_TYPE_I8_SAMPLES  1
-#define BLOCK_TYPE_I16_SAMPLES 2
-#define BLOCK_TYPE_I32_SAMPLES 3
-#define BLOCK_TYPE_F32_SAMPLES 4
-#define BLOCK_TYPE_F64_SAMPLES 5
+// Returns the current block from the read-ahead buffer, refilling it with a single
+// batched store read when the current block is not in it.
+static int store_reader_readahead_block(struct store_reader_stream *sr, const block_t **block) {
+    uint32_t readahead_blocks = max(1, READER_READAHEAD_BLOCKS * BLOCK_LENGTH / sr->store->block_size);
+
+    if (sr->current_block - sr->readahead_start >= sr->readahead_count) {
+        if (!sr->readahead) {
+            sr->readahead = store_alloc_blocks(sr->store, readahead_blocks);
+            if (!sr->readahead) {
+                return STORE_OUT_OF_MEMORY;
+            }
+        }
+
+        uint32_t count = min(sr->end_block - sr->current_block, readahead_blocks);
+        int res = store_read_blocks(sr->store, sr->readahead, sr->current_block, count);
+        if (res != STORE_OK) {
+            sr->readahead_count = 0;
+            return res;
+        }
+        sr->readahead_start = sr->current_block;
+        sr->readahead_count = count;
+    }
+
+    *block = store_block(sr->store, sr->readahead, sr->current_block - sr->readahead_start);
+    return STORE_OK;
+}
 
 static void store_reader_fill_block(struct store_reader_stream *sr) {
-    block_t block;
+    const block_t *block;
 
     if (sr->current_block < sr->start_block || sr->current_block >= sr->end_block) {
         // Reading before / after stream will trigger an EOS
@@ -488,66 +970,48 @@ static void store_reader_fill_block(struct store_reader_stream *sr) {
         return;
     }
 
-    int res = store_read_block(sr->store, &block, sr->current_block);
+    // Use the block in place if the store allows it, otherwise read ahead.
+    int res = store_map_block(sr->store, &block, sr->current_block);
+    if (res == STORE_NOT_MAPPED) {
+        res = store_reader_readahead_block(sr, &block);
+    }
     if (res != STORE_OK) {
         fprintf(stderr, "Store reader: Error reading from store: %d\n", res);
         store_reader_clear_buffer(sr);
         return;
     }
 
-    if (block.hdr.block_id != sr->current_block || block.hdr.block_length < BLOCK_HEADER_LENGTH) {
+    uint32_t length = block_get_length(block);
+    if (block->hdr.block_id != sr->current_block || length < BLOCK_HEADER_LENGTH || length > sr->store->block_size) {
         store_reader_clear_buffer(sr);
         return;
     }
 
-    sr->buffer_offset = 0;
+    sr->sample_offset = 0;
     sr->current_block++;
 
-    float scale = block.hdr.sample_block_header.scale;
-    if (scale == 0) {
-        scale = 1.0f;
-    }
-
-    int data_item_size = 1;
-    switch (block.hdr.block_type) {
-    case BLOCK_TYPE_I8_SAMPLES:
-        data_item_size = 1;
-        break;
-    case BLOCK_TYPE_I16_SAMPLES:
-        data_item_size = 2;
-        break;
-    case BLOCK_TYPE_I32_SAMPLES:
-        data_item_size = 4;
-        break;
-    case BLOCK_TYPE_F32_SAMPLES:
-        data_item_size = 4;
-        break;
-    case BLOCK_TYPE_F64_SAMPLES:
-        data_item_size = 8;
-        break;
-    }
-
-    sr->buffer_count = (block.hdr.block_length - BLOCK_HEADER_LENGTH) / data_item_size;
-
-    for (int i = 0; i < sr->buffer_count; i++) {
-        switch (block.hdr.block_type) {
-        case BLOCK_TYPE_I8_SAMPLES:
-            sr->buffer[i] = block.data.i8_samples[i] * scale;
-            break;
-        case BLOCK_TYPE_I16_SAMPLES:
-            sr->buffer[i] = block.data.i16_samples[i] * scale;
-            break;
-        case BLOCK_TYPE_I32_SAMPLES:
-            sr->buffer[i] = block.data.i32_samples[i] * scale;
-            break;
-        case BLOCK_TYPE_F32_SAMPLES:
-            sr->buffer[i] = block.data.f32_samples[i] * scale;
-            break;
-        case BLOCK_TYPE_F64_SAMPLES:
-            sr->buffer[i] = block.data.f64_samples[i] * scale;
-            break;
-        }
+    sr->scale = block->hdr.sample_block_header.scale;
+    if (sr->scale == 0) {
+        sr->scale = 1.0f;
     }
+
+    // The kernel is picked once per block, blocks without samples read as zeros
+    sr->convert = convert_samples_function(block->hdr.block_type);
+    sr->block = block;
+    sr->sample_count = (length - BLOCK_HEADER_LENGTH) / convert_sample_size(block->hdr.block_type);
+}
+
+// Converts count samples of the current block from sample_offset on, straight into the
+// reader's output
+static void store_reader_convert(struct store_reader_stream *sr, float *output, int count) {
+    if (!sr->convert) {
+        bzero(output, count * sizeof(float));
+        return;
+    }
+
+    const uint8_t *payload = block_payload(sr->block);
+    sr->convert(payload + (size_t)sr->sample_offset * convert_sample_size(sr->block->hdr.block_type),
+                output, count, sr->scale);
 }
 
 static int store_reader_read(stream_t *stream, float *output, int count) {
@@ -556,19 +1020,20 @@ static int store_reader_read(stream_t *stream, float *output, int count) {
     int r = 0;
 
     while ((!sr->base.eos) && (count > 0)) {
-        int to_read = min(sr->buffer_count - sr->buffer_offset, count);
+        int to_read = min(sr->sample_count - sr->sample_offset, count);
         if (to_read > 0) {
-            memcpy(&output[r], &sr->buffer[sr->buffer_offset], to_read * sizeof(float));
+            store_reader_convert(sr, &output[r], to_read);
             r += to_read;
             count -= to_read;
-            sr->buffer_offset += to_read;
+            sr->sample_offset += to_read;
         }
 
-        if (sr->buffer_offset == sr->buffer_count) {
+        if (sr->sample_offset == sr->sample_count) {
             store_reader_fill_block(sr);
         }
     }
 
+    sr->base.offset += r;
     return r;
 }
 
@@ -577,7 +1042,25 @@ static void store_reader_seek(stream_t *stream, uint32_t offset) {
 
     sr->current_block = sr->start_block + offset;
     sr->base.eos = false;
+    sr->readahead_count = 0;
     store_reader_fill_block(sr);
+
+    // Seek offsets are in blocks, stream offsets in samples, taking all blocks to be as
+    // long as this one
+    sr->base.offset = (int64_t)offset * sr->sample_count;
+}
+
+static bool store_reader_find_time(stream_t *stream, uint64_t time_ns, uint32_t *offset) {
+    struct store_reader_stream *sr = (struct store_reader_stream *)stream;
+
+    uint32_t block;
+    if (store_find_time(sr->store, time_ns, &block) != STORE_OK) {
+        return false;
+    }
+
+    // Seek offsets are relative to the first block of the stream
+    *offset = block > sr->start_block ? block - sr->start_block : 0;
+    return true;
 }
 
 static void store_reader_cleanup(stream_t *stream) {
@@ -585,6 +1068,9 @@ static void store_reader_cleanup(stream_t *stream) {
 
     store_release(sr->store);
     sr->store = NULL;
+
+    free(sr->readahead);
+    sr->readahead = NULL;
 }
 
 stream_t* new_store_reader_stream(store_t *store, uint32_t start_block, uint32_t end_block) {
@@ -598,6 +1084,7 @@ stream_t* new_store_reader_stream(store_t *store, uint32_t start_block, uint32_t
     sr->end_block = end_block;
     sr->base.cleanup = store_reader_cleanup;
     sr->base.seek = store_reader_seek;
+    sr->base.find_time = store_reader_find_time;
     sr->base.read = store_reader_read;
 
     store_use(sr->store);
@@ -3,10 +3,22 @@
 #include <eyeq/server/store.h>
 #include <eyeq/server/stream.h>
 
+// Most filter taps a FIR stream takes, in floats
+#define FIR_MAX_TAPS 65536
+// Largest interpolation and decimation of polyphase FIR streams
+#define FIR_MAX_RATE 4096
+
 stream_t* new_store_reader_stream(store_t *store, uint32_t start_block, uint32_t end_block);
 stream_t* new_complex_sine_stream(double phase, double frequency, double scale);
 stream_t* new_multiply_stream(stream_t *parent1, stream_t *parent2);
 stream_t* new_complex_multiply_stream(stream_t *parent1, stream_t *parent2);
 stream_t* new_array_stream(float *input, int length);
 stream_t* new_fir_stream(stream_t *data, float *taps, int tap_count, bool is_complex);
-stream_t* new_frequency_translate_stream(stream_t *parent, double frequency);
+stream_t* new_fft_fir_stream(stream_t *data, float *taps, int tap_count, bool is_complex);
+// Resamples by interpolation / decimation, taps at interpolation times the input rate and
+// with a gain of interpolation
+stream_t* new_polyphase_fir_stream(stream_t *data, float *taps, int tap_count, bool is_complex,
+                                   int interpolation, int decimation);
+// Multiplies a complex stream by exp(j (phase + 2 pi frequency n)) at sample n, frequency in
+// cycles per sample
+stream_t* new_frequency_translate_stream(stream_t *parent, double frequency, double phase);
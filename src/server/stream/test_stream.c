@@ -1,8 +1,12 @@
 #include <unistd.h>
 #include <math.h>
+#include <string.h>
 
 #include "unity.h"
 #include "stream.h"
+#include "convert.h"
+#include "fir.h"
+#include "nco.h"
 
 void setUp(void) {
 }
@@ -42,6 +46,83 @@ void test_read_int16_block(void) {
     free_store(store);
 }
 
+// Blocks over 64 KiB, read across the block boundary
+void test_read_large_blocks(void) {
+    const uint32_t block_size = 128 * 1024;
+    const uint32_t samples = block_payload_size(block_size);
+
+    store_t *store = new_snapshot_memory_store(NULL, 4, block_size, -1, false, true);
+    TEST_ASSERT_NOT_NULL(store);
+
+    block_t *blocks = store_alloc_blocks(store, 2);
+    TEST_ASSERT_NOT_NULL(blocks);
+    for (uint32_t b = 0; b < 2; b++) {
+        block_t *block = store_block(store, blocks, b);
+        block->hdr.block_type = BLOCK_TYPE_I8_SAMPLES;
+        block->hdr.sample_block_header.scale = b + 1;
+        block_set_length(block, block_size);
+        int8_t *payload = block_payload(block);
+        for (uint32_t i = 0; i < samples; i++) {
+            payload[i] = i % 100;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_blocks(store, blocks, -1, 2));
+    free(blocks);
+
+    stream_t *s = new_store_reader_stream(store, 0, 2);
+    TEST_ASSERT_NOT_NULL(s);
+
+    float *output = malloc(2 * samples * sizeof(float));
+    TEST_ASSERT_NOT_NULL(output);
+    for (uint32_t i = 0; i < 2 * samples; i += 1000) {
+        read_samples_from_stream(s, &output[i], 2 * samples - i < 1000 ? 2 * samples - i : 1000);
+    }
+    for (uint32_t i = 0; i < 2 * samples; i++) {
+        TEST_ASSERT_EQUAL_FLOAT((i / samples + 1) * (float)((i % samples) % 100), output[i]);
+    }
+
+    free(output);
+    free_stream(s);
+    free_store(store);
+}
+
+// Every kernel matches the scalar one exactly, for all sample types, start offsets and tails
+void test_convert_implementations(void) {
+    static uint8_t input[1024 * sizeof(double)];
+    static float expected[1024], output[1024];
+
+    const convert_implementation_t *implementations;
+    int count = convert_implementations(&implementations);
+    TEST_ASSERT_TRUE(count >= 1);
+
+    const size_t lengths[] = { 0, 1, 7, 15, 16, 17, 63, 100, 1000 };
+    for (uint16_t type = BLOCK_TYPE_I8_SAMPLES; type <= BLOCK_TYPE_F64_SAMPLES; type++) {
+        for (size_t i = 0; i < 1024; i++) {
+            int32_t value = (int32_t)(i * 2654435761u);
+            switch (type) {
+            case BLOCK_TYPE_I8_SAMPLES:  ((int8_t *)input)[i] = value >> 24; break;
+            case BLOCK_TYPE_I16_SAMPLES: ((int16_t *)input)[i] = value >> 16; break;
+            case BLOCK_TYPE_I32_SAMPLES: ((int32_t *)input)[i] = value; break;
+            case BLOCK_TYPE_F32_SAMPLES: ((float *)input)[i] = value / 3e9f; break;
+            case BLOCK_TYPE_F64_SAMPLES: ((double *)input)[i] = value / 3e9; break;
+            }
+        }
+
+        const uint8_t *samples = input;
+        for (int offset = 0; offset < 4; offset++, samples += convert_sample_size(type)) {
+            for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+                implementations[0].convert[type](samples, expected, lengths[l], 0.37f);
+                for (int i = 1; i < count; i++) {
+                    memset(output, 0, sizeof(output));
+                    implementations[i].convert[type](samples, output, lengths[l], 0.37f);
+                    TEST_ASSERT_EQUAL_MEMORY(expected, output, lengths[l] * sizeof(float));
+                    TEST_ASSERT_EQUAL_FLOAT(0, output[lengths[l]]);
+                }
+            }
+        }
+    }
+}
+
 void test_complex_sine_stream(void) {
     float output[32];
     const float reference[32] = { 1.000000e+00,0.000000e+00,8.090170e-01,5.877852e-01,3.090170e-01,9.510565e-01,-3.090170e-01,9.510565e-01,-8.090171e-01,5.877852e-01,-1.000000e+00,-8.742278e-08,-8.090169e-01,-5.877854e-01,-3.090171e-01,-9.510565e-01,3.090171e-01,-9.510565e-01,8.090172e-01,-5.877849e-01,1.000000e+00,0.000000e+00,8.090169e-01,5.877854e-01,3.090167e-01,9.510566e-01,-3.090174e-01,9.510564e-01,-8.090169e-01,5.877854e-01,-1.000000e+00,-8.742278e-08 };
@@ -74,6 +155,93 @@ void test_multiply(void) {
     free_stream(s);
 }
 
+// Every oscillator is within float precision of exp(2 pi j f n), also where f * n no longer
+// fits a float
+void test_nco_implementations(void) {
+    static float samples[2 * 1000];
+    const nco_implementation_t *implementations;
+    int count = nco_implementations(&implementations);
+    TEST_ASSERT_TRUE(count >= 1);
+
+    const double frequencies[] = { 0.1, -0.3217, 1e-6, 0.5 };
+    for (size_t f = 0; f < sizeof(frequencies) / sizeof(frequencies[0]); f++) {
+        // The frequency is rounded to the phase resolution of 2^-32 cycles
+        uint32_t step = nco_phase(frequencies[f]);
+        double frequency = step / 4294967296.0;
+        // From sample 10^8 on, and 999 samples so the vector kernels have a tail
+        uint32_t phase = step * 100000000u;
+        for (int i = 0; i < count; i++) {
+            for (int n = 0; n < 1000; n++) {
+                samples[2 * n] = 1;
+                samples[2 * n + 1] = n % 2;
+            }
+            implementations[i].mix(phase, step, samples, 2 * 999);
+            for (int n = 0; n < 999; n++) {
+                double angle = 2 * M_PI * fmod(frequency * (100000000.0 + n), 1);
+                double re = cos(angle) - (n % 2) * sin(angle);
+                double im = sin(angle) + (n % 2) * cos(angle);
+                TEST_ASSERT_FLOAT_WITHIN(2e-6, re, samples[2 * n]);
+                TEST_ASSERT_FLOAT_WITHIN(2e-6, im, samples[2 * n + 1]);
+            }
+            TEST_ASSERT_EQUAL_FLOAT(1, samples[2 * 999]);
+        }
+    }
+}
+
+// Frequency translation multiplies by the oscillator of the sample offset, also after seeking
+void test_frequency_translate_stream(void) {
+    static float input[2 * 5000], output[2 * 5000];
+    for (int i = 0; i < 2 * 5000; i++) {
+        input[i] = (int32_t)(i * 2654435761u) / 2147483648.0f;
+    }
+
+    stream_t *s = new_frequency_translate_stream(new_array_stream(input, 2 * 5000), 0.01, 0.5);
+    TEST_ASSERT_NOT_NULL(s);
+
+    for (int pass = 0; pass < 2; pass++) {
+        s->seek(s, pass * 2 * 1000);
+        read_samples_from_stream(s, &output[pass * 2 * 1000], 2 * 1000);
+        for (int n = pass * 1000; n < (pass + 1) * 1000; n++) {
+            double angle = 0.5 + 2 * M_PI * 0.01 * n;
+            double xr = input[2 * n], xi = input[2 * n + 1];
+            TEST_ASSERT_FLOAT_WITHIN(1e-6, xr * cos(angle) - xi * sin(angle), output[2 * n]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-6, xr * sin(angle) + xi * cos(angle), output[2 * n + 1]);
+        }
+    }
+
+    free_stream(s);
+}
+
+// Store readers seek in blocks, the oscillator still picks up at the right sample
+void test_frequency_translate_store_reader(void) {
+    block_t block = { 0 };
+    store_t *store = new_memory_store(4);
+    TEST_ASSERT_NOT_NULL(store);
+    for (int b = 0; b < 3; b++) {
+        for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
+            block.data.i16_samples[i] = i % 2 ? 0 : 1000;
+        }
+        block.hdr.block_length = BLOCK_LENGTH;
+        block.hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+
+    stream_t *s = new_frequency_translate_stream(new_store_reader_stream(store, 0, 3), 0.01, 0);
+    TEST_ASSERT_NOT_NULL(s);
+
+    static float output[1000];
+    s->seek(s, 2);
+    read_samples_from_stream(s, output, 1000);
+    for (int i = 0; i < 1000; i += 2) {
+        double angle = 2 * M_PI * 0.01 * ((2 * BLOCK_I16_SAMPLES + i) / 2);
+        TEST_ASSERT_FLOAT_WITHIN(1e-2, 1000 * cos(angle), output[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-2, 1000 * sin(angle), output[i + 1]);
+    }
+
+    free_stream(s);
+    free_store(store);
+}
+
 void test_array_stream(void) {
     float zeros[32] = { 0 };
     float reference[32];
@@ -149,15 +317,278 @@ void test_fir_complex_stream(void) {
     free_stream(fir);
 }
 
+// Every FIR kernel matches the scalar one up to rounding, for every block size and tail
+void test_fir_implementations(void) {
+    static float input[1024 + 2 * 121];
+    static float taps_re[121], taps_im[121];
+    static float expected[1024], output[1024];
+    for (size_t i = 0; i < sizeof(input) / sizeof(input[0]); i++) {
+        input[i] = (int32_t)(i * 2654435761u) / 2147483648.0f;
+    }
+    for (int i = 0; i < 121; i++) {
+        taps_re[i] = sinf(i * 0.1f) / 121;
+        taps_im[i] = cosf(i * 0.3f) / 121;
+    }
+
+    const fir_implementation_t *implementations;
+    int count = fir_implementations(&implementations);
+    TEST_ASSERT_TRUE(count >= 1);
+
+    const int ntaps[] = { 1, 2, 7, 121 };
+    const int lengths[] = { 0, 2, 8, 30, 32, 66, 1024 };
+    for (size_t t = 0; t < sizeof(ntaps) / sizeof(ntaps[0]); t++) {
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+            for (int kind = 0; kind < 3; kind++) {
+                for (int i = 0; i < count; i++) {
+                    float *out = i == 0 ? expected : output;
+                    if (kind == 2) {
+                        implementations[i].complex_taps(input, taps_re, taps_im, ntaps[t], out, lengths[l]);
+                    } else {
+                        implementations[i].real_taps(input, kind + 1, taps_re, ntaps[t], out, lengths[l]);
+                    }
+                }
+                for (int i = 0; i < lengths[l] && count > 1; i++) {
+                    TEST_ASSERT_FLOAT_WITHIN(1e-5, expected[i], output[i]);
+                }
+            }
+        }
+    }
+
+    // Single outputs of polyphase filters, of lengths that leave every tail
+    for (int n = 0; n <= 242; n += 11) {
+        float real[2], complex[2];
+        implementations[0].real_dot(input, &input[500], n, real);
+        implementations[0].complex_dot(input, &input[500], n / 2, complex);
+        for (int i = 1; i < count; i++) {
+            implementations[i].real_dot(input, &input[500], n, output);
+            implementations[i].complex_dot(input, &input[500], n / 2, &output[2]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, real[0], output[0]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, real[1], output[1]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, complex[0], output[2]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-5, complex[1], output[3]);
+        }
+    }
+}
+
+// Complex streams with real taps take the real kernel, and give what complex taps give
+void test_fir_real_taps(void) {
+    float input[2 * 500];
+    float real_taps[2 * 31], complex_taps[2 * 31];
+    float expected[2 * 400], output[2 * 400];
+    for (int i = 0; i < 2 * 500; i++) {
+        input[i] = sinf(i * 0.37f);
+    }
+    for (int i = 0; i < 31; i++) {
+        real_taps[2 * i] = complex_taps[2 * i] = 1.0f / (i + 1);
+        real_taps[2 * i + 1] = 0;
+        complex_taps[2 * i + 1] = i == 30 ? 1e-30f : 0;
+    }
+
+    stream_t *fir = new_fir_stream(new_array_stream(input, 2 * 500), complex_taps, 2 * 31, true);
+    TEST_ASSERT_NOT_NULL(fir);
+    fir->seek(fir, 0);
+    read_samples_from_stream(fir, expected, 2 * 400);
+    free_stream(fir);
+
+    fir = new_fir_stream(new_array_stream(input, 2 * 500), real_taps, 2 * 31, true);
+    TEST_ASSERT_NOT_NULL(fir);
+    fir->seek(fir, 0);
+    read_samples_from_stream(fir, output, 2 * 400);
+    free_stream(fir);
+
+    for (int i = 0; i < 2 * 400; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, expected[i], output[i]);
+    }
+}
+
+// y[n] = sum taps[k] * x[n - k] in double precision, width 2 for complex samples and taps
+static void convolve(const float *input, int input_length, const float *taps, int ntaps, int width,
+                     double *output, int output_length) {
+    for (int n = 0; n < output_length; n++) {
+        double re = 0, im = 0;
+        for (int k = 0; k < ntaps && k <= n; k++) {
+            if (n - k >= input_length) {
+                continue;
+            }
+            double xr = input[width * (n - k)], tr = taps[width * k];
+            double xi = width == 2 ? input[2 * (n - k) + 1] : 0, ti = width == 2 ? taps[2 * k + 1] : 0;
+            re += xr * tr - xi * ti;
+            im += xr * ti + xi * tr;
+        }
+        output[width * n] = re;
+        if (width == 2) {
+            output[2 * n + 1] = im;
+        }
+    }
+}
+
+// Long filters are applied by FFT, read in pieces that do not line up with the transforms
+void test_fft_fir_stream(void) {
+    static float input[2 * 3000], taps[2 * 700], output[2 * 3000];
+    static double reference[2 * 3000];
+    for (int i = 0; i < 2 * 3000; i++) {
+        input[i] = (int32_t)(i * 2654435761u) / 2147483648.0f;
+    }
+    for (int i = 0; i < 2 * 700; i++) {
+        taps[i] = sinf(i * 0.05f) / 100;
+    }
+
+    const int ntaps[] = { 700, 65, 1 };
+    for (size_t t = 0; t < sizeof(ntaps) / sizeof(ntaps[0]); t++) {
+        for (int width = 1; width <= 2; width++) {
+            int length = 3000 * width;
+            convolve(input, 3000, taps, ntaps[t], width, reference, 3000);
+
+            stream_t *fir = new_fft_fir_stream(new_array_stream(input, length), taps, ntaps[t] * width, width == 2);
+            TEST_ASSERT_NOT_NULL(fir);
+
+            // Twice, the second time after seeking back to the start
+            for (int pass = 0; pass < 2; pass++) {
+                fir->seek(fir, 0);
+                for (int i = 0; i < length; i += 334) {
+                    read_samples_from_stream(fir, &output[i], length - i < 334 ? length - i : 334);
+                }
+                for (int i = 0; i < length; i++) {
+                    TEST_ASSERT_FLOAT_WITHIN(1e-5, reference[i], output[i]);
+                }
+            }
+
+            free_stream(fir);
+        }
+    }
+}
+
+// FFT filters give as many samples as their input, delayed by a one sample delay tap, and end
+// with it
+void test_fft_fir_stream_eos(void) {
+    block_t block = { 0 };
+    store_t *store = new_memory_store(4);
+    TEST_ASSERT_NOT_NULL(store);
+    for (int b = 0; b < 2; b++) {
+        for (int i = 0; i < BLOCK_I16_SAMPLES; i++) {
+            block.data.i16_samples[i] = i % 1000 + b;
+        }
+        block.hdr.block_length = BLOCK_LENGTH;
+        block.hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+        TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+    }
+
+    float taps[2 * 100] = { 0 };
+    taps[2] = 1;
+    stream_t *fir = new_fft_fir_stream(new_store_reader_stream(store, 0, 2), taps, 2 * 100, true);
+    TEST_ASSERT_NOT_NULL(fir);
+    fir->seek(fir, 0);
+
+    static float output[2 * BLOCK_I16_SAMPLES + 1000];
+    int read = 0;
+    while (!fir->eos) {
+        read += fir->read(fir, &output[read], 1000);
+    }
+    TEST_ASSERT_EQUAL_INT(2 * BLOCK_I16_SAMPLES, read);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 0, output[0]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, 0, output[1]);
+    for (int i = 2; i < read; i++) {
+        float expected = (i - 2) % BLOCK_I16_SAMPLES % 1000 + (i - 2) / BLOCK_I16_SAMPLES;
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, expected, output[i]);
+    }
+
+    free_stream(fir);
+    free_store(store);
+}
+
+// Resampling gives every decimation-th output of the filter over the input with
+// interpolation - 1 zeros after every sample
+void test_polyphase_fir_stream(void) {
+    static float input[2 * 1000], upsampled[2 * 3000], output[2 * 3000];
+    static float complex_taps[2 * 121], real_taps[2 * 121];
+    static double reference[2 * 3000];
+    for (int i = 0; i < 2 * 1000; i++) {
+        input[i] = (int32_t)(i * 2654435761u) / 2147483648.0f;
+    }
+    for (int i = 0; i < 121; i++) {
+        complex_taps[2 * i] = real_taps[2 * i] = sinf(i * 0.05f) / 50;
+        complex_taps[2 * i + 1] = cosf(i * 0.2f) / 50;
+    }
+
+    const int rates[][2] = { { 1, 1 }, { 1, 5 }, { 3, 1 }, { 3, 4 }, { 2, 7 } };
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++) {
+        int interpolation = rates[r][0], decimation = rates[r][1];
+        // Real stream, complex stream with real taps, complex stream with complex taps
+        for (int kind = 0; kind < 3; kind++) {
+            int width = kind ? 2 : 1;
+            float *taps = kind == 2 ? complex_taps : real_taps;
+            if (kind == 0) {
+                for (int i = 0; i < 121; i++) {
+                    taps[i] = sinf(i * 0.05f) / 50;
+                }
+            }
+
+            int length = 1000 * interpolation;
+            bzero(upsampled, sizeof(upsampled));
+            for (int i = 0; i < 1000 * width; i++) {
+                upsampled[width * interpolation * (i / width) + i % width] = input[i];
+            }
+            convolve(upsampled, length, taps, 121, width, reference, length);
+
+            stream_t *fir = new_polyphase_fir_stream(new_array_stream(input, 1000 * width), taps, 121 * width,
+                                                     width == 2, interpolation, decimation);
+            TEST_ASSERT_NOT_NULL(fir);
+
+            int count = (length + decimation - 1) / decimation * width;
+            for (int pass = 0; pass < 2; pass++) {
+                fir->seek(fir, 0);
+                for (int i = 0; i < count; i += 334) {
+                    read_samples_from_stream(fir, &output[i], count - i < 334 ? count - i : 334);
+                }
+                for (int i = 0; i < count; i++) {
+                    TEST_ASSERT_FLOAT_WITHIN(1e-5, reference[width * decimation * (i / width) + i % width], output[i]);
+                }
+            }
+
+            free_stream(fir);
+        }
+    }
+
+    // The stream ends after the outputs of the last input sample
+    block_t block = { 0 };
+    block.hdr.block_length = BLOCK_LENGTH;
+    block.hdr.block_type = BLOCK_TYPE_I16_SAMPLES;
+    store_t *store = new_memory_store(2);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL_INT(STORE_OK, store_write_block(store, &block, -1));
+
+    stream_t *fir = new_polyphase_fir_stream(new_store_reader_stream(store, 0, 1), real_taps, 2 * 121, true, 2, 7);
+    TEST_ASSERT_NOT_NULL(fir);
+    fir->seek(fir, 0);
+    int read = 0;
+    while (!fir->eos) {
+        read += fir->read(fir, &output[read], 334);
+    }
+    TEST_ASSERT_EQUAL_INT((BLOCK_I16_SAMPLES / 2 * 2 + 6) / 7 * 2, read);
+
+    free_stream(fir);
+    free_store(store);
+}
+
 int main(void) {
     UNITY_BEGIN();
 
     RUN_TEST(test_complex_sine_stream);
     RUN_TEST(test_multiply);
+    RUN_TEST(test_nco_implementations);
+    RUN_TEST(test_frequency_translate_stream);
+    RUN_TEST(test_frequency_translate_store_reader);
     RUN_TEST(test_array_stream);
     RUN_TEST(test_fir_stream);
     RUN_TEST(test_fir_complex_stream);
     RUN_TEST(test_read_int16_block);
+    RUN_TEST(test_read_large_blocks);
+    RUN_TEST(test_convert_implementations);
+    RUN_TEST(test_fir_implementations);
+    RUN_TEST(test_fir_real_taps);
+    RUN_TEST(test_fft_fir_stream);
+    RUN_TEST(test_fft_fir_stream_eos);
+    RUN_TEST(test_polyphase_fir_stream);
 
     return UNITY_END();
 }